@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/taco-tensor_times_vector"
+  "../../bin/taco-tensor_times_vector.pdb"
+  "CMakeFiles/tensor_times_vector.dir/tensor_times_vector.cpp.o"
+  "CMakeFiles/tensor_times_vector.dir/tensor_times_vector.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tensor_times_vector.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,6 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/apps/tensor_times_vector
+# Build directory: /root/repo/_llvm_build/apps/tensor_times_vector
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
@@ -0,0 +1,90 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/autotuner.cpp" "src/CMakeFiles/taco.dir/autotuner.cpp.o" "gcc" "src/CMakeFiles/taco.dir/autotuner.cpp.o.d"
+  "/root/repo/src/codegen/codegen.cpp" "src/CMakeFiles/taco.dir/codegen/codegen.cpp.o" "gcc" "src/CMakeFiles/taco.dir/codegen/codegen.cpp.o.d"
+  "/root/repo/src/codegen/codegen_c.cpp" "src/CMakeFiles/taco.dir/codegen/codegen_c.cpp.o" "gcc" "src/CMakeFiles/taco.dir/codegen/codegen_c.cpp.o.d"
+  "/root/repo/src/codegen/codegen_cuda.cpp" "src/CMakeFiles/taco.dir/codegen/codegen_cuda.cpp.o" "gcc" "src/CMakeFiles/taco.dir/codegen/codegen_cuda.cpp.o.d"
+  "/root/repo/src/codegen/codegen_llvm.cpp" "src/CMakeFiles/taco.dir/codegen/codegen_llvm.cpp.o" "gcc" "src/CMakeFiles/taco.dir/codegen/codegen_llvm.cpp.o.d"
+  "/root/repo/src/codegen/module.cpp" "src/CMakeFiles/taco.dir/codegen/module.cpp.o" "gcc" "src/CMakeFiles/taco.dir/codegen/module.cpp.o.d"
+  "/root/repo/src/cuda.cpp" "src/CMakeFiles/taco.dir/cuda.cpp.o" "gcc" "src/CMakeFiles/taco.dir/cuda.cpp.o.d"
+  "/root/repo/src/error.cpp" "src/CMakeFiles/taco.dir/error.cpp.o" "gcc" "src/CMakeFiles/taco.dir/error.cpp.o.d"
+  "/root/repo/src/error/error_checks.cpp" "src/CMakeFiles/taco.dir/error/error_checks.cpp.o" "gcc" "src/CMakeFiles/taco.dir/error/error_checks.cpp.o.d"
+  "/root/repo/src/error/error_messages.cpp" "src/CMakeFiles/taco.dir/error/error_messages.cpp.o" "gcc" "src/CMakeFiles/taco.dir/error/error_messages.cpp.o.d"
+  "/root/repo/src/format.cpp" "src/CMakeFiles/taco.dir/format.cpp.o" "gcc" "src/CMakeFiles/taco.dir/format.cpp.o.d"
+  "/root/repo/src/index_notation/index_notation.cpp" "src/CMakeFiles/taco.dir/index_notation/index_notation.cpp.o" "gcc" "src/CMakeFiles/taco.dir/index_notation/index_notation.cpp.o.d"
+  "/root/repo/src/index_notation/index_notation_nodes.cpp" "src/CMakeFiles/taco.dir/index_notation/index_notation_nodes.cpp.o" "gcc" "src/CMakeFiles/taco.dir/index_notation/index_notation_nodes.cpp.o.d"
+  "/root/repo/src/index_notation/index_notation_nodes_abstract.cpp" "src/CMakeFiles/taco.dir/index_notation/index_notation_nodes_abstract.cpp.o" "gcc" "src/CMakeFiles/taco.dir/index_notation/index_notation_nodes_abstract.cpp.o.d"
+  "/root/repo/src/index_notation/index_notation_printer.cpp" "src/CMakeFiles/taco.dir/index_notation/index_notation_printer.cpp.o" "gcc" "src/CMakeFiles/taco.dir/index_notation/index_notation_printer.cpp.o.d"
+  "/root/repo/src/index_notation/index_notation_rewriter.cpp" "src/CMakeFiles/taco.dir/index_notation/index_notation_rewriter.cpp.o" "gcc" "src/CMakeFiles/taco.dir/index_notation/index_notation_rewriter.cpp.o.d"
+  "/root/repo/src/index_notation/index_notation_visitor.cpp" "src/CMakeFiles/taco.dir/index_notation/index_notation_visitor.cpp.o" "gcc" "src/CMakeFiles/taco.dir/index_notation/index_notation_visitor.cpp.o.d"
+  "/root/repo/src/index_notation/intrinsic.cpp" "src/CMakeFiles/taco.dir/index_notation/intrinsic.cpp.o" "gcc" "src/CMakeFiles/taco.dir/index_notation/intrinsic.cpp.o.d"
+  "/root/repo/src/index_notation/kernel.cpp" "src/CMakeFiles/taco.dir/index_notation/kernel.cpp.o" "gcc" "src/CMakeFiles/taco.dir/index_notation/kernel.cpp.o.d"
+  "/root/repo/src/index_notation/provenance_graph.cpp" "src/CMakeFiles/taco.dir/index_notation/provenance_graph.cpp.o" "gcc" "src/CMakeFiles/taco.dir/index_notation/provenance_graph.cpp.o.d"
+  "/root/repo/src/index_notation/schedule.cpp" "src/CMakeFiles/taco.dir/index_notation/schedule.cpp.o" "gcc" "src/CMakeFiles/taco.dir/index_notation/schedule.cpp.o.d"
+  "/root/repo/src/index_notation/transformations.cpp" "src/CMakeFiles/taco.dir/index_notation/transformations.cpp.o" "gcc" "src/CMakeFiles/taco.dir/index_notation/transformations.cpp.o.d"
+  "/root/repo/src/ir/ir.cpp" "src/CMakeFiles/taco.dir/ir/ir.cpp.o" "gcc" "src/CMakeFiles/taco.dir/ir/ir.cpp.o.d"
+  "/root/repo/src/ir/ir_generators.cpp" "src/CMakeFiles/taco.dir/ir/ir_generators.cpp.o" "gcc" "src/CMakeFiles/taco.dir/ir/ir_generators.cpp.o.d"
+  "/root/repo/src/ir/ir_printer.cpp" "src/CMakeFiles/taco.dir/ir/ir_printer.cpp.o" "gcc" "src/CMakeFiles/taco.dir/ir/ir_printer.cpp.o.d"
+  "/root/repo/src/ir/ir_rewriter.cpp" "src/CMakeFiles/taco.dir/ir/ir_rewriter.cpp.o" "gcc" "src/CMakeFiles/taco.dir/ir/ir_rewriter.cpp.o.d"
+  "/root/repo/src/ir/ir_verifier.cpp" "src/CMakeFiles/taco.dir/ir/ir_verifier.cpp.o" "gcc" "src/CMakeFiles/taco.dir/ir/ir_verifier.cpp.o.d"
+  "/root/repo/src/ir/ir_visitor.cpp" "src/CMakeFiles/taco.dir/ir/ir_visitor.cpp.o" "gcc" "src/CMakeFiles/taco.dir/ir/ir_visitor.cpp.o.d"
+  "/root/repo/src/ir/simplify.cpp" "src/CMakeFiles/taco.dir/ir/simplify.cpp.o" "gcc" "src/CMakeFiles/taco.dir/ir/simplify.cpp.o.d"
+  "/root/repo/src/ir_tags.cpp" "src/CMakeFiles/taco.dir/ir_tags.cpp.o" "gcc" "src/CMakeFiles/taco.dir/ir_tags.cpp.o.d"
+  "/root/repo/src/kernel_bundle.cpp" "src/CMakeFiles/taco.dir/kernel_bundle.cpp.o" "gcc" "src/CMakeFiles/taco.dir/kernel_bundle.cpp.o.d"
+  "/root/repo/src/lower/expr_tools.cpp" "src/CMakeFiles/taco.dir/lower/expr_tools.cpp.o" "gcc" "src/CMakeFiles/taco.dir/lower/expr_tools.cpp.o.d"
+  "/root/repo/src/lower/iteration_forest.cpp" "src/CMakeFiles/taco.dir/lower/iteration_forest.cpp.o" "gcc" "src/CMakeFiles/taco.dir/lower/iteration_forest.cpp.o.d"
+  "/root/repo/src/lower/iteration_graph.cpp" "src/CMakeFiles/taco.dir/lower/iteration_graph.cpp.o" "gcc" "src/CMakeFiles/taco.dir/lower/iteration_graph.cpp.o.d"
+  "/root/repo/src/lower/iterator.cpp" "src/CMakeFiles/taco.dir/lower/iterator.cpp.o" "gcc" "src/CMakeFiles/taco.dir/lower/iterator.cpp.o.d"
+  "/root/repo/src/lower/lower.cpp" "src/CMakeFiles/taco.dir/lower/lower.cpp.o" "gcc" "src/CMakeFiles/taco.dir/lower/lower.cpp.o.d"
+  "/root/repo/src/lower/lowerer_impl.cpp" "src/CMakeFiles/taco.dir/lower/lowerer_impl.cpp.o" "gcc" "src/CMakeFiles/taco.dir/lower/lowerer_impl.cpp.o.d"
+  "/root/repo/src/lower/merge_lattice.cpp" "src/CMakeFiles/taco.dir/lower/merge_lattice.cpp.o" "gcc" "src/CMakeFiles/taco.dir/lower/merge_lattice.cpp.o.d"
+  "/root/repo/src/lower/mode.cpp" "src/CMakeFiles/taco.dir/lower/mode.cpp.o" "gcc" "src/CMakeFiles/taco.dir/lower/mode.cpp.o.d"
+  "/root/repo/src/lower/mode_access.cpp" "src/CMakeFiles/taco.dir/lower/mode_access.cpp.o" "gcc" "src/CMakeFiles/taco.dir/lower/mode_access.cpp.o.d"
+  "/root/repo/src/lower/mode_format_bitmap.cpp" "src/CMakeFiles/taco.dir/lower/mode_format_bitmap.cpp.o" "gcc" "src/CMakeFiles/taco.dir/lower/mode_format_bitmap.cpp.o.d"
+  "/root/repo/src/lower/mode_format_compressed.cpp" "src/CMakeFiles/taco.dir/lower/mode_format_compressed.cpp.o" "gcc" "src/CMakeFiles/taco.dir/lower/mode_format_compressed.cpp.o.d"
+  "/root/repo/src/lower/mode_format_dense.cpp" "src/CMakeFiles/taco.dir/lower/mode_format_dense.cpp.o" "gcc" "src/CMakeFiles/taco.dir/lower/mode_format_dense.cpp.o.d"
+  "/root/repo/src/lower/mode_format_hashed.cpp" "src/CMakeFiles/taco.dir/lower/mode_format_hashed.cpp.o" "gcc" "src/CMakeFiles/taco.dir/lower/mode_format_hashed.cpp.o.d"
+  "/root/repo/src/lower/mode_format_impl.cpp" "src/CMakeFiles/taco.dir/lower/mode_format_impl.cpp.o" "gcc" "src/CMakeFiles/taco.dir/lower/mode_format_impl.cpp.o.d"
+  "/root/repo/src/lower/mode_format_singleton.cpp" "src/CMakeFiles/taco.dir/lower/mode_format_singleton.cpp.o" "gcc" "src/CMakeFiles/taco.dir/lower/mode_format_singleton.cpp.o.d"
+  "/root/repo/src/lower/tensor_path.cpp" "src/CMakeFiles/taco.dir/lower/tensor_path.cpp.o" "gcc" "src/CMakeFiles/taco.dir/lower/tensor_path.cpp.o.d"
+  "/root/repo/src/parser/einsum_parser.cpp" "src/CMakeFiles/taco.dir/parser/einsum_parser.cpp.o" "gcc" "src/CMakeFiles/taco.dir/parser/einsum_parser.cpp.o.d"
+  "/root/repo/src/parser/lexer.cpp" "src/CMakeFiles/taco.dir/parser/lexer.cpp.o" "gcc" "src/CMakeFiles/taco.dir/parser/lexer.cpp.o.d"
+  "/root/repo/src/parser/parser.cpp" "src/CMakeFiles/taco.dir/parser/parser.cpp.o" "gcc" "src/CMakeFiles/taco.dir/parser/parser.cpp.o.d"
+  "/root/repo/src/storage/array.cpp" "src/CMakeFiles/taco.dir/storage/array.cpp.o" "gcc" "src/CMakeFiles/taco.dir/storage/array.cpp.o.d"
+  "/root/repo/src/storage/convert.cpp" "src/CMakeFiles/taco.dir/storage/convert.cpp.o" "gcc" "src/CMakeFiles/taco.dir/storage/convert.cpp.o.d"
+  "/root/repo/src/storage/coordinate_parser.cpp" "src/CMakeFiles/taco.dir/storage/coordinate_parser.cpp.o" "gcc" "src/CMakeFiles/taco.dir/storage/coordinate_parser.cpp.o.d"
+  "/root/repo/src/storage/coordinate_sort.cpp" "src/CMakeFiles/taco.dir/storage/coordinate_sort.cpp.o" "gcc" "src/CMakeFiles/taco.dir/storage/coordinate_sort.cpp.o.d"
+  "/root/repo/src/storage/file_io_mtx.cpp" "src/CMakeFiles/taco.dir/storage/file_io_mtx.cpp.o" "gcc" "src/CMakeFiles/taco.dir/storage/file_io_mtx.cpp.o.d"
+  "/root/repo/src/storage/file_io_rb.cpp" "src/CMakeFiles/taco.dir/storage/file_io_rb.cpp.o" "gcc" "src/CMakeFiles/taco.dir/storage/file_io_rb.cpp.o.d"
+  "/root/repo/src/storage/file_io_tns.cpp" "src/CMakeFiles/taco.dir/storage/file_io_tns.cpp.o" "gcc" "src/CMakeFiles/taco.dir/storage/file_io_tns.cpp.o.d"
+  "/root/repo/src/storage/file_io_ttb.cpp" "src/CMakeFiles/taco.dir/storage/file_io_ttb.cpp.o" "gcc" "src/CMakeFiles/taco.dir/storage/file_io_ttb.cpp.o.d"
+  "/root/repo/src/storage/index.cpp" "src/CMakeFiles/taco.dir/storage/index.cpp.o" "gcc" "src/CMakeFiles/taco.dir/storage/index.cpp.o.d"
+  "/root/repo/src/storage/pack.cpp" "src/CMakeFiles/taco.dir/storage/pack.cpp.o" "gcc" "src/CMakeFiles/taco.dir/storage/pack.cpp.o.d"
+  "/root/repo/src/storage/storage.cpp" "src/CMakeFiles/taco.dir/storage/storage.cpp.o" "gcc" "src/CMakeFiles/taco.dir/storage/storage.cpp.o.d"
+  "/root/repo/src/storage/typed_index.cpp" "src/CMakeFiles/taco.dir/storage/typed_index.cpp.o" "gcc" "src/CMakeFiles/taco.dir/storage/typed_index.cpp.o.d"
+  "/root/repo/src/storage/typed_value.cpp" "src/CMakeFiles/taco.dir/storage/typed_value.cpp.o" "gcc" "src/CMakeFiles/taco.dir/storage/typed_value.cpp.o.d"
+  "/root/repo/src/taco_tensor_t.cpp" "src/CMakeFiles/taco.dir/taco_tensor_t.cpp.o" "gcc" "src/CMakeFiles/taco.dir/taco_tensor_t.cpp.o.d"
+  "/root/repo/src/target.cpp" "src/CMakeFiles/taco.dir/target.cpp.o" "gcc" "src/CMakeFiles/taco.dir/target.cpp.o.d"
+  "/root/repo/src/tensor.cpp" "src/CMakeFiles/taco.dir/tensor.cpp.o" "gcc" "src/CMakeFiles/taco.dir/tensor.cpp.o.d"
+  "/root/repo/src/type.cpp" "src/CMakeFiles/taco.dir/type.cpp.o" "gcc" "src/CMakeFiles/taco.dir/type.cpp.o.d"
+  "/root/repo/src/util/env.cpp" "src/CMakeFiles/taco.dir/util/env.cpp.o" "gcc" "src/CMakeFiles/taco.dir/util/env.cpp.o.d"
+  "/root/repo/src/util/files.cpp" "src/CMakeFiles/taco.dir/util/files.cpp.o" "gcc" "src/CMakeFiles/taco.dir/util/files.cpp.o.d"
+  "/root/repo/src/util/name_generator.cpp" "src/CMakeFiles/taco.dir/util/name_generator.cpp.o" "gcc" "src/CMakeFiles/taco.dir/util/name_generator.cpp.o.d"
+  "/root/repo/src/util/strings.cpp" "src/CMakeFiles/taco.dir/util/strings.cpp.o" "gcc" "src/CMakeFiles/taco.dir/util/strings.cpp.o.d"
+  "/root/repo/src/util/thread_pool.cpp" "src/CMakeFiles/taco.dir/util/thread_pool.cpp.o" "gcc" "src/CMakeFiles/taco.dir/util/thread_pool.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/taco"
+  "../bin/taco.pdb"
+  "CMakeFiles/taco-tool.dir/taco.cpp.o"
+  "CMakeFiles/taco-tool.dir/taco.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/taco-tool.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
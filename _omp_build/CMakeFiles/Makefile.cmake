@@ -0,0 +1,113 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/CMakeLists.txt"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "/root/repo/apps/CMakeLists.txt"
+  "/root/repo/apps/tensor_times_vector/CMakeLists.txt"
+  "/root/repo/bench/CMakeLists.txt"
+  "/root/repo/src/CMakeLists.txt"
+  "/root/repo/test/CMakeLists.txt"
+  "/root/repo/test/expr_factory.cpp"
+  "/root/repo/test/expr_factory.h"
+  "/root/repo/test/test.cpp"
+  "/root/repo/test/test.h"
+  "/root/repo/test/test_tensors.cpp"
+  "/root/repo/test/test_tensors.h"
+  "/root/repo/test/tests-api.cpp"
+  "/root/repo/test/tests-autotuner.cpp"
+  "/root/repo/test/tests-copyprop.cpp"
+  "/root/repo/test/tests-error.cpp"
+  "/root/repo/test/tests-expr-reduction.cpp"
+  "/root/repo/test/tests-expr.cpp"
+  "/root/repo/test/tests-expr_storage.cpp"
+  "/root/repo/test/tests-format.cpp"
+  "/root/repo/test/tests-index.cpp"
+  "/root/repo/test/tests-index_notation.cpp"
+  "/root/repo/test/tests-indexexpr.cpp"
+  "/root/repo/test/tests-indexstmt.cpp"
+  "/root/repo/test/tests-io.cpp"
+  "/root/repo/test/tests-kernel_bundle.cpp"
+  "/root/repo/test/tests-llvm.cpp"
+  "/root/repo/test/tests-lower.cpp"
+  "/root/repo/test/tests-merge_lattice.cpp"
+  "/root/repo/test/tests-parafac.cpp"
+  "/root/repo/test/tests-qcd.cpp"
+  "/root/repo/test/tests-regression.cpp"
+  "/root/repo/test/tests-scheduling-eval.cpp"
+  "/root/repo/test/tests-scheduling.cpp"
+  "/root/repo/test/tests-storage.cpp"
+  "/root/repo/test/tests-storage_alloc.cpp"
+  "/root/repo/test/tests-tensor.cpp"
+  "/root/repo/test/tests-tensor_types.cpp"
+  "/root/repo/test/tests-transformation.cpp"
+  "/root/repo/test/tests-transpose.cpp"
+  "/root/repo/test/tests-type.cpp"
+  "/root/repo/tools/CMakeLists.txt"
+  "/usr/lib/x86_64-linux-gnu/cmake/benchmark/benchmarkConfig.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/benchmark/benchmarkConfigVersion.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/benchmark/benchmarkTargets-none.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/benchmark/benchmarkTargets.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeFindDependencyMacro.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFile.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindThreads.cmake"
+  "/usr/share/cmake-3.25/Modules/GoogleTest.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tools/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "apps/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "apps/tensor_times_vector/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bench/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "CMakeFiles/src.dir/DependInfo.cmake"
+  "src/CMakeFiles/taco.dir/DependInfo.cmake"
+  "test/CMakeFiles/taco-gtest.dir/DependInfo.cmake"
+  "test/CMakeFiles/taco-test.dir/DependInfo.cmake"
+  "tools/CMakeFiles/taco-tool.dir/DependInfo.cmake"
+  "apps/tensor_times_vector/CMakeFiles/tensor_times_vector.dir/DependInfo.cmake"
+  "bench/CMakeFiles/taco-bench.dir/DependInfo.cmake"
+  )
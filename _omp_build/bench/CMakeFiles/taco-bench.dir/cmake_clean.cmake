@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../bin/taco-bench"
+  "../bin/taco-bench.pdb"
+  "CMakeFiles/taco-bench.dir/bench.cpp.o"
+  "CMakeFiles/taco-bench.dir/bench.cpp.o.d"
+  "CMakeFiles/taco-bench.dir/kernels.cpp.o"
+  "CMakeFiles/taco-bench.dir/kernels.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/taco-bench.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,151 @@
+file(REMOVE_RECURSE
+  "../lib/libtaco.pdb"
+  "../lib/libtaco.so"
+  "CMakeFiles/taco.dir/autotuner.cpp.o"
+  "CMakeFiles/taco.dir/autotuner.cpp.o.d"
+  "CMakeFiles/taco.dir/codegen/codegen.cpp.o"
+  "CMakeFiles/taco.dir/codegen/codegen.cpp.o.d"
+  "CMakeFiles/taco.dir/codegen/codegen_c.cpp.o"
+  "CMakeFiles/taco.dir/codegen/codegen_c.cpp.o.d"
+  "CMakeFiles/taco.dir/codegen/codegen_cuda.cpp.o"
+  "CMakeFiles/taco.dir/codegen/codegen_cuda.cpp.o.d"
+  "CMakeFiles/taco.dir/codegen/module.cpp.o"
+  "CMakeFiles/taco.dir/codegen/module.cpp.o.d"
+  "CMakeFiles/taco.dir/cuda.cpp.o"
+  "CMakeFiles/taco.dir/cuda.cpp.o.d"
+  "CMakeFiles/taco.dir/error.cpp.o"
+  "CMakeFiles/taco.dir/error.cpp.o.d"
+  "CMakeFiles/taco.dir/error/error_checks.cpp.o"
+  "CMakeFiles/taco.dir/error/error_checks.cpp.o.d"
+  "CMakeFiles/taco.dir/error/error_messages.cpp.o"
+  "CMakeFiles/taco.dir/error/error_messages.cpp.o.d"
+  "CMakeFiles/taco.dir/format.cpp.o"
+  "CMakeFiles/taco.dir/format.cpp.o.d"
+  "CMakeFiles/taco.dir/index_notation/index_notation.cpp.o"
+  "CMakeFiles/taco.dir/index_notation/index_notation.cpp.o.d"
+  "CMakeFiles/taco.dir/index_notation/index_notation_nodes.cpp.o"
+  "CMakeFiles/taco.dir/index_notation/index_notation_nodes.cpp.o.d"
+  "CMakeFiles/taco.dir/index_notation/index_notation_nodes_abstract.cpp.o"
+  "CMakeFiles/taco.dir/index_notation/index_notation_nodes_abstract.cpp.o.d"
+  "CMakeFiles/taco.dir/index_notation/index_notation_printer.cpp.o"
+  "CMakeFiles/taco.dir/index_notation/index_notation_printer.cpp.o.d"
+  "CMakeFiles/taco.dir/index_notation/index_notation_rewriter.cpp.o"
+  "CMakeFiles/taco.dir/index_notation/index_notation_rewriter.cpp.o.d"
+  "CMakeFiles/taco.dir/index_notation/index_notation_visitor.cpp.o"
+  "CMakeFiles/taco.dir/index_notation/index_notation_visitor.cpp.o.d"
+  "CMakeFiles/taco.dir/index_notation/intrinsic.cpp.o"
+  "CMakeFiles/taco.dir/index_notation/intrinsic.cpp.o.d"
+  "CMakeFiles/taco.dir/index_notation/kernel.cpp.o"
+  "CMakeFiles/taco.dir/index_notation/kernel.cpp.o.d"
+  "CMakeFiles/taco.dir/index_notation/provenance_graph.cpp.o"
+  "CMakeFiles/taco.dir/index_notation/provenance_graph.cpp.o.d"
+  "CMakeFiles/taco.dir/index_notation/schedule.cpp.o"
+  "CMakeFiles/taco.dir/index_notation/schedule.cpp.o.d"
+  "CMakeFiles/taco.dir/index_notation/transformations.cpp.o"
+  "CMakeFiles/taco.dir/index_notation/transformations.cpp.o.d"
+  "CMakeFiles/taco.dir/ir/ir.cpp.o"
+  "CMakeFiles/taco.dir/ir/ir.cpp.o.d"
+  "CMakeFiles/taco.dir/ir/ir_generators.cpp.o"
+  "CMakeFiles/taco.dir/ir/ir_generators.cpp.o.d"
+  "CMakeFiles/taco.dir/ir/ir_printer.cpp.o"
+  "CMakeFiles/taco.dir/ir/ir_printer.cpp.o.d"
+  "CMakeFiles/taco.dir/ir/ir_rewriter.cpp.o"
+  "CMakeFiles/taco.dir/ir/ir_rewriter.cpp.o.d"
+  "CMakeFiles/taco.dir/ir/ir_verifier.cpp.o"
+  "CMakeFiles/taco.dir/ir/ir_verifier.cpp.o.d"
+  "CMakeFiles/taco.dir/ir/ir_visitor.cpp.o"
+  "CMakeFiles/taco.dir/ir/ir_visitor.cpp.o.d"
+  "CMakeFiles/taco.dir/ir/simplify.cpp.o"
+  "CMakeFiles/taco.dir/ir/simplify.cpp.o.d"
+  "CMakeFiles/taco.dir/ir_tags.cpp.o"
+  "CMakeFiles/taco.dir/ir_tags.cpp.o.d"
+  "CMakeFiles/taco.dir/kernel_bundle.cpp.o"
+  "CMakeFiles/taco.dir/kernel_bundle.cpp.o.d"
+  "CMakeFiles/taco.dir/lower/expr_tools.cpp.o"
+  "CMakeFiles/taco.dir/lower/expr_tools.cpp.o.d"
+  "CMakeFiles/taco.dir/lower/iteration_forest.cpp.o"
+  "CMakeFiles/taco.dir/lower/iteration_forest.cpp.o.d"
+  "CMakeFiles/taco.dir/lower/iteration_graph.cpp.o"
+  "CMakeFiles/taco.dir/lower/iteration_graph.cpp.o.d"
+  "CMakeFiles/taco.dir/lower/iterator.cpp.o"
+  "CMakeFiles/taco.dir/lower/iterator.cpp.o.d"
+  "CMakeFiles/taco.dir/lower/lower.cpp.o"
+  "CMakeFiles/taco.dir/lower/lower.cpp.o.d"
+  "CMakeFiles/taco.dir/lower/lowerer_impl.cpp.o"
+  "CMakeFiles/taco.dir/lower/lowerer_impl.cpp.o.d"
+  "CMakeFiles/taco.dir/lower/merge_lattice.cpp.o"
+  "CMakeFiles/taco.dir/lower/merge_lattice.cpp.o.d"
+  "CMakeFiles/taco.dir/lower/mode.cpp.o"
+  "CMakeFiles/taco.dir/lower/mode.cpp.o.d"
+  "CMakeFiles/taco.dir/lower/mode_access.cpp.o"
+  "CMakeFiles/taco.dir/lower/mode_access.cpp.o.d"
+  "CMakeFiles/taco.dir/lower/mode_format_bitmap.cpp.o"
+  "CMakeFiles/taco.dir/lower/mode_format_bitmap.cpp.o.d"
+  "CMakeFiles/taco.dir/lower/mode_format_compressed.cpp.o"
+  "CMakeFiles/taco.dir/lower/mode_format_compressed.cpp.o.d"
+  "CMakeFiles/taco.dir/lower/mode_format_dense.cpp.o"
+  "CMakeFiles/taco.dir/lower/mode_format_dense.cpp.o.d"
+  "CMakeFiles/taco.dir/lower/mode_format_hashed.cpp.o"
+  "CMakeFiles/taco.dir/lower/mode_format_hashed.cpp.o.d"
+  "CMakeFiles/taco.dir/lower/mode_format_impl.cpp.o"
+  "CMakeFiles/taco.dir/lower/mode_format_impl.cpp.o.d"
+  "CMakeFiles/taco.dir/lower/mode_format_singleton.cpp.o"
+  "CMakeFiles/taco.dir/lower/mode_format_singleton.cpp.o.d"
+  "CMakeFiles/taco.dir/lower/tensor_path.cpp.o"
+  "CMakeFiles/taco.dir/lower/tensor_path.cpp.o.d"
+  "CMakeFiles/taco.dir/parser/einsum_parser.cpp.o"
+  "CMakeFiles/taco.dir/parser/einsum_parser.cpp.o.d"
+  "CMakeFiles/taco.dir/parser/lexer.cpp.o"
+  "CMakeFiles/taco.dir/parser/lexer.cpp.o.d"
+  "CMakeFiles/taco.dir/parser/parser.cpp.o"
+  "CMakeFiles/taco.dir/parser/parser.cpp.o.d"
+  "CMakeFiles/taco.dir/storage/array.cpp.o"
+  "CMakeFiles/taco.dir/storage/array.cpp.o.d"
+  "CMakeFiles/taco.dir/storage/convert.cpp.o"
+  "CMakeFiles/taco.dir/storage/convert.cpp.o.d"
+  "CMakeFiles/taco.dir/storage/coordinate_parser.cpp.o"
+  "CMakeFiles/taco.dir/storage/coordinate_parser.cpp.o.d"
+  "CMakeFiles/taco.dir/storage/coordinate_sort.cpp.o"
+  "CMakeFiles/taco.dir/storage/coordinate_sort.cpp.o.d"
+  "CMakeFiles/taco.dir/storage/file_io_mtx.cpp.o"
+  "CMakeFiles/taco.dir/storage/file_io_mtx.cpp.o.d"
+  "CMakeFiles/taco.dir/storage/file_io_rb.cpp.o"
+  "CMakeFiles/taco.dir/storage/file_io_rb.cpp.o.d"
+  "CMakeFiles/taco.dir/storage/file_io_tns.cpp.o"
+  "CMakeFiles/taco.dir/storage/file_io_tns.cpp.o.d"
+  "CMakeFiles/taco.dir/storage/file_io_ttb.cpp.o"
+  "CMakeFiles/taco.dir/storage/file_io_ttb.cpp.o.d"
+  "CMakeFiles/taco.dir/storage/index.cpp.o"
+  "CMakeFiles/taco.dir/storage/index.cpp.o.d"
+  "CMakeFiles/taco.dir/storage/pack.cpp.o"
+  "CMakeFiles/taco.dir/storage/pack.cpp.o.d"
+  "CMakeFiles/taco.dir/storage/storage.cpp.o"
+  "CMakeFiles/taco.dir/storage/storage.cpp.o.d"
+  "CMakeFiles/taco.dir/storage/typed_index.cpp.o"
+  "CMakeFiles/taco.dir/storage/typed_index.cpp.o.d"
+  "CMakeFiles/taco.dir/storage/typed_value.cpp.o"
+  "CMakeFiles/taco.dir/storage/typed_value.cpp.o.d"
+  "CMakeFiles/taco.dir/taco_tensor_t.cpp.o"
+  "CMakeFiles/taco.dir/taco_tensor_t.cpp.o.d"
+  "CMakeFiles/taco.dir/target.cpp.o"
+  "CMakeFiles/taco.dir/target.cpp.o.d"
+  "CMakeFiles/taco.dir/tensor.cpp.o"
+  "CMakeFiles/taco.dir/tensor.cpp.o.d"
+  "CMakeFiles/taco.dir/type.cpp.o"
+  "CMakeFiles/taco.dir/type.cpp.o.d"
+  "CMakeFiles/taco.dir/util/env.cpp.o"
+  "CMakeFiles/taco.dir/util/env.cpp.o.d"
+  "CMakeFiles/taco.dir/util/files.cpp.o"
+  "CMakeFiles/taco.dir/util/files.cpp.o.d"
+  "CMakeFiles/taco.dir/util/name_generator.cpp.o"
+  "CMakeFiles/taco.dir/util/name_generator.cpp.o.d"
+  "CMakeFiles/taco.dir/util/strings.cpp.o"
+  "CMakeFiles/taco.dir/util/strings.cpp.o.d"
+  "CMakeFiles/taco.dir/util/thread_pool.cpp.o"
+  "CMakeFiles/taco.dir/util/thread_pool.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/taco.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
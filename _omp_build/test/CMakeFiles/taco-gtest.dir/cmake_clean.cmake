@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../lib/libtaco-gtest.a"
+  "../lib/libtaco-gtest.pdb"
+  "CMakeFiles/taco-gtest.dir/gtest/gtest-all.cc.o"
+  "CMakeFiles/taco-gtest.dir/gtest/gtest-all.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/taco-gtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
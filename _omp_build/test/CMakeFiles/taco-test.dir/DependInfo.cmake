@@ -0,0 +1,52 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/test/expr_factory.cpp" "test/CMakeFiles/taco-test.dir/expr_factory.cpp.o" "gcc" "test/CMakeFiles/taco-test.dir/expr_factory.cpp.o.d"
+  "/root/repo/test/test.cpp" "test/CMakeFiles/taco-test.dir/test.cpp.o" "gcc" "test/CMakeFiles/taco-test.dir/test.cpp.o.d"
+  "/root/repo/test/test_tensors.cpp" "test/CMakeFiles/taco-test.dir/test_tensors.cpp.o" "gcc" "test/CMakeFiles/taco-test.dir/test_tensors.cpp.o.d"
+  "/root/repo/test/tests-api.cpp" "test/CMakeFiles/taco-test.dir/tests-api.cpp.o" "gcc" "test/CMakeFiles/taco-test.dir/tests-api.cpp.o.d"
+  "/root/repo/test/tests-autotuner.cpp" "test/CMakeFiles/taco-test.dir/tests-autotuner.cpp.o" "gcc" "test/CMakeFiles/taco-test.dir/tests-autotuner.cpp.o.d"
+  "/root/repo/test/tests-copyprop.cpp" "test/CMakeFiles/taco-test.dir/tests-copyprop.cpp.o" "gcc" "test/CMakeFiles/taco-test.dir/tests-copyprop.cpp.o.d"
+  "/root/repo/test/tests-error.cpp" "test/CMakeFiles/taco-test.dir/tests-error.cpp.o" "gcc" "test/CMakeFiles/taco-test.dir/tests-error.cpp.o.d"
+  "/root/repo/test/tests-expr-reduction.cpp" "test/CMakeFiles/taco-test.dir/tests-expr-reduction.cpp.o" "gcc" "test/CMakeFiles/taco-test.dir/tests-expr-reduction.cpp.o.d"
+  "/root/repo/test/tests-expr.cpp" "test/CMakeFiles/taco-test.dir/tests-expr.cpp.o" "gcc" "test/CMakeFiles/taco-test.dir/tests-expr.cpp.o.d"
+  "/root/repo/test/tests-expr_storage.cpp" "test/CMakeFiles/taco-test.dir/tests-expr_storage.cpp.o" "gcc" "test/CMakeFiles/taco-test.dir/tests-expr_storage.cpp.o.d"
+  "/root/repo/test/tests-format.cpp" "test/CMakeFiles/taco-test.dir/tests-format.cpp.o" "gcc" "test/CMakeFiles/taco-test.dir/tests-format.cpp.o.d"
+  "/root/repo/test/tests-index.cpp" "test/CMakeFiles/taco-test.dir/tests-index.cpp.o" "gcc" "test/CMakeFiles/taco-test.dir/tests-index.cpp.o.d"
+  "/root/repo/test/tests-index_notation.cpp" "test/CMakeFiles/taco-test.dir/tests-index_notation.cpp.o" "gcc" "test/CMakeFiles/taco-test.dir/tests-index_notation.cpp.o.d"
+  "/root/repo/test/tests-indexexpr.cpp" "test/CMakeFiles/taco-test.dir/tests-indexexpr.cpp.o" "gcc" "test/CMakeFiles/taco-test.dir/tests-indexexpr.cpp.o.d"
+  "/root/repo/test/tests-indexstmt.cpp" "test/CMakeFiles/taco-test.dir/tests-indexstmt.cpp.o" "gcc" "test/CMakeFiles/taco-test.dir/tests-indexstmt.cpp.o.d"
+  "/root/repo/test/tests-io.cpp" "test/CMakeFiles/taco-test.dir/tests-io.cpp.o" "gcc" "test/CMakeFiles/taco-test.dir/tests-io.cpp.o.d"
+  "/root/repo/test/tests-kernel_bundle.cpp" "test/CMakeFiles/taco-test.dir/tests-kernel_bundle.cpp.o" "gcc" "test/CMakeFiles/taco-test.dir/tests-kernel_bundle.cpp.o.d"
+  "/root/repo/test/tests-llvm.cpp" "test/CMakeFiles/taco-test.dir/tests-llvm.cpp.o" "gcc" "test/CMakeFiles/taco-test.dir/tests-llvm.cpp.o.d"
+  "/root/repo/test/tests-lower.cpp" "test/CMakeFiles/taco-test.dir/tests-lower.cpp.o" "gcc" "test/CMakeFiles/taco-test.dir/tests-lower.cpp.o.d"
+  "/root/repo/test/tests-merge_lattice.cpp" "test/CMakeFiles/taco-test.dir/tests-merge_lattice.cpp.o" "gcc" "test/CMakeFiles/taco-test.dir/tests-merge_lattice.cpp.o.d"
+  "/root/repo/test/tests-parafac.cpp" "test/CMakeFiles/taco-test.dir/tests-parafac.cpp.o" "gcc" "test/CMakeFiles/taco-test.dir/tests-parafac.cpp.o.d"
+  "/root/repo/test/tests-qcd.cpp" "test/CMakeFiles/taco-test.dir/tests-qcd.cpp.o" "gcc" "test/CMakeFiles/taco-test.dir/tests-qcd.cpp.o.d"
+  "/root/repo/test/tests-regression.cpp" "test/CMakeFiles/taco-test.dir/tests-regression.cpp.o" "gcc" "test/CMakeFiles/taco-test.dir/tests-regression.cpp.o.d"
+  "/root/repo/test/tests-scheduling-eval.cpp" "test/CMakeFiles/taco-test.dir/tests-scheduling-eval.cpp.o" "gcc" "test/CMakeFiles/taco-test.dir/tests-scheduling-eval.cpp.o.d"
+  "/root/repo/test/tests-scheduling.cpp" "test/CMakeFiles/taco-test.dir/tests-scheduling.cpp.o" "gcc" "test/CMakeFiles/taco-test.dir/tests-scheduling.cpp.o.d"
+  "/root/repo/test/tests-storage.cpp" "test/CMakeFiles/taco-test.dir/tests-storage.cpp.o" "gcc" "test/CMakeFiles/taco-test.dir/tests-storage.cpp.o.d"
+  "/root/repo/test/tests-storage_alloc.cpp" "test/CMakeFiles/taco-test.dir/tests-storage_alloc.cpp.o" "gcc" "test/CMakeFiles/taco-test.dir/tests-storage_alloc.cpp.o.d"
+  "/root/repo/test/tests-tensor.cpp" "test/CMakeFiles/taco-test.dir/tests-tensor.cpp.o" "gcc" "test/CMakeFiles/taco-test.dir/tests-tensor.cpp.o.d"
+  "/root/repo/test/tests-tensor_types.cpp" "test/CMakeFiles/taco-test.dir/tests-tensor_types.cpp.o" "gcc" "test/CMakeFiles/taco-test.dir/tests-tensor_types.cpp.o.d"
+  "/root/repo/test/tests-transformation.cpp" "test/CMakeFiles/taco-test.dir/tests-transformation.cpp.o" "gcc" "test/CMakeFiles/taco-test.dir/tests-transformation.cpp.o.d"
+  "/root/repo/test/tests-transpose.cpp" "test/CMakeFiles/taco-test.dir/tests-transpose.cpp.o" "gcc" "test/CMakeFiles/taco-test.dir/tests-transpose.cpp.o.d"
+  "/root/repo/test/tests-type.cpp" "test/CMakeFiles/taco-test.dir/tests-type.cpp.o" "gcc" "test/CMakeFiles/taco-test.dir/tests-type.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_omp_build/test/CMakeFiles/taco-gtest.dir/DependInfo.cmake"
+  "/root/repo/_omp_build/src/CMakeFiles/taco.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,73 @@
+file(REMOVE_RECURSE
+  "../bin/taco-test"
+  "../bin/taco-test.pdb"
+  "CMakeFiles/taco-test.dir/expr_factory.cpp.o"
+  "CMakeFiles/taco-test.dir/expr_factory.cpp.o.d"
+  "CMakeFiles/taco-test.dir/test.cpp.o"
+  "CMakeFiles/taco-test.dir/test.cpp.o.d"
+  "CMakeFiles/taco-test.dir/test_tensors.cpp.o"
+  "CMakeFiles/taco-test.dir/test_tensors.cpp.o.d"
+  "CMakeFiles/taco-test.dir/tests-api.cpp.o"
+  "CMakeFiles/taco-test.dir/tests-api.cpp.o.d"
+  "CMakeFiles/taco-test.dir/tests-autotuner.cpp.o"
+  "CMakeFiles/taco-test.dir/tests-autotuner.cpp.o.d"
+  "CMakeFiles/taco-test.dir/tests-copyprop.cpp.o"
+  "CMakeFiles/taco-test.dir/tests-copyprop.cpp.o.d"
+  "CMakeFiles/taco-test.dir/tests-error.cpp.o"
+  "CMakeFiles/taco-test.dir/tests-error.cpp.o.d"
+  "CMakeFiles/taco-test.dir/tests-expr-reduction.cpp.o"
+  "CMakeFiles/taco-test.dir/tests-expr-reduction.cpp.o.d"
+  "CMakeFiles/taco-test.dir/tests-expr.cpp.o"
+  "CMakeFiles/taco-test.dir/tests-expr.cpp.o.d"
+  "CMakeFiles/taco-test.dir/tests-expr_storage.cpp.o"
+  "CMakeFiles/taco-test.dir/tests-expr_storage.cpp.o.d"
+  "CMakeFiles/taco-test.dir/tests-format.cpp.o"
+  "CMakeFiles/taco-test.dir/tests-format.cpp.o.d"
+  "CMakeFiles/taco-test.dir/tests-index.cpp.o"
+  "CMakeFiles/taco-test.dir/tests-index.cpp.o.d"
+  "CMakeFiles/taco-test.dir/tests-index_notation.cpp.o"
+  "CMakeFiles/taco-test.dir/tests-index_notation.cpp.o.d"
+  "CMakeFiles/taco-test.dir/tests-indexexpr.cpp.o"
+  "CMakeFiles/taco-test.dir/tests-indexexpr.cpp.o.d"
+  "CMakeFiles/taco-test.dir/tests-indexstmt.cpp.o"
+  "CMakeFiles/taco-test.dir/tests-indexstmt.cpp.o.d"
+  "CMakeFiles/taco-test.dir/tests-io.cpp.o"
+  "CMakeFiles/taco-test.dir/tests-io.cpp.o.d"
+  "CMakeFiles/taco-test.dir/tests-kernel_bundle.cpp.o"
+  "CMakeFiles/taco-test.dir/tests-kernel_bundle.cpp.o.d"
+  "CMakeFiles/taco-test.dir/tests-llvm.cpp.o"
+  "CMakeFiles/taco-test.dir/tests-llvm.cpp.o.d"
+  "CMakeFiles/taco-test.dir/tests-lower.cpp.o"
+  "CMakeFiles/taco-test.dir/tests-lower.cpp.o.d"
+  "CMakeFiles/taco-test.dir/tests-merge_lattice.cpp.o"
+  "CMakeFiles/taco-test.dir/tests-merge_lattice.cpp.o.d"
+  "CMakeFiles/taco-test.dir/tests-parafac.cpp.o"
+  "CMakeFiles/taco-test.dir/tests-parafac.cpp.o.d"
+  "CMakeFiles/taco-test.dir/tests-qcd.cpp.o"
+  "CMakeFiles/taco-test.dir/tests-qcd.cpp.o.d"
+  "CMakeFiles/taco-test.dir/tests-regression.cpp.o"
+  "CMakeFiles/taco-test.dir/tests-regression.cpp.o.d"
+  "CMakeFiles/taco-test.dir/tests-scheduling-eval.cpp.o"
+  "CMakeFiles/taco-test.dir/tests-scheduling-eval.cpp.o.d"
+  "CMakeFiles/taco-test.dir/tests-scheduling.cpp.o"
+  "CMakeFiles/taco-test.dir/tests-scheduling.cpp.o.d"
+  "CMakeFiles/taco-test.dir/tests-storage.cpp.o"
+  "CMakeFiles/taco-test.dir/tests-storage.cpp.o.d"
+  "CMakeFiles/taco-test.dir/tests-storage_alloc.cpp.o"
+  "CMakeFiles/taco-test.dir/tests-storage_alloc.cpp.o.d"
+  "CMakeFiles/taco-test.dir/tests-tensor.cpp.o"
+  "CMakeFiles/taco-test.dir/tests-tensor.cpp.o.d"
+  "CMakeFiles/taco-test.dir/tests-tensor_types.cpp.o"
+  "CMakeFiles/taco-test.dir/tests-tensor_types.cpp.o.d"
+  "CMakeFiles/taco-test.dir/tests-transformation.cpp.o"
+  "CMakeFiles/taco-test.dir/tests-transformation.cpp.o.d"
+  "CMakeFiles/taco-test.dir/tests-transpose.cpp.o"
+  "CMakeFiles/taco-test.dir/tests-transpose.cpp.o.d"
+  "CMakeFiles/taco-test.dir/tests-type.cpp.o"
+  "CMakeFiles/taco-test.dir/tests-type.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/taco-test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,251 @@
+#include "bench.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <exception>
+#include <map>
+#include <memory>
+
+#include <benchmark/benchmark.h>
+
+#include "taco/util/collections.h"
+#include "taco/util/env.h"
+#include "taco/util/strings.h"
+
+using namespace std;
+
+namespace taco {
+namespace bench {
+
+typedef std::chrono::steady_clock Clock;
+
+static const char* getPhaseName(Phase phase) {
+  switch (phase) {
+    case Phase::Pack:
+      return "pack";
+    case Phase::Compile:
+      return "compile";
+    case Phase::Assemble:
+      return "assemble";
+    case Phase::Compute:
+      return "compute";
+  }
+  taco_ierror;
+  return "";
+}
+
+static double getSecondsSince(Clock::time_point begin) {
+  return std::chrono::duration<double>(Clock::now() - begin).count();
+}
+
+/// The components of a tensor, which are inserted into a fresh tensor before
+/// every pack.
+struct Components {
+  vector<vector<int>> coordinates;
+  vector<double> values;
+};
+
+/// Reads the components of the tensor once, since iterating over a tensor
+/// does not release all the buffers that its iteration helper allocates.
+static Components getComponents(const TensorBase& tensor) {
+  Components components;
+  for (auto& component : iterate<double>(tensor)) {
+    components.coordinates.push_back(component.first.toVector());
+    components.values.push_back(component.second);
+  }
+  return components;
+}
+
+/// Returns a tensor like the given one, with the components inserted but not
+/// packed.
+static TensorBase getUnpackedCopy(const TensorBase& tensor,
+                                  const Components& components) {
+  TensorBase copy(tensor.getName(), tensor.getComponentType(),
+                  tensor.getDimensions(), tensor.getFormat());
+  for (size_t i = 0; i < components.values.size(); i++) {
+    copy.insert(components.coordinates[i], components.values[i]);
+  }
+  return copy;
+}
+
+/// Disables the kernel cache while in scope, so that every compile lowers
+/// and compiles the kernel rather than reusing one from an earlier iteration.
+class DisableKernelCache {
+public:
+  DisableKernelCache() {
+    const char* value = getenv("CACHE_KERNELS");
+    if (value) {
+      previous.reset(new string(value));
+    }
+    setenv("CACHE_KERNELS", "0", 1);
+  }
+
+  ~DisableKernelCache() {
+    if (previous) {
+      setenv("CACHE_KERNELS", previous->c_str(), 1);
+    } else {
+      unsetenv("CACHE_KERNELS");
+    }
+  }
+
+private:
+  unique_ptr<string> previous;
+};
+
+static void runPhase(benchmark::State& state, const KernelBench& kernel,
+                     const vector<TensorBase>& operands, Phase phase) {
+  vector<Components> components;
+  if (phase == Phase::Pack) {
+    for (auto& operand : operands) {
+      components.push_back(getComponents(operand));
+    }
+  }
+
+  for (auto _ : state) {
+    double seconds = 0.0;
+    switch (phase) {
+      case Phase::Pack: {
+        vector<TensorBase> copies;
+        for (size_t i = 0; i < operands.size(); i++) {
+          copies.push_back(getUnpackedCopy(operands[i], components[i]));
+        }
+        auto begin = Clock::now();
+        for (auto& copy : copies) {
+          copy.pack();
+        }
+        seconds = getSecondsSince(begin);
+        break;
+      }
+      case Phase::Compile: {
+        TensorBase result = kernel.makeResult(operands);
+        DisableKernelCache disableKernelCache;
+        auto begin = Clock::now();
+        result.compile();
+        seconds = getSecondsSince(begin);
+        break;
+      }
+      case Phase::Assemble: {
+        TensorBase result = kernel.makeResult(operands);
+        result.compile();
+        auto begin = Clock::now();
+        result.assemble();
+        seconds = getSecondsSince(begin);
+        break;
+      }
+      case Phase::Compute: {
+        TensorBase result = kernel.makeResult(operands);
+        result.compile();
+        result.assemble();
+        auto begin = Clock::now();
+        result.compute();
+        seconds = getSecondsSince(begin);
+        break;
+      }
+    }
+    state.SetIterationTime(seconds);
+  }
+
+  // The first operand of every kernel is its sparse input
+  state.counters["nnz"] = (double)operands[0].getStorage().getValues().getSize();
+}
+
+void registerKernel(const KernelBench& kernel) {
+  // Operands are created on first use and shared by the phases, so that
+  // filtered out benchmarks do not generate or read their inputs
+  auto operands = make_shared<vector<TensorBase>>();
+  for (Phase phase : {Phase::Pack, Phase::Compile, Phase::Assemble,
+                      Phase::Compute}) {
+    const string name = kernel.name + "/" + getPhaseName(phase);
+    benchmark::RegisterBenchmark(name.c_str(),
+        [kernel, operands, phase](benchmark::State& state) {
+          try {
+            if (operands->empty()) {
+              *operands = kernel.makeOperands();
+            }
+            runPhase(state, kernel, *operands, phase);
+          } catch (const std::exception& e) {
+            state.SkipWithError(e.what());
+          }
+        })->UseManualTime()->Unit(benchmark::kMillisecond);
+  }
+}
+
+/// Returns a source that reads the tensor in the file once per format.
+static TensorSource getFileSource(string filename) {
+  auto tensors = make_shared<map<string,TensorBase>>();
+  return [filename, tensors](const Format& format) {
+    const string key = util::toString(format);
+    if (!tensors->count(key)) {
+      // Rename the tensor, since names derived from file names may collide
+      // with the names of other operands
+      TensorBase tensor = read(filename, format);
+      tensor.setName("S");
+      tensors->insert({key, tensor});
+    }
+    return tensors->at(key);
+  };
+}
+
+/// Returns the file name without directories and extension.
+static string getInputName(string filename) {
+  const size_t begin = filename.find_last_of('/');
+  if (begin != string::npos) {
+    filename = filename.substr(begin + 1);
+  }
+  return filename.substr(0, filename.find_last_of('.'));
+}
+
+static vector<string> getInputFiles(string flag) {
+  vector<string> filenames;
+  for (auto& filename : util::split(util::getFromEnv(flag, ""), ":")) {
+    if (!filename.empty()) {
+      filenames.push_back(filename);
+    }
+  }
+  return filenames;
+}
+
+}}
+
+using namespace taco;
+using namespace taco::bench;
+
+int main(int argc, char* argv[]) {
+  benchmark::Initialize(&argc, argv);
+  if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+    return 1;
+  }
+
+  const int matrixSize =
+      stoi(util::getFromEnv("TACO_BENCH_MATRIX_SIZE", "2000"));
+  const double matrixDensity =
+      stod(util::getFromEnv("TACO_BENCH_MATRIX_DENSITY", "0.005"));
+  const int tensorSize =
+      stoi(util::getFromEnv("TACO_BENCH_TENSOR_SIZE", "128"));
+  const double tensorDensity =
+      stod(util::getFromEnv("TACO_BENCH_TENSOR_DENSITY", "0.005"));
+
+  vector<KernelBench> kernels;
+  util::append(kernels, matrixKernels("synthetic",
+      syntheticMatrix(matrixSize, matrixDensity)));
+  util::append(kernels, tensorKernels("synthetic",
+      syntheticTensor(tensorSize, tensorDensity)));
+
+  // Matrices (e.g. from SuiteSparse) and order-3 tensors (e.g. from FROSTT)
+  // are given as colon-separated lists of files
+  for (auto& filename : getInputFiles("TACO_BENCH_MATRICES")) {
+    util::append(kernels, matrixKernels(getInputName(filename),
+                                        getFileSource(filename)));
+  }
+  for (auto& filename : getInputFiles("TACO_BENCH_TENSORS")) {
+    util::append(kernels, tensorKernels(getInputName(filename),
+                                        getFileSource(filename)));
+  }
+
+  for (auto& kernel : kernels) {
+    registerKernel(kernel);
+  }
+  benchmark::RunSpecifiedBenchmarks();
+  benchmark::Shutdown();
+  return 0;
+}
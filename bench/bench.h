@@ -0,0 +1,58 @@
+#ifndef TACO_BENCH_H
+#define TACO_BENCH_H
+
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "taco/tensor.h"
+#include "taco/format.h"
+
+namespace taco {
+namespace bench {
+
+/// The phases of evaluating a kernel, which are benchmarked separately.
+enum class Phase {
+  Pack,
+  Compile,
+  Assemble,
+  Compute
+};
+
+/// A kernel to benchmark.
+struct KernelBench {
+  /// Name of the benchmark, e.g. "spmv/csr/synthetic".
+  std::string name;
+
+  /// Create the packed operands of the kernel.
+  std::function<std::vector<TensorBase>()> makeOperands;
+
+  /// Declare the result of the kernel and assign the kernel's expression,
+  /// which reads the given operands, to it.
+  std::function<TensorBase(const std::vector<TensorBase>&)> makeResult;
+};
+
+/// Returns an operand stored in the given format.  Sources are either
+/// synthetic generators or tensors read from files.
+typedef std::function<TensorBase(const Format&)> TensorSource;
+
+/// Returns the SpMV, SpMM, SDDMM, SpAdd and SpGEMM benchmarks of a matrix.
+std::vector<KernelBench> matrixKernels(std::string inputName,
+                                       TensorSource matrix);
+
+/// Returns the TTV, TTM and MTTKRP benchmarks of an order-3 tensor.
+std::vector<KernelBench> tensorKernels(std::string inputName,
+                                       TensorSource tensor);
+
+/// Returns a source of random size x size matrices with the given density.
+TensorSource syntheticMatrix(int size, double density);
+
+/// Returns a source of random size x size x size tensors with the given
+/// density.
+TensorSource syntheticTensor(int size, double density);
+
+/// Register one benchmark of the kernel for every phase.
+void registerKernel(const KernelBench& kernel);
+
+}}
+#endif
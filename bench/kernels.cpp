@@ -0,0 +1,245 @@
+#include "bench.h"
+
+#include <map>
+#include <memory>
+
+#include "taco/util/fill.h"
+#include "taco/util/strings.h"
+
+using namespace std;
+
+namespace taco {
+namespace bench {
+
+/// Columns of the dense factor matrices of SpMM, SDDMM, TTM and MTTKRP.
+static const int factorRank = 32;
+
+static const IndexVar i("i"), j("j"), k("k"), l("l");
+
+static const vector<pair<string,Format>> matrixFormats = {
+  {"csr",  CSR},
+  {"dcsr", DCSR},
+  {"csc",  CSC}
+};
+
+static const vector<pair<string,Format>> tensorFormats = {
+  {"csf", Format({Sparse, Sparse, Sparse})},
+  {"dss", Format({Dense, Sparse, Sparse})}
+};
+
+static TensorBase getDense(string name, vector<int> dimensions) {
+  TensorBase tensor(name, Float64, dimensions,
+                    Format(vector<ModeFormatPack>(dimensions.size(), Dense)));
+  util::fillTensor(tensor, util::FillMethod::Dense);
+  return tensor;
+}
+
+/// Returns a packed copy of the tensor in another format, where the modes of
+/// the copy are the modes of the tensor permuted by modeOrdering.
+static TensorBase getCopy(string name, const TensorBase& tensor,
+                          const Format& format, vector<int> modeOrdering) {
+  vector<int> dimensions;
+  for (int mode : modeOrdering) {
+    dimensions.push_back(tensor.getDimension(mode));
+  }
+  TensorBase copy(name, tensor.getComponentType(), dimensions, format);
+  for (auto& component : iterate<double>(tensor)) {
+    vector<int> coordinate;
+    for (int mode : modeOrdering) {
+      coordinate.push_back(component.first[mode]);
+    }
+    copy.insert(coordinate, component.second);
+  }
+  copy.pack();
+  return copy;
+}
+
+/// Returns a source of one random tensor, which is converted to each
+/// requested format so that all formats benchmark the same components.
+static TensorSource getSyntheticSource(vector<int> dimensions,
+                                       double density) {
+  auto tensors = make_shared<map<string,TensorBase>>();
+  return [dimensions, density, tensors](const Format& format) {
+    if (tensors->empty()) {
+      TensorBase tensor("S", Float64, dimensions,
+                        Format(vector<ModeFormatPack>(dimensions.size(),
+                                                      Sparse)));
+      util::fillTensor(tensor, util::FillMethod::Random, density);
+      tensors->insert({"", tensor});
+    }
+    const string key = util::toString(format);
+    if (!tensors->count(key)) {
+      vector<int> modeOrdering;
+      for (size_t mode = 0; mode < dimensions.size(); mode++) {
+        modeOrdering.push_back((int)mode);
+      }
+      TensorBase copy = getCopy("S", tensors->at(""), format, modeOrdering);
+      tensors->insert({key, copy});
+    }
+    return tensors->at(key);
+  };
+}
+
+TensorSource syntheticMatrix(int size, double density) {
+  return getSyntheticSource({size, size}, density);
+}
+
+TensorSource syntheticTensor(int size, double density) {
+  return getSyntheticSource({size, size, size}, density);
+}
+
+vector<KernelBench> matrixKernels(string inputName, TensorSource matrix) {
+  vector<KernelBench> kernels;
+  for (auto& format : matrixFormats) {
+    const Format matrixFormat = format.second;
+    const string suffix = "/" + format.first + "/" + inputName;
+
+    // y = Ax
+    kernels.push_back({"spmv" + suffix,
+      [=]() -> vector<TensorBase> {
+        TensorBase A = matrix(matrixFormat);
+        return {A, getDense("x", {A.getDimension(1)})};
+      },
+      [](const vector<TensorBase>& operands) {
+        const TensorBase& A = operands[0];
+        const TensorBase& x = operands[1];
+        TensorBase y("y", Float64, {A.getDimension(0)}, Format({Dense}));
+        y(i) = A(i,j) * x(j);
+        return y;
+      }
+    });
+
+    // C = AB, where B is dense
+    kernels.push_back({"spmm" + suffix,
+      [=]() -> vector<TensorBase> {
+        TensorBase A = matrix(matrixFormat);
+        return {A, getDense("B", {A.getDimension(1), factorRank})};
+      },
+      [](const vector<TensorBase>& operands) {
+        const TensorBase& A = operands[0];
+        const TensorBase& B = operands[1];
+        TensorBase C("C", Float64, {A.getDimension(0), factorRank},
+                     Format({Dense, Dense}));
+        C(i,j) = A(i,k) * B(k,j);
+        return C;
+      }
+    });
+
+    // The remaining kernels iterate over the sparse operands in row order
+    if (matrixFormat.getModeOrdering()[0] != 0) {
+      continue;
+    }
+
+    // A = B o CD, where C and D are dense
+    kernels.push_back({"sddmm" + suffix,
+      [=]() -> vector<TensorBase> {
+        TensorBase B = matrix(matrixFormat);
+        return {B, getDense("C", {B.getDimension(0), factorRank}),
+                getDense("D", {factorRank, B.getDimension(1)})};
+      },
+      [=](const vector<TensorBase>& operands) {
+        const TensorBase& B = operands[0];
+        const TensorBase& C = operands[1];
+        const TensorBase& D = operands[2];
+        TensorBase A("A", Float64, B.getDimensions(), CSR);
+        A(i,j) = B(i,j) * C(i,k) * D(k,j);
+        return A;
+      }
+    });
+
+    // A = B + B^T
+    kernels.push_back({"spadd" + suffix,
+      [=]() -> vector<TensorBase> {
+        TensorBase B = matrix(matrixFormat);
+        return {B, getCopy("T", B, matrixFormat, {1, 0})};
+      },
+      [=](const vector<TensorBase>& operands) {
+        const TensorBase& B = operands[0];
+        const TensorBase& C = operands[1];
+        TensorBase A("A", Float64, B.getDimensions(), matrixFormat);
+        A(i,j) = B(i,j) + C(i,j);
+        return A;
+      }
+    });
+  }
+
+  // A = BC, where C is a copy of B and the rows of A are computed in a dense
+  // workspace
+  kernels.push_back({"spgemm/csr/" + inputName,
+    [=]() -> vector<TensorBase> {
+      TensorBase B = matrix(CSR);
+      return {B, getCopy("C", B, CSR, {0, 1})};
+    },
+    [](const vector<TensorBase>& operands) {
+      const TensorBase& B = operands[0];
+      const TensorBase& C = operands[1];
+      TensorBase A("A", Float64, {B.getDimension(0), C.getDimension(1)}, CSR);
+      A(i,j) = B(i,k) * C(k,j);
+      return A;
+    }
+  });
+  return kernels;
+}
+
+vector<KernelBench> tensorKernels(string inputName, TensorSource tensor) {
+  vector<KernelBench> kernels;
+  for (auto& format : tensorFormats) {
+    const Format tensorFormat = format.second;
+    const vector<ModeFormatPack> modeFormats = tensorFormat.getModeFormatPacks();
+    const string suffix = "/" + format.first + "/" + inputName;
+
+    // A = B x_3 c
+    kernels.push_back({"ttv" + suffix,
+      [=]() -> vector<TensorBase> {
+        TensorBase B = tensor(tensorFormat);
+        return {B, getDense("c", {B.getDimension(2)})};
+      },
+      [=](const vector<TensorBase>& operands) {
+        const TensorBase& B = operands[0];
+        const TensorBase& c = operands[1];
+        TensorBase A("A", Float64, {B.getDimension(0), B.getDimension(1)},
+                     Format({modeFormats[0], modeFormats[1]}));
+        A(i,j) = B(i,j,k) * c(k);
+        return A;
+      }
+    });
+
+    // A = B x_3 C, where C is dense
+    kernels.push_back({"ttm" + suffix,
+      [=]() -> vector<TensorBase> {
+        TensorBase B = tensor(tensorFormat);
+        return {B, getDense("C", {factorRank, B.getDimension(2)})};
+      },
+      [=](const vector<TensorBase>& operands) {
+        const TensorBase& B = operands[0];
+        const TensorBase& C = operands[1];
+        TensorBase A("A", Float64,
+                     {B.getDimension(0), B.getDimension(1), factorRank},
+                     Format({modeFormats[0], modeFormats[1], Dense}));
+        A(i,j,k) = B(i,j,l) * C(k,l);
+        return A;
+      }
+    });
+
+    // A = B_(1) (D kr C), where C and D are dense
+    kernels.push_back({"mttkrp" + suffix,
+      [=]() -> vector<TensorBase> {
+        TensorBase B = tensor(tensorFormat);
+        return {B, getDense("C", {B.getDimension(1), factorRank}),
+                getDense("D", {B.getDimension(2), factorRank})};
+      },
+      [](const vector<TensorBase>& operands) {
+        const TensorBase& B = operands[0];
+        const TensorBase& C = operands[1];
+        const TensorBase& D = operands[2];
+        TensorBase A("A", Float64, {B.getDimension(0), factorRank},
+                     Format({Dense, Dense}));
+        A(i,j) = B(i,k,l) * C(k,j) * D(l,j);
+        return A;
+      }
+    });
+  }
+  return kernels;
+}
+
+}}
@@ -0,0 +1,103 @@
+#ifndef TACO_AUTOTUNER_H
+#define TACO_AUTOTUNER_H
+
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "taco/tensor.h"
+#include "taco/ir_tags.h"
+#include "taco/index_notation/index_notation.h"
+
+namespace taco {
+
+/// A CPU schedule of a concrete index statement, described by parameters
+/// rather than by index variables so that it can be applied to any statement
+/// with the same loop structure and persisted between runs.
+struct TuningSchedule {
+  /// Permutation of the outermost directly nested loops of the statement, or
+  /// empty to keep their order.
+  std::vector<int> loopOrder;
+
+  /// Split the outermost loop into chunks of this many iterations, and
+  /// parallelize over the chunks, or 0 to not split it.
+  int chunkSize = 0;
+
+  /// Parallelize the outermost loop (or its chunks) over CPU threads.
+  bool parallel = false;
+
+  /// How parallel writes to the result are handled.
+  OutputRaceStrategy outputRaceStrategy = OutputRaceStrategy::NoRaces;
+
+  /// Split the innermost loop of the outer nest into blocks of this many
+  /// iterations and unroll the blocks, or 0 to not unroll it.
+  int unrollFactor = 0;
+};
+
+bool operator==(const TuningSchedule&, const TuningSchedule&);
+bool operator!=(const TuningSchedule&, const TuningSchedule&);
+
+/// Print a schedule, in the form that `parseTuningSchedule` reads.
+std::ostream& operator<<(std::ostream&, const TuningSchedule&);
+
+/// Parse a schedule printed by `operator<<`.
+TuningSchedule parseTuningSchedule(std::string str);
+
+/// Apply the schedule to a concrete index statement. Returns an undefined
+/// statement and a reason if a transformation of the schedule is illegal.
+IndexStmt applySchedule(IndexStmt stmt, const TuningSchedule& schedule,
+                        std::string* reason=nullptr);
+
+/// Options of `autotune`.
+struct AutotuneOptions {
+  /// Seconds to spend compiling and timing schedules. The default schedule is
+  /// always timed, and the search stops at the first batch of schedules that
+  /// starts after the budget is spent.
+  double timeBudget = 10.0;
+
+  /// Times each schedule is run. A schedule's time is its fastest run.
+  int repetitions = 3;
+
+  /// Chunk sizes of the parallelized outer loop to try.
+  std::vector<int> chunkSizes = {8, 16, 32, 64};
+
+  /// Unroll factors of the innermost loop to try.
+  std::vector<int> unrollFactors = {4, 8};
+
+  /// Path of the file that stores the best schedules. Defaults to the
+  /// environment variable TACO_AUTOTUNE_DB, and schedules are not stored if
+  /// neither is set.
+  std::string databasePath;
+};
+
+/// Search for the fastest schedule of the tensor's expression and compile the
+/// tensor with it. The candidate schedules reorder, split, parallelize and
+/// unroll the statement that `tensor.compile()` would compile before it is
+/// parallelized; schedules that the transformations reject or that fail to
+/// compile are skipped. Candidates are compiled concurrently in batches and
+/// timed on the tensor's operands, which must be packed or computable.
+///
+/// The best schedule is stored per expression, formats and shape class (the
+/// order of magnitude of the operands' dimensions and nonzeros), and later
+/// calls for the same key apply the stored schedule without searching.
+/// Returns the compiled statement.
+///
+/// ```
+/// A(i,j) = B(i,k) * C(k,j);
+/// AutotuneOptions options;
+/// options.timeBudget = 2.0;
+/// autotune(A, options);
+/// A.assemble();
+/// A.compute();
+/// ```
+IndexStmt autotune(TensorBase& tensor,
+                   const AutotuneOptions& options=AutotuneOptions());
+
+/// Search for the fastest schedule of a concrete index statement that
+/// computes the tensor's expression, such as one that has already been
+/// partially scheduled by hand.
+IndexStmt autotune(TensorBase& tensor, IndexStmt stmt,
+                   const AutotuneOptions& options=AutotuneOptions());
+
+}
+#endif
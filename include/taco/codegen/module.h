@@ -1,7 +1,9 @@
 #ifndef TACO_MODULE_H
 #define TACO_MODULE_H
 
+#include <future>
 #include <map>
+#include <memory>
 #include <vector>
 #include <string>
 #include <utility>
@@ -12,6 +14,8 @@
 namespace taco {
 namespace ir {
 
+class JITModule;
+
 class Module {
 public:
   /// Create a module for some target
@@ -21,24 +25,74 @@ public:
     setJITTmpdir();
   }
 
+  /// Waits for a pending background compilation to finish.
+  ~Module();
+
   void reset();
 
-  /// Compile the source into a library, returning its full path
-  std::string compile();
+  /// Compile the source into a library, returning its full path. If the
+  /// on-disk kernel cache is enabled and a non-empty key is given, then the
+  /// library is also stored in the cache under that key.
+  ///
+  /// If the module targets a machine architecture (e.g. Target::X86) and taco
+  /// was built with LLVM, then the functions are instead compiled in process
+  /// by an LLVM JIT, and an empty path is returned. Functions the JIT does not
+  /// support (e.g. parallel loops) fall back to the system compiler.
+  std::string compile(std::string diskCacheKey="");
+
+  /// Compile the module like compile, but run the system compiler on a
+  /// bounded pool of background threads instead of blocking the caller. The
+  /// source is generated before this function returns. The returned future
+  /// becomes ready when the library is loaded, and holds any compilation error.
+  /// Functions that need the library (e.g. getFuncPtr) wait for it. The number
+  /// of background threads is set by the environment variable
+  /// TACO_COMPILE_THREADS and defaults to the number of hardware threads.
+  std::shared_future<void> compileAsync(std::string diskCacheKey="");
+
+  /// Get a future that becomes ready when the last compilation of the module
+  /// has finished.
+  std::shared_future<void> getCompileFuture() const;
+
+  /// Load a library that was previously compiled for the given key from the
+  /// on-disk kernel cache. Returns false if the cache is disabled or holds no
+  /// library for the key. The cache is enabled by setting the environment
+  /// variable TACO_KERNEL_CACHE_DIR to a writable directory, and keys are
+  /// combined with the compiler, compiler version and compiler flags. Modules
+  /// compiled in process by the JIT are not stored in the cache.
+  bool loadFromDiskCache(std::string diskCacheKey);
   
   /// Compile the module into a source file located at the specified location
   /// path and prefix.  The generated source will be path/prefix.{.c|.bc, .h}
   void compileToSource(std::string path, std::string prefix);
   
   /// Compile the module into a static library located at the specified location
-  /// path and prefix.  The generated library will be path/prefix.a
+  /// path and prefix.  The generated library will be path/prefix.a, and its
+  /// source and header are kept at path/prefix.{c,h}.
   void compileToStaticLibrary(std::string path, std::string prefix);
+
+  /// Compile the module into a shared library located at the specified location
+  /// path and prefix.  The generated library will be path/prefix.so, and its
+  /// source and header are kept at path/prefix.{c,h}.
+  void compileToSharedLibrary(std::string path, std::string prefix);
   
   /// Add a lowered function to this module */
   void addFunction(Stmt func);
 
+  /// Add C source that is compiled with the module's functions and shims, and
+  /// declarations that are added to the module's header. This is used to emit
+  /// tables that refer to the functions, such as kernel bundle registries.
+  void addSource(std::string source, std::string header="");
+
+  /// Use functions that were compiled ahead of time, mapped from their names
+  /// (e.g. "_shim_compute") to function pointers, instead of compiling the
+  /// module.
+  void setPrecompiledFunctions(std::map<std::string,void*> funcPtrs);
+
   /// Get the source of the module as a string */
   std::string getSource();
+
+  /// Get the target the module is compiled for
+  Target getTarget() const;
   
   /// Get a function pointer to a compiled function. This returns a void*
   /// pointer, which the caller is required to cast to the correct function type
@@ -48,6 +102,10 @@ public:
 
   /// Call a raw function in this module and return the result
   int callFuncPackedRaw(std::string name, void** args);
+
+  /// Call a raw function through a pointer returned by getFuncPtr and return
+  /// the result. This avoids looking up the function on every call.
+  static int callFuncPtrPackedRaw(void* funcPtr, void** args);
   
   /// Call a raw function in this module and return the result
   int callFuncPackedRaw(std::string name, std::vector<void*> args) {
@@ -73,7 +131,12 @@ private:
   std::string libname;
   std::string tmpdir;
   void* lib_handle;
+  std::shared_ptr<JITModule> jit;
+  std::shared_future<void> compiled;
   std::vector<Stmt> funcs;
+  std::stringstream extraSource;
+  std::stringstream extraHeader;
+  std::map<std::string,void*> precompiledFuncs;
   
   // true iff the module was created from user-provided source
   bool moduleFromUserSource;
@@ -82,6 +145,13 @@ private:
   
   void setJITLibname();
   void setJITTmpdir();
+
+  std::string getCompiler();
+  std::string getCompilerFlags(bool shared=true);
+  std::string getDiskCachePath(std::string diskCacheKey);
+  void writeLibrarySource(std::string path, std::string prefix);
+  void loadLibrary(std::string path);
+  void waitForCompile();
 };
 
 } // namespace ir
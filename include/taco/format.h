@@ -62,7 +62,18 @@ public:
   /// Gets the type of the idx array for level i
   Datatype getCoordinateTypeIdx(size_t level) const;
 
-  /// Sets the types of the coordinate arrays for each level
+  /// Gets the type of the variables that hold positions of level i, which is
+  /// Int64 if a position array of levels 0 to i can hold positions past
+  /// INT_MAX and Int32 otherwise.
+  Datatype getPositionType(size_t level) const;
+
+  /// Sets the types of the coordinate arrays for each level. Level i stores
+  /// its position array as levelArrayTypes[i][0] and its coordinate array as
+  /// levelArrayTypes[i][1], or as levelArrayTypes[i][0] if only one type is
+  /// given. Levels default to Int32 index arrays, but any integer type works,
+  /// such as Int64 positions for tensors with more than INT_MAX nonzeros or
+  /// Int16 coordinates for modes with fewer than 2^15 coordinates. Hashed
+  /// levels only support Int32 index arrays.
   void setLevelArrayTypes(std::vector<std::vector<Datatype>> levelArrayTypes);
 
 private:
@@ -85,12 +96,16 @@ public:
   static ModeFormat dense;       /// e.g., first mode in CSR
   static ModeFormat compressed;  /// e.g., second mode in CSR
   static ModeFormat singleton;   /// e.g., second mode in COO
+  static ModeFormat hashed;      /// e.g., random-insert sparse result rows
+  static ModeFormat bitmap;      /// e.g., medium-density matrix rows
 
   static ModeFormat sparse;      /// alias for compressed
   static ModeFormat Dense;       /// alias for dense
   static ModeFormat Compressed;  /// alias for compressed
   static ModeFormat Sparse;      /// alias for compressed
   static ModeFormat Singleton;   /// alias for singleton
+  static ModeFormat Hashed;      /// alias for hashed
+  static ModeFormat Bitmap;      /// alias for bitmap
 
   /// Properties of a mode format
   enum Property {
@@ -175,11 +190,15 @@ extern const ModeFormat Dense;
 extern const ModeFormat Compressed;
 extern const ModeFormat Sparse;
 extern const ModeFormat Singleton;
+extern const ModeFormat Hashed;
+extern const ModeFormat Bitmap;
 
 extern const ModeFormat dense;
 extern const ModeFormat compressed;
 extern const ModeFormat sparse;
 extern const ModeFormat singleton;
+extern const ModeFormat hashed;
+extern const ModeFormat bitmap;
 
 extern const Format CSR;
 extern const Format CSC;
@@ -3,6 +3,7 @@
 
 #include <ostream>
 #include <string>
+#include <cstdint>
 #include <memory>
 #include <vector>
 #include <set>
@@ -515,7 +516,9 @@ public:
   /// starting point of a tile can require an $O(n)$ or $O(\log (n))$
   /// search.  Therefore, if we want to parallelize a blocked
   /// loop, then we want a fixed number of blocks and not a number
-  /// proportional to the tensor size.
+  /// proportional to the tensor size.  Dividing a position variable
+  /// (see pos) gives blocks with equal numbers of nonzeros, which
+  /// balances the work of a parallelized outer loop.
   /// Preconditions: divideFactor is a positive nonzero integer
   IndexStmt divide(IndexVar i, IndexVar i1, IndexVar i2, size_t divideFactor) const; // TODO: TailStrategy
 
@@ -565,8 +568,13 @@ public:
   /// this loop can be parallelized by first strip-mining it with the split or divide
   /// transformation to create a parallel for loop with a serial nested while loop. Expressions
   /// that have an output in a format that does not support random insert can also not be
-  /// parallelized. Parallelizing these expressions would require creating multiple copies of a
-  /// datastructure and then merging them, which is left to future work. Note that there is a special
+  /// parallelized, unless the ParallelAssembly strategy is used. That strategy requires every
+  /// output mode but the last to support random insert and the last to support append and to be
+  /// a child of the output mode that the parallelized loop iterates over. It first
+  /// counts the components of each iteration in parallel, computes the segment of the output that
+  /// each iteration appends to with a parallel prefix sum, and then fills the segments in
+  /// parallel. Merging multiple copies of other output datastructures is left to future work.
+  /// Note that there is a special
   /// case where the output's sparsity pattern is the same as one of the inputs.
   /// This true of the popular sampled dense-dense matrix multiply (SDDMM),
   /// tensor times vector (TTV), and tensor times matrix (TTM) kernels for example.
@@ -579,7 +587,8 @@ public:
   /// The IgnoreRaces strategy has the precondition that for the given inputs the code generator can
   /// assume that no data races will occur. For all other strategies other than Atomics,
   /// there is the precondition
-  /// that the racing reduction must be over the index variable being parallelized.
+  /// that the racing reduction must be over the index variable being parallelized. The
+  /// ParallelAssembly strategy has the same precondition as NoRaces for the output values.
   IndexStmt parallelize(IndexVar i, ParallelUnit parallel_unit, OutputRaceStrategy output_race_strategy) const;
 
   /// pos and coord create
@@ -645,6 +654,17 @@ public:
 /// Check if two index statements are isomorphic.
 bool isomorphic(IndexStmt, IndexStmt);
 
+/// Hash an index statement such that isomorphic statements have the same
+/// hash. The hash does not depend on the names or identities of tensors and
+/// index variables, so it is stable across processes.
+uint64_t isomorphicHash(IndexStmt);
+
+/// Serialize the structure of an index statement that `isomorphicHash` hashes.
+/// Statements have the same key if and only if they are isomorphic, so keys
+/// confirm hash matches against statements that are not at hand, e.g. those of
+/// precompiled kernels.
+std::string isomorphicKey(IndexStmt);
+
 /// Compare two index statments by value.
 bool equals(IndexStmt, IndexStmt);
 
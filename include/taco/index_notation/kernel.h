@@ -9,6 +9,7 @@ namespace taco {
 class Function;
 class IndexStmt;
 class TensorStorage;
+class TensorVar;
 namespace ir {
 class Module;
 }
@@ -19,6 +20,13 @@ class Module;
 /// They can be called to do all these things at once (`evaluate`), to only
 /// allocate memory and assemble indices (`assemble`), or to only compute
 /// component values (`compute`).
+///
+/// Kernels take tensor storage for the results and then the arguments of the
+/// statement, in the order given by `getParameters`. The storage can either
+/// be passed to each call or bound to the parameters once with `bind`, which
+/// lets repeated calls skip packing the arguments. Binding storage changes
+/// every copy of the kernel, so kernels with bound storage must not be called
+/// concurrently.
 class Kernel {
 public:
   /// Construct an undefined kernel.
@@ -54,6 +62,19 @@ public:
   }
   /// @}
 
+  /// Bind tensor storage to a result or argument of the kernel.
+  void bind(const TensorVar& parameter, const TensorStorage& storage);
+
+  /// Evaluate, assemble or compute the kernel on the bound tensor storage.
+  /// @{
+  bool operator()() const;
+  bool assemble() const;
+  bool compute() const;
+  /// @}
+
+  /// Get the results and arguments of the kernel in the order it takes them.
+  const std::vector<TensorVar>& getParameters() const;
+
   /// Check whether the kernel is defined.
   bool defined();
 
@@ -3,7 +3,7 @@
 
 namespace taco {
 struct IndexVarRelNode;
-enum IndexVarRelType {UNDEFINED, SPLIT, POS, FUSE, BOUND, PRECOMPUTE};
+enum IndexVarRelType {UNDEFINED, SPLIT, DIVIDE, POS, FUSE, BOUND, PRECOMPUTE};
 
 /// A pointer class for IndexVarRelNodes provides some operations for all IndexVarRelTypes
 class IndexVarRel : public util::IntrusivePtr<const IndexVarRelNode> {
@@ -111,6 +111,48 @@ private:
 
 bool operator==(const SplitRelNode&, const SplitRelNode&);
 
+/// The divide relation takes a parentVar's iteration space and partitions it into divideFactor equally-sized blocks.
+/// The outerVar iterates over the blocks and the innerVar iterates within a block. Dividing a position variable
+/// gives blocks with an equal number of nonzeros, whose starting coordinates are located by binary search.
+struct DivideRelNode : public IndexVarRelNode {
+  DivideRelNode(IndexVar parentVar, IndexVar outerVar, IndexVar innerVar, size_t divideFactor);
+
+  const IndexVar& getParentVar() const;
+  const IndexVar& getOuterVar() const;
+  const IndexVar& getInnerVar() const;
+  const size_t& getDivideFactor() const;
+
+  void print(std::ostream& stream) const;
+  bool equals(const DivideRelNode &rel) const;
+  std::vector<IndexVar> getParents() const; // parentVar
+  std::vector<IndexVar> getChildren() const; // outerVar, innerVar
+  std::vector<IndexVar> getIrregulars() const; // outerVar
+
+  /// if parent is in position space then bound is just the parent's bound
+  /// if innerVar defined and not outerVar or if neither variables are defined then return the parent's bound
+  /// if the outerVar is already defined then the inner var constrains bound to a blockSize-sized strip at outerVar * blockSize
+  /// if both variables are defined then constrain to single length 1 strip at outerVar * blockSize + innerVar
+  std::vector<ir::Expr> computeRelativeBound(std::set<IndexVar> definedVars, std::map<IndexVar, std::vector<ir::Expr>> computedBounds, std::map<IndexVar, ir::Expr> variableExprs, Iterators iterators, ProvenanceGraph provGraph) const;
+
+  /// outerVar has 0 -> divideFactor and innerVar has 0 -> ceil(parentBounds / divideFactor)
+  std::vector<ir::Expr> deriveIterBounds(IndexVar indexVar, std::map<IndexVar, std::vector<ir::Expr>> parentIterBounds, std::map<IndexVar, std::vector<ir::Expr>> parentCoordBounds, std::map<taco::IndexVar, taco::ir::Expr> variableNames, Iterators iterators, ProvenanceGraph provGraph) const;
+
+  /// parentVar = parentBegin + outerVar * blockSize + innerVar
+  ir::Expr recoverVariable(IndexVar indexVar, std::map<IndexVar, ir::Expr> variableNames, Iterators iterators, std::map<IndexVar, std::vector<ir::Expr>> parentIterBounds, std::map<IndexVar, std::vector<ir::Expr>> parentCoordBounds, ProvenanceGraph provGraph) const;
+
+  /// not supported: the block size depends on the parent's bounds, which are not available here
+  ir::Stmt recoverChild(IndexVar indexVar, std::map<IndexVar, ir::Expr> relVariables, bool emitVarDecl, Iterators iterators, ProvenanceGraph provGraph) const;
+
+private:
+  /// ceil((parentBound[1] - parentBound[0]) / divideFactor)
+  ir::Expr getBlockSize(std::vector<ir::Expr> parentBound) const;
+
+  struct Content;
+  std::shared_ptr<Content> content;
+};
+
+bool operator==(const DivideRelNode&, const DivideRelNode&);
+
 /// The Pos relation maps an index variable to the position space of a given access
 struct PosRelNode : public IndexVarRelNode {
   PosRelNode(IndexVar i, IndexVar ipos, const Access& access);
@@ -1,6 +1,7 @@
 #ifndef TACO_TRANSFORMATIONS_H
 #define TACO_TRANSFORMATIONS_H
 
+#include <map>
 #include <memory>
 #include <string>
 #include <ostream>
@@ -207,5 +208,41 @@ IndexStmt scalarPromote(IndexStmt stmt);
  * 1. The result is a is scattered into but does not support random insert.
  */
 IndexStmt insertTemporaries(IndexStmt stmt);
+
+/// Statistics of a packed operand, which guide `autoschedule`.
+struct OperandStatistics {
+  /// The number of stored components.
+  size_t nnz = 0;
+
+  /// The mean number of components below each position of the operand's
+  /// first stored level (e.g. the mean row length of a CSR matrix).
+  double meanSegmentLength = 0.0;
+
+  /// The standard deviation of the number of components below each position
+  /// of the first level, divided by their mean. Large values mean that, for
+  /// example, some rows of a CSR matrix have many more nonzeros than others.
+  double segmentLengthVariation = 0.0;
+};
+
+/**
+ * Schedule the statement for parallel execution on the CPU, using the
+ * statistics of the operands whose first stored level the outer loop iterates
+ * over. The schedule is chosen by a cost model:
+ * 1. Statements with too little work to amortize starting threads stay
+ *    serial.
+ * 2. If atomics are allowed, the lengths of the operand's rows vary a lot and
+ *    the result can be written with atomics, the two outer loops are fused
+ *    and their nonzeros are split into equal chunks that are processed in
+ *    parallel.
+ * 3. Otherwise the outer loop is split into chunks of rows with about the
+ *    same number of nonzeros, that are processed in parallel without races,
+ *    by parallel assembly of a sparse result, or with atomics if allowed.
+ * Atomics are not allowed by default, since they make floating-point
+ * reductions nondeterministic. Falls back to parallelizeOuterLoop without
+ * statistics or when generating CUDA code.
+ */
+IndexStmt autoschedule(IndexStmt stmt,
+                       const std::map<TensorVar,OperandStatistics>& statistics,
+                       bool allowAtomics=false);
 }
 #endif
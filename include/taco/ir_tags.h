@@ -18,8 +18,10 @@ extern const char *ParallelUnit_NAMES[];
 /// OutputRaceStrategy::Temporary uses a temporary array for outputs that is serially reduced
 /// OutputRaceStrategy::ParallelReduction uses reduction operations across a warp/vector
 /// OutputRaceStrategy::IgnoreRaces allows the user to specify that races can be safely ignored
+/// OutputRaceStrategy::ParallelAssembly counts the components of a sparse output in parallel and
+///   appends each iteration's components to its own segment of the output
 enum class OutputRaceStrategy {
-  IgnoreRaces, NoRaces, Atomics, Temporary, ParallelReduction
+  IgnoreRaces, NoRaces, Atomics, Temporary, ParallelReduction, ParallelAssembly
 };
 extern const char *OutputRaceStrategy_NAMES[];
 
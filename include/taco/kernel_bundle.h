@@ -0,0 +1,90 @@
+#ifndef TACO_KERNEL_BUNDLE_H
+#define TACO_KERNEL_BUNDLE_H
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "taco/tensor.h"
+#include "taco/taco_kernel_t.h"
+#include "taco/codegen/module.h"
+#include "taco/index_notation/index_notation.h"
+
+namespace taco {
+
+/// A set of kernels that are compiled ahead of time into one library. The
+/// library contains the assemble and compute functions of every kernel, and a
+/// registry `<prefix>_kernels` of `<prefix>_num_kernels` taco_kernel_t entries
+/// that map the isomorphic hashes and keys of the kernels' index statements,
+/// and the variants they were lowered with, to the functions. Once the registry is registered with `registerKernels` or
+/// `loadKernelBundle`, tensors whose index statements are isomorphic to a
+/// bundled kernel call the bundled functions instead of generating and
+/// compiling code.
+///
+/// ```
+/// KernelBundle bundle;
+/// A(i,j) = B(i,j) + C(i,j);
+/// bundle.add(A);
+/// bundle.compileToSharedLibrary("/path/to/", "mykernels");
+/// ...
+/// loadKernelBundle("/path/to/mykernels.so", "mykernels");
+/// ```
+class KernelBundle {
+public:
+  KernelBundle();
+
+  /// Add the kernels that `tensor.compile()` generates for the tensor's
+  /// expression.
+  void add(const TensorBase& tensor);
+
+  /// Add the kernels that `TensorBase::compile(stmt, assembleWhileCompute)`
+  /// generates for a concrete index statement, with or without symbolic
+  /// assembly.
+  void add(IndexStmt stmt, bool assembleWhileCompute=false,
+           bool symbolicAssembly=false);
+
+  /// Get the number of distinct kernels in the bundle. Kernels that are
+  /// isomorphic to a kernel already in the bundle are only added once.
+  size_t getNumKernels() const;
+
+  /// Compile the bundle into the static library path/prefix.a, and keep its
+  /// source and header at path/prefix.{c,h}. The prefix must be a C
+  /// identifier, since it prefixes the names of the bundle's functions.
+  /// Programs that link the library register its kernels with
+  /// `registerKernels(prefix_kernels, prefix_num_kernels)`.
+  void compileToStaticLibrary(std::string path, std::string prefix);
+
+  /// Compile the bundle into the shared library path/prefix.so, which can be
+  /// loaded with `loadKernelBundle`. The prefix must be a C identifier.
+  void compileToSharedLibrary(std::string path, std::string prefix);
+
+private:
+  struct Kernel {
+    IndexStmt stmt;
+    bool assembleWhileCompute;
+    bool symbolicAssembly;
+  };
+  std::vector<Kernel> kernels;
+
+  std::shared_ptr<ir::Module> makeModule(std::string prefix) const;
+};
+
+/// Register the kernels of a kernel bundle, e.g. of a statically linked one.
+/// Kernels registered later take precedence over earlier kernels with the
+/// same index statement. The kernels must stay valid for the rest of the
+/// program.
+void registerKernels(const taco_kernel_t* kernels, int numKernels);
+
+/// Load the kernel bundle shared library at the given path, that was compiled
+/// with the given prefix, and register its kernels.
+void loadKernelBundle(std::string path, std::string prefix);
+
+/// Get a module that calls the registered kernels for an index statement as
+/// lowered by TensorBase::compile, or nullptr if no kernel is registered for
+/// it with the same variant.
+std::shared_ptr<ir::Module> getBundledKernel(IndexStmt stmt,
+                                             bool assembleWhileCompute,
+                                             bool symbolicAssembly);
+
+}
+#endif
@@ -155,6 +155,10 @@ public:
   ir::Stmt getAppendInitLevel(const ir::Expr& szPrev, const ir::Expr& sz) const;
   ir::Stmt getAppendFinalizeLevel(const ir::Expr& szPrev, 
       const ir::Expr& sz) const;
+  ir::Stmt getAppendResizeLevel(const ir::Expr& szPrev, 
+      const ir::Expr& sz) const;
+  ir::Stmt getParallelAppendFinalizeLevel(const ir::Expr& szPrev, 
+      const ir::Expr& sz) const;
 
   /// Returns true if the iterator is defined, false otherwise.
   bool defined() const;
@@ -56,6 +56,13 @@ public:
   ir::Stmt lower(IndexStmt stmt, std::string name, 
                  bool assemble, bool compute, bool pack, bool unpack);
 
+  /// Assemble results in two phases: a symbolic phase that counts the
+  /// components of each result and a numeric phase that fills result arrays
+  /// that are allocated exactly once, instead of growing them by doubling.
+  /// Statements whose results have append modes other than their last mode
+  /// are assembled in one phase.
+  void setSymbolicAssembly(bool symbolicAssembly);
+
 protected:
 
   /// Lower an assignment statement.
@@ -293,6 +300,19 @@ protected:
   /// Generate code to finalize result indices.
   ir::Stmt finalizeResultArrays(std::vector<Access> writes);
 
+  /// Check whether the results can be assembled in a symbolic and a numeric
+  /// phase.
+  bool canAssembleSymbolically(std::vector<Access> writes) const;
+
+  /// Lower the symbolic assembly phase of the index statement, which counts
+  /// the result components, and resize the result arrays to their counts.
+  ir::Stmt lowerSymbolicAssembly(IndexStmt stmt, std::vector<Access> writes);
+
+  /// Declare private position variables for the result modes appended to
+  /// under `var` by an iteration of a parallel assembly loop, starting at the
+  /// iteration's segment of the mode.
+  ir::Stmt declSegmentPosVars(IndexVar var, std::vector<Access> writes);
+
   /**
    * Replace scalar tensor pointers with stack scalar for lowering.
    */
@@ -346,6 +366,9 @@ protected:
     /// Create statements to append coordinate to result modes.
   ir::Stmt appendCoordinate(std::vector<Iterator> appenders, ir::Expr coord);
 
+  /// Create statements to insert coordinates into result modes.
+  ir::Stmt insertCoordinates(std::vector<Iterator> inserters);
+
   /// Create statements to append positions to result modes.
   ir::Stmt generateAppendPositions(std::vector<Iterator> appenders);
 
@@ -360,6 +383,18 @@ private:
   bool assemble;
   bool compute;
 
+  bool symbolicAssembly = false;
+  /// True while lowering the symbolic phase of a two-phase assembly.
+  bool symbolicPhase = false;
+  /// True once result arrays are sized by a symbolic phase.
+  bool exactResultSizes = false;
+  /// Position variables that the symbolic phase counts result components in.
+  std::set<ir::Expr> symbolicPosVars;
+  /// True if a loop assembles results in parallel, which requires a symbolic
+  /// phase to find the segment of the results each iteration appends to.
+  bool parallelAssembly = false;
+  int inParallelAssemblyDepth = 0;
+
   int markAssignsAtomicDepth = 0;
   ParallelUnit atomicParallelUnit;
 
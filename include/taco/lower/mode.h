@@ -22,7 +22,8 @@ public:
 
   /// Construct a tensor mode.
   Mode(ir::Expr tensor, Dimension size, int mode, ModeFormat modeFormat,
-       ModePack modePack, size_t packLoc, ModeFormat parentModeFormat);
+       ModePack modePack, size_t packLoc, ModeFormat parentModeFormat,
+       Datatype positionType=Int32);
 
   /// Retrieve the name of the tensor mode.
   std::string getName() const;
@@ -49,6 +50,9 @@ public:
   /// Retrieve the mode type of the parent mode in the mode hierarchy.
   ModeFormat getParentModeType() const;
 
+  /// Retrieve the type of the variables that hold positions of the mode.
+  Datatype getPositionType() const;
+
   /// Store temporary variables that may be needed to access or modify a mode
   /// @{
   ir::Expr getVar(std::string varName) const;
@@ -73,8 +77,10 @@ std::ostream& operator<<(std::ostream&, const Mode&);
 class ModePack {
 public:
   ModePack();
+  /// Construct a mode pack whose i-th index array has element type
+  /// arrayTypes[i], or Int32 if arrayTypes has no i-th element.
   ModePack(size_t numModes, ModeFormat modeType, ir::Expr tensor, int mode, 
-           int level);
+           int level, std::vector<Datatype> arrayTypes={});
 
   /// Returns number of tensor modes belonging to mode pack.
   size_t getNumModes() const;
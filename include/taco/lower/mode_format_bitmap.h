@@ -0,0 +1,43 @@
+#ifndef TACO_MODE_FORMAT_BITMAP_H
+#define TACO_MODE_FORMAT_BITMAP_H
+
+#include "taco/lower/mode_format_impl.h"
+
+namespace taco {
+
+/// A bitmap level stores the components of each segment at the positions of
+/// a dense level, [p*N, (p+1)*N) for parent position p and dimension N, and
+/// marks the positions that hold components with nonzero bytes of its second
+/// index array. Positions that are not marked hold zero values.
+class BitmapModeFormat : public ModeFormatImpl {
+public:
+  BitmapModeFormat();
+
+  ~BitmapModeFormat() override {}
+
+  ModeFormat copy(std::vector<ModeFormat::Property> properties) const override;
+
+  ModeFunction posIterBounds(ir::Expr parentPos, Mode mode) const override;
+  ModeFunction posIterAccess(ir::Expr pos, std::vector<ir::Expr> coords,
+                             Mode mode) const override;
+
+  ModeFunction locate(ir::Expr parentPos, std::vector<ir::Expr> coords,
+                      Mode mode) const override;
+
+  ir::Stmt getInsertCoord(ir::Expr p, const std::vector<ir::Expr>& i,
+                          Mode mode) const override;
+  ir::Expr getWidth(Mode mode) const override;
+  ir::Stmt getInsertInitLevel(ir::Expr szPrev, ir::Expr sz,
+                              Mode mode) const override;
+
+  std::vector<ir::Expr> getArrays(ir::Expr tensor, int mode,
+                                  int level) const override;
+
+protected:
+  ir::Expr getSizeArray(ModePack pack) const;
+  ir::Expr getBitmapArray(ModePack pack) const;
+};
+
+}
+
+#endif
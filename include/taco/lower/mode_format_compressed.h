@@ -32,6 +32,10 @@ public:
                               Mode mode) const override;
   ir::Stmt getAppendFinalizeLevel(ir::Expr parentSize, ir::Expr size, 
                                   Mode mode) const override;
+  ir::Stmt getAppendResizeLevel(ir::Expr parentSize, ir::Expr size, 
+                                Mode mode) const override;
+  ir::Stmt getParallelAppendFinalizeLevel(ir::Expr parentSize, ir::Expr size,
+                                          Mode mode) const override;
 
   std::vector<ir::Expr> getArrays(ir::Expr tensor, int mode, 
                                   int level) const override;
@@ -0,0 +1,51 @@
+#ifndef TACO_MODE_FORMAT_HASHED_H
+#define TACO_MODE_FORMAT_HASHED_H
+
+#include "taco/lower/mode_format_impl.h"
+
+namespace taco {
+
+/// A hashed level stores the coordinates of each segment in an open
+/// addressing hash table of W slots, where W is a power of two stored in the
+/// first index array of the level. The coordinates are stored in the second
+/// index array, at positions [p*W, (p+1)*W) for parent position p, and empty
+/// slots hold -1 and zero values. Coordinates are placed by linear probing
+/// from a multiplicative hash of i, which visits at most W slots. Segments must keep an
+/// empty slot unless W covers the dimension of the level, so a result whose
+/// segments fill up is assembled again with wider segments.
+class HashedModeFormat : public ModeFormatImpl {
+public:
+  HashedModeFormat();
+
+  ~HashedModeFormat() override {}
+
+  ModeFormat copy(std::vector<ModeFormat::Property> properties) const override;
+
+  ModeFunction posIterBounds(ir::Expr parentPos, Mode mode) const override;
+  ModeFunction posIterAccess(ir::Expr pos, std::vector<ir::Expr> coords,
+                             Mode mode) const override;
+
+  ModeFunction locate(ir::Expr parentPos, std::vector<ir::Expr> coords,
+                      Mode mode) const override;
+
+  ir::Stmt getInsertCoord(ir::Expr p, const std::vector<ir::Expr>& i,
+                          Mode mode) const override;
+  ir::Expr getWidth(Mode mode) const override;
+  ir::Stmt getInsertInitLevel(ir::Expr szPrev, ir::Expr sz,
+                              Mode mode) const override;
+
+  std::vector<ir::Expr> getArrays(ir::Expr tensor, int mode,
+                                  int level) const override;
+
+protected:
+  ir::Expr getWidthArray(ModePack pack) const;
+
+  /// The slot of segments of the given width where probing for a coordinate
+  /// starts.
+  ir::Expr getHashedSlot(ir::Expr coord, ir::Expr width) const;
+  ir::Expr getCoordArray(ModePack pack) const;
+};
+
+}
+
+#endif
@@ -146,6 +146,16 @@ public:
 
   virtual ir::Stmt
   getAppendFinalizeLevel(ir::Expr szPrev, ir::Expr sz, Mode mode) const;
+
+  /// Return code that resizes the level to hold exactly `sz` coordinates,
+  /// which a symbolic assembly phase has counted.
+  virtual ir::Stmt
+  getAppendResizeLevel(ir::Expr szPrev, ir::Expr sz, Mode mode) const;
+
+  /// Return code that finalizes the level like `getAppendFinalizeLevel`, but
+  /// that may run in parallel. Defaults to `getAppendFinalizeLevel`.
+  virtual ir::Stmt
+  getParallelAppendFinalizeLevel(ir::Expr szPrev, ir::Expr sz, Mode mode) const;
   /// @}
 
   /// Returns arrays associated with a tensor mode
@@ -4,6 +4,7 @@
 #include <memory>
 #include <ostream>
 #include <taco/type.h>
+#include <taco/taco_allocator_t.h>
 #include <taco/storage/typed_value.h>
 #include "taco/util/collections.h"
 
@@ -16,7 +17,9 @@ public:
   /// The memory reclamation policy of Array objects. UserOwns means the Array
   /// object will not free its data, free means it will reclaim data  with the
   /// C free function and delete means it will reclaim data with delete[].
-  enum Policy {UserOwns, Free, Delete};
+  /// Allocator means it will reclaim data with the taco_allocator_t that
+  /// allocated it.
+  enum Policy {UserOwns, Free, Delete, Allocator};
 
   /// Construct an empty array of undefined elements.
   Array();
@@ -24,6 +27,15 @@ public:
   /// Construct an array of elements of the given type.
   Array(Datatype type, void* data, size_t size, Policy policy=Free);
 
+  /// Construct an array of elements of the given type whose memory is owned
+  /// by `owner`, such as a memory-mapped file shared by several arrays. The
+  /// owner is kept alive as long as the array is.
+  Array(Datatype type, void* data, size_t size, std::shared_ptr<void> owner);
+
+  /// Construct an array of elements of the given type whose memory was
+  /// allocated by `allocator`, which must outlive the array.
+  Array(Datatype type, void* data, size_t size, taco_allocator_t* allocator);
+
   /// Returns the type of the array elements
   const Datatype& getType() const;
 
@@ -0,0 +1,40 @@
+#ifndef TACO_FILE_IO_TTB_H
+#define TACO_FILE_IO_TTB_H
+
+#include <istream>
+#include <ostream>
+#include <string>
+
+#include "taco/format.h"
+
+namespace taco {
+class TensorBase;
+class Format;
+
+/// Read a ttb tensor from a file. The file is memory-mapped and the tensor's
+/// index and value arrays point into the mapping, so the tensor is never
+/// parsed or packed. The format must be the one the tensor was written in.
+/// The arrays are checked to lie in the file, and the positions and
+/// coordinates to be consistent, in one pass over the index.
+TensorBase readTTB(std::string filename, const ModeFormat& modetype,
+                   bool pack=true);
+
+/// Read a ttb tensor from a file.
+TensorBase readTTB(std::string filename, const Format& format, bool pack=true);
+
+/// Read a ttb tensor from a stream.
+TensorBase readTTB(std::istream& stream, const ModeFormat& modetype,
+                   bool pack=true);
+
+/// Read a ttb tensor from a stream.
+TensorBase readTTB(std::istream& stream, const Format& format, bool pack=true);
+
+/// Write a ttb tensor to a file.
+void writeTTB(std::string filename, const TensorBase& tensor);
+
+/// Write a ttb tensor to a stream.
+void writeTTB(std::ostream& stream, const TensorBase& tensor);
+
+}
+
+#endif
@@ -7,10 +7,10 @@
 
 #include "taco/format.h"
 #include "taco/taco_tensor_t.h"
+#include "taco/storage/array.h"
 
 namespace taco {
 class ModeIndex;
-class Array;
 
 /// An index contains the index data structures of a tensor, but not its values.
 /// Thus, an index has a format and zero or more mode indices that describes the
@@ -76,6 +76,17 @@ private:
 };
 
 
+/// Factory function to construct an index of any format from the index arrays
+/// of its levels. `indices[i]` holds the arrays of the level stored in
+/// position i: none for a dense level, a pos and a crd array for a compressed
+/// level, and a crd array for a singleton level. The arrays are not copied,
+/// and the policy determines whether the index frees them. If validate is
+/// true, the arrays are checked to describe a well-formed index of a tensor
+/// with the given dimensions, which takes time linear in the index size.
+Index makeIndex(const Format& format, const std::vector<int>& dimensions,
+                const std::vector<std::vector<int*>>& indices,
+                Array::Policy policy=Array::UserOwns, bool validate=false);
+
 /// Factory functions to construct a compressed sparse rows (CSR) index.
 /// @{
 Index makeCSRIndex(size_t numrows, int* rowptr, int* colidx);
@@ -0,0 +1,20 @@
+/// This file defines the runtime struct through which generated code allocates
+/// memory.  Generated functions take a pointer to one as their last argument
+/// and allocate temporaries, workspaces and output arrays through it, or with
+/// malloc/realloc/free if the pointer is NULL.  Note: this file must be valid
+/// C99, not C++.
+/// This *must* be kept in sync with the version used in codegen_c.cpp
+
+#ifndef TACO_ALLOCATOR_T_DEFINED
+#define TACO_ALLOCATOR_T_DEFINED
+
+#include <stddef.h>
+
+typedef struct taco_allocator_t {
+  void* (*allocate)(void* state, size_t size);
+  void* (*reallocate)(void* state, void* ptr, size_t old_size, size_t size);
+  void  (*deallocate)(void* state, void* ptr);
+  void*   state;       // passed to the functions, e.g. an arena
+} taco_allocator_t;
+
+#endif
@@ -0,0 +1,20 @@
+/// This file defines the runtime struct that kernel bundles use to register
+/// their kernels (see taco/kernel_bundle.h).  Note: this file must be valid
+/// C99, not C++.
+/// This *must* be kept in sync with the version used in kernel_bundle.cpp
+
+#ifndef TACO_KERNEL_T_DEFINED
+#define TACO_KERNEL_T_DEFINED
+
+#include <stdint.h>
+
+typedef struct taco_kernel_t {
+  uint64_t hash;                   // isomorphic hash of the index statement
+  const char* key;                 // hex isomorphic key of the statement
+  int32_t  assemble_while_compute; // compute also assembles the result
+  int32_t  symbolic_assembly;      // assemble sizes the result symbolically
+  int    (*assemble)(void**);      // shim of the assemble function
+  int    (*compute)(void**);       // shim of the compute function
+} taco_kernel_t;
+
+#endif
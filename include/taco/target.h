@@ -3,13 +3,18 @@
 
 #include "taco/error.h"
 
+#ifndef LLVM_BUILT
+  #define LLVM_BUILT false
+#endif
+
 namespace taco {
 
 /// This struct represents the machine & OS to generate code for, both for
 /// JIT and AOT code generation.
 struct Target {
   /// Architectures.  If C99, we generate C code, and if it is a specific
-  /// machine arch (e.g. x86 or arm) we use LLVM.
+  /// machine arch (e.g. x86 or arm) we use LLVM to compile in process. Machine
+  /// architectures require taco to be built with LLVM.
   enum Arch {C99=0, X86} arch;
   
   /// Operating System.  Used when deciding which OS-specific calls to use.
@@ -28,7 +33,8 @@ struct Target {
   Target(const std::string &s);
 
   Target(Arch a, OS o) : arch(a), os(o) { 
-    taco_tassert(a == C99 && o != Windows && o != OSUnknown)
+    taco_tassert((a == C99 || (a == X86 && LLVM_BUILT)) &&
+                 o != Windows && o != OSUnknown)
         << "Unsupported target.";
   }
   
@@ -37,8 +43,9 @@ struct Target {
   
 };
 
-  /// Gets the target from the environment.  If this is not set in the
-  /// environment, it uses the default C99 backend with the current OS
+  /// Gets the target from the environment variable TACO_TARGET (e.g.
+  /// "x86-linux").  If this is not set in the environment, it uses the
+  /// default C99 backend with the current OS
   Target getTargetFromEnvironment();
 
 } // namespace taco
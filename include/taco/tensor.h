@@ -1,6 +1,7 @@
 #ifndef TACO_TENSOR_H
 #define TACO_TENSOR_H
 
+#include <future>
 #include <memory>
 #include <string>
 #include <vector>
@@ -8,6 +9,7 @@
 #include <utility>
 #include <array>
 #include <mutex>
+#include <numeric>
 
 #include "taco/type.h"
 #include "taco/format.h"
@@ -39,6 +41,9 @@ struct AccessTensorNode;
 template <typename CType>
 struct ScalarAccess;
 
+/// Statistics of a packed operand, which guide the default schedule.
+struct OperandStatistics;
+
 /// TensorBase is the super-class for all tensors. You can use it directly to
 /// avoid templates, or you can use the templated `Tensor<T>` that inherits from
 /// `TensorBase`.
@@ -110,6 +115,15 @@ public:
   /// to the format of the tensor.
   TensorStorage& getStorage();
 
+  /// Set the allocator through which the kernels that pack, assemble and
+  /// compute this tensor allocate its arrays and their temporaries, e.g. to
+  /// back them with an arena. The allocator must outlive the storage it
+  /// allocates. A null allocator, the default, allocates with malloc.
+  void setAllocator(taco_allocator_t* allocator);
+
+  /// Returns the allocator set with setAllocator, or null.
+  taco_allocator_t* getAllocator() const;
+
   /// Returns the tensor var for this tensor.
   const TensorVar& getTensorVar() const;
 
@@ -134,6 +148,15 @@ public:
   template <typename CType>
   void insert(const std::vector<int>& coordinate, CType value);
 
+  /// Insert `count` values into the tensor. The coordinates of value i are
+  /// stored at `coordinates[i*order]` through `coordinates[(i+1)*order-1]`.
+  /// If `sorted` is true, the caller promises that the coordinates are sorted
+  /// lexicographically in the storage order of the modes and that none repeat,
+  /// which lets pack skip sorting them.
+  template <typename CType>
+  void insertBatch(const int* coordinates, const CType* values, size_t count,
+                   bool sorted=false);
+
   /// Fill the tensor with the list of components defined by the iterator range (begin, end).
   ///
   /// The input list of triplets does not have to be sorted, and can contains duplicated elements.
@@ -312,9 +335,9 @@ public:
     }
 
     void fillBuffer() {
-      std::array<void*,5> args = {&ctx->iterCtx, ctx->coordBuffer, 
+      std::array<void*,6> args = {&ctx->iterCtx, ctx->coordBuffer, 
                                   (void*)valBuffer, (void*)&bufferCapacity, 
-                                  (void*)tensorStorage};
+                                  (void*)tensorStorage, nullptr};
       bufferSize = iterFunc(args.data());
     }
 
@@ -413,6 +436,16 @@ public:
 
   void compile(IndexStmt stmt, bool assembleWhileCompute=false);
 
+  /// Compile the tensor expression in the background. The kernels are lowered
+  /// before this function returns, while the system compiler runs on a
+  /// bounded pool of threads that is shared by all tensors. assemble() and
+  /// compute() wait for the returned future when they call the kernels, and
+  /// rethrow compilation errors.
+  std::shared_future<void> compileAsync();
+
+  std::shared_future<void> compileAsync(IndexStmt stmt,
+                                        bool assembleWhileCompute=false);
+
   /// Assemble the tensor storage, including index and value arrays.
   void assemble();
 
@@ -437,6 +470,23 @@ public:
   /// Set to true to perform the assemble and compute stages simultaneously.
   void setAssembleWhileCompute(bool assembleWhileCompute);
 
+  /// Set to true to assemble the tensor in two phases: a symbolic phase that
+  /// counts its components and a numeric phase that fills arrays allocated to
+  /// the exact size, rather than growing them by doubling as it goes.
+  void setSymbolicAssembly(bool symbolicAssembly);
+
+  /// Set to true to inline the expressions of pending operand tensors into
+  /// this tensor's expression when it is compiled, so that intermediates that
+  /// are only read by this tensor are not written to memory. Inlined operands
+  /// stay pending and are only computed if they are read later.
+  void setFuseProducers(bool fuseProducers);
+
+  /// Set to true to let the default schedule write the result with atomics,
+  /// e.g. to split operands with rows of very different lengths by their
+  /// nonzeros. This balances the work of threads, but the order in which
+  /// floating-point values are reduced then changes from run to run.
+  void setAtomicSchedules(bool atomicSchedules);
+
   /// Get the source code of the kernel functions.
   std::string getSource() const;
 
@@ -459,6 +509,16 @@ public:
   /// Get the size of the initial index allocations.
   size_t getAllocSize() const;
 
+  /// Set the number of hash table slots per segment that the hashed levels of
+  /// the tensor's result start with, which is rounded up to a power of two.
+  /// Levels with a segment that fills up are doubled and the result is
+  /// assembled again. The default capacity, 0, starts from twice the number of
+  /// components per segment of the operands.
+  void setHashCapacity(int capacity);
+
+  /// Get the number of hash table slots per segment of hashed result levels.
+  int getHashCapacity() const;
+
   /// Get the taco_tensor_t representation of this tensor.
   taco_tensor_t* getTacoTensorT();
 
@@ -485,15 +545,29 @@ public:
   friend std::ostream& operator<<(std::ostream&, TensorBase&);
 
   friend struct AccessTensorNode;
+  friend class KernelBundle;
   std::vector<TensorBase> getDependentTensors();
 private:
   static std::shared_ptr<ir::Module> getHelperFunctions(
       const Format& format, Datatype ctype, const std::vector<int>& dimensions);
-  static std::shared_ptr<ir::Module> getComputeKernel(const IndexStmt stmt);
+  static std::shared_ptr<ir::Module> getComputeKernel(const IndexStmt stmt,
+                                                      const std::string& variant);
   static void cacheComputeKernel(const IndexStmt stmt, 
+                                 const std::string& variant,
                                  const std::shared_ptr<ir::Module> kernel);
 
   /* --- Compiler Methods --- */
+  IndexStmt makeCompileStmt() const;
+
+  /// Returns the statistics of the tensor's components, which are computed
+  /// the first time they are needed after the tensor's index changes.
+  std::shared_ptr<const OperandStatistics> getStatistics() const;
+  void resetStatistics();
+
+  /// Returns the number of hash table slots per segment that each hashed
+  /// level of the result starts with.
+  std::vector<int> getInitialHashCapacities() const;
+
   bool neverPacked();
 
   void unsetNeverPacked();
@@ -508,6 +582,8 @@ private:
 
   void syncValues();
 
+  void fuseProducers();
+
   template<typename CType>
   iterator_wrapper<int,CType> iteratorPacked();
   
@@ -515,6 +591,14 @@ private:
   void insertUnsynced(const std::vector<int>& coordinate, CType value);
 
 protected:
+  /// Returns a packed copy of the tensor whose mode i is mode
+  /// `newModeOrdering[i]` of this tensor, stored in the given format. The copy
+  /// is built directly from this tensor's storage. Explicit zeros are left out
+  /// if `removeExplicitZeros` is true.
+  TensorBase convertTo(std::string name,
+                       const std::vector<int>& newModeOrdering,
+                       const Format& format, bool removeExplicitZeros) const;
+
   template <typename T, typename CType>
   void insertUnchecked(
       const typename const_iterator<T,CType>::Coordinates& coordinate, 
@@ -524,20 +608,11 @@ private:
   template <typename CType>
   void reinsertPackedComponents();
 
+  void insertBatchUnchecked(const int* coordinates, const char* values,
+                            size_t count, bool sorted);
+
   struct Content;
   std::shared_ptr<Content> content;
-
-  typedef std::vector<std::tuple<Format,
-                                 Datatype,
-                                 std::vector<int>,
-                                 std::shared_ptr<ir::Module>>> HelperFuncsCache;
-  static HelperFuncsCache helperFunctions;
-  static std::mutex helperFunctionsMutex;
-
-  typedef std::vector<std::pair<IndexStmt, 
-                                std::shared_ptr<ir::Module>>> KernelsCache;
-  static KernelsCache computeKernels;
-  static std::mutex computeKernelsMutex;
 };
 
 /// A reference to a tensor. Tensor object copies copies the reference, and
@@ -676,7 +751,13 @@ enum class FileType {
   ttx,
 
   /// .rb  - The rutherford-boeing sparse matrix format.
-  rb
+  rb,
+
+  /// .ttb - The taco binary tensor format.  It stores a packed tensor's index
+  ///        and value arrays, aligned so that they are used in place when the
+  ///        file is memory-mapped.  It must be read in the format it was
+  ///        written in.
+  ttb
 };
 
 /// Read a tensor from a file. The file format is inferred from the filename
@@ -717,6 +798,27 @@ void write(std::string filename, FileType filetype, const TensorBase& tensor);
 void write(std::ofstream& file, FileType filetype, const TensorBase& tensor);
 
 
+/// Factory function to construct a tensor of any format directly from the
+/// index arrays of its levels and its values, without copying or packing.
+/// `indices[i]` holds the arrays of the level stored in position i, as
+/// described by makeIndex. The policy determines whether taco frees the
+/// arrays, and by default they remain owned by the user. If validate is true,
+/// the index arrays are checked to be well-formed.
+template<typename CType>
+TensorBase makeTensor(const std::string& name,
+                      const std::vector<int>& dimensions, const Format& format,
+                      const std::vector<std::vector<int*>>& indices,
+                      CType* vals, Array::Policy policy = Array::UserOwns,
+                      bool validate = false) {
+  auto index = makeIndex(format, dimensions, indices, policy, validate);
+  Tensor<CType> tensor(name, dimensions, format);
+  auto storage = tensor.getStorage();
+  storage.setIndex(index);
+  storage.setValues(makeArray(vals, index.getSize(), policy));
+  tensor.setStorage(storage);
+  return std::move(tensor);
+}
+
 /// Factory function to construct a compressed sparse row (CSR) matrix. The
 /// arrays remain owned by the user and will not be freed by taco.
 
@@ -820,6 +922,10 @@ void getCSCArrays(const TensorBase& tensor,
 /// Pack the operands in the given expression.
 void packOperands(const TensorBase& tensor);
 
+/// Get the operands of the tensor's expression, in the order that its kernels
+/// take them.
+std::vector<TensorBase> getOperands(const TensorBase& tensor);
+
 /// Iterate over the typed values of a TensorBase.
 template <typename CType>
 Tensor<CType> iterate(const TensorBase& tensor) {
@@ -847,16 +953,23 @@ struct TensorBase::Content {
   Assignment         assignment;
 
   size_t             allocSize;
+  int                hashCapacity;
   size_t             valuesSize;
+  std::shared_ptr<const OperandStatistics> statistics;
 
   ir::Stmt           assembleFunc;
   ir::Stmt           computeFunc;
   bool               assembleWhileCompute;
+  bool               symbolicAssembly;
+  bool               fuseProducers;
+  bool               atomicSchedules;
   std::shared_ptr<ir::Module> module;
+  taco_allocator_t*  allocator;
 
   size_t             coordinateBufferUsed;
   size_t             coordinateSize;
   std::shared_ptr<std::vector<char>> coordinateBuffer;
+  bool               coordinateBufferSorted;
 
   bool               neverPacked;
   bool               needsPack;
@@ -903,6 +1016,7 @@ void TensorBase::insert(const std::initializer_list<int>& coordinate, CType valu
   TypedComponentPtr valLoc(getComponentType(), coordLoc);
   *valLoc = TypedComponentVal(getComponentType(), &value);
   content->coordinateBufferUsed += content->coordinateSize;
+  content->coordinateBufferSorted = false;
   setNeedsPack(true);
 }
 
@@ -913,6 +1027,17 @@ void TensorBase::insert(const std::vector<int>& coordinate, CType value) {
   setNeedsPack(true);
 }
 
+template <typename CType>
+void TensorBase::insertBatch(const int* coordinates, const CType* values,
+                             size_t count, bool sorted) {
+  taco_uassert(getComponentType() == type<CType>()) <<
+    "Cannot insert a value of type '" << type<CType>() << "' " <<
+    "into a tensor with component type " << getComponentType();
+  syncDependentTensors();
+  insertBatchUnchecked(coordinates, (const char*)values, count, sorted);
+  setNeedsPack(true);
+}
+
 template <typename CType>
 void TensorBase::insertUnsynced(const std::vector<int>& coordinate, CType value) {
   taco_uassert(coordinate.size() == (size_t)getOrder()) <<
@@ -930,6 +1055,7 @@ void TensorBase::insertUnsynced(const std::vector<int>& coordinate, CType value)
   TypedComponentPtr valLoc(getComponentType(), coordLoc);
   *valLoc = TypedComponentVal(getComponentType(), &value);
   content->coordinateBufferUsed += content->coordinateSize;
+  content->coordinateBufferSorted = false;
 }
   
 template <typename T, typename CType>
@@ -946,6 +1072,7 @@ void TensorBase::insertUnchecked(
   TypedComponentPtr valLoc(getComponentType(), coordLoc);
   *valLoc = TypedComponentVal(getComponentType(), &value);
   content->coordinateBufferUsed += content->coordinateSize;
+  content->coordinateBufferSorted = false;
 }
 
 template <typename CType>
@@ -1116,34 +1243,14 @@ Tensor<CType> Tensor<CType>::transpose(std::vector<int> newModeOrdering, Format
 
 template <typename CType>
 Tensor<CType> Tensor<CType>::transpose(std::string name, std::vector<int> newModeOrdering, Format format) const {
-  // Reorder dimensions to match new mode ordering
-  std::vector<int> newDimensions;
-  for (int mode : newModeOrdering) {
-    newDimensions.push_back(getDimensions()[mode]);
-  }
-
-  Tensor<CType> newTensor(name, newDimensions, format);
-  for (auto& value : *this) {
-    std::vector<int> newCoordinate;
-    for (int mode : newModeOrdering) {
-      newCoordinate.push_back(value.first[mode]);
-    }
-    newTensor.insert(newCoordinate, value.second);
-  }
-  newTensor.pack();
-  return newTensor;
+  return convertTo(name, newModeOrdering, format, false);
 }
 
 template <typename CType>
 Tensor<CType> Tensor<CType>::removeExplicitZeros(Format format) const {
-  Tensor<CType> newTensor(getDimensions(), format);
-  for (const auto& elem : *this) {
-    if (elem.second != static_cast<CType>(0)) {
-      newTensor.insertUnchecked<int,CType>(elem.first, elem.second);
-    }
-  }
-  newTensor.pack();
-  return newTensor;
+  std::vector<int> modeOrdering(getOrder());
+  std::iota(modeOrdering.begin(), modeOrdering.end(), 0);
+  return convertTo(util::uniqueName('A'), modeOrdering, format, true);
 }
 
 template <typename CType>
@@ -4,6 +4,8 @@
 #include <string>
 #include <fstream>
 
+#include "taco/util/uncopyable.h"
+
 namespace taco {
 namespace util {
 
@@ -11,5 +13,26 @@ std::string sanitizePath(std::string path);
 
 void openStream(std::fstream& stream, std::string path, std::fstream::openmode mode);
 
+/// A read-only memory mapping of a file, which lets file readers parse the
+/// file in place without copying it through a stream.
+class MappedFile : Uncopyable {
+public:
+  /// Map the file at the given path. If `copyOnWrite` is true the mapping can
+  /// be written to, and the written pages are copied instead of changing the
+  /// file.
+  MappedFile(std::string path, bool copyOnWrite=false);
+  ~MappedFile();
+
+  /// Returns the file contents, which are not null-terminated.
+  const char* data() const;
+
+  /// Returns the file size in bytes.
+  size_t size() const;
+
+private:
+  void*  mapping;
+  size_t mappingSize;
+};
+
 }}
 #endif
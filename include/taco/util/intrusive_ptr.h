@@ -1,6 +1,7 @@
 #ifndef TACO_UTIL_INTRUSIVE_PTR_H
 #define TACO_UTIL_INTRUSIVE_PTR_H
 
+#include <atomic>
 #include <iostream>
 
 namespace taco {
@@ -130,12 +131,21 @@ public:
   }
 };
 
+/// A base class that provides a reference count for intrusive pointers. The
+/// count is atomic so that threads can share immutable objects, such as the
+/// index statements in the kernel caches.
 template <class Data>
 class Manageable {
+public:
+  Manageable() {}
+  Manageable(const Manageable&) {}
+  Manageable& operator=(const Manageable&) { return *this; }
+
+private:
   friend void acquire(const Data *data) { ++data->ref; }
   friend void release(const Data *data) { if (--data->ref == 0) delete data; }
 
-  mutable long ref = 0;
+  mutable std::atomic<long> ref{0};
 };
 
 }} // namespace simit::util
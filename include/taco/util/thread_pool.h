@@ -0,0 +1,57 @@
+#ifndef TACO_UTIL_THREAD_POOL_H
+#define TACO_UTIL_THREAD_POOL_H
+
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include "taco/util/uncopyable.h"
+
+namespace taco {
+namespace util {
+
+/// A fixed number of worker threads that run submitted tasks in the order they
+/// were submitted. Tasks that are still queued when the pool is destroyed are
+/// run before the workers are joined.
+class ThreadPool : public Uncopyable {
+public:
+  /// Create a pool with `numThreads` workers (at least one).
+  explicit ThreadPool(size_t numThreads);
+  ~ThreadPool();
+
+  /// Queue a task, returning a future that holds its result or the exception
+  /// it threw.
+  template <typename Task>
+  std::future<typename std::result_of<Task()>::type> submit(Task task) {
+    typedef typename std::result_of<Task()>::type Result;
+    auto packaged = std::make_shared<std::packaged_task<Result()>>(task);
+    std::future<Result> result = packaged->get_future();
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      tasks.push([packaged]() { (*packaged)(); });
+    }
+    available.notify_one();
+    return result;
+  }
+
+  /// The number of worker threads.
+  size_t getNumThreads() const;
+
+private:
+  std::vector<std::thread> workers;
+  std::queue<std::function<void()>> tasks;
+  std::mutex mutex;
+  std::condition_variable available;
+  bool stopping;
+
+  void work();
+};
+
+}}
+#endif
@@ -515,9 +515,8 @@ def _from_matrix(inp_mat, copy, csr):
     if not inp_mat.has_sorted_indices:
         matrix = inp_mat.sorted_indices()
 
-    indptr, indices, data = matrix.indptr, matrix.indices, matrix.data
-    shape = matrix.shape
-    return tensor._fromCppTensor(_cm.fromSpMatrix(indptr, indices, data, shape, copy, csr))
+    fmt = _cm.csr if csr else _cm.csc
+    return from_arrays(matrix.shape, fmt, [(), (matrix.indptr, matrix.indices)], matrix.data, copy)
 
 
 def from_sp_csr(matrix, copy=True):
@@ -532,7 +531,8 @@ def from_sp_csr(matrix, copy=True):
         A sparse scipy matrix to use to initialize the tensor.
 
     copy: boolean, optional
-        If true, taco copies the data from scipy and stores it. Otherwise, taco points to the same data as scipy.
+        If true, taco copies the data from scipy and stores it. Otherwise, taco points to the same data as scipy,
+        whether its indices are 32 or 64 bit integers.
 
     Returns
     --------
@@ -555,7 +555,8 @@ def from_sp_csc(matrix, copy=True):
         A sparse scipy matrix to use to initialize the tensor.
 
     copy: boolean, optional
-        If true, taco copies the data from scipy and stores it. Otherwise, taco points to the same data as scipy.
+        If true, taco copies the data from scipy and stores it. Otherwise, taco points to the same data as scipy,
+        whether its indices are 32 or 64 bit integers.
 
     Returns
     --------
@@ -696,13 +697,28 @@ def to_array(t):
     return np.array(t.to_dense(), copy=True)
 
 
+def _shares_layout(t, fmt):
+    return t.format.mode_formats == fmt.mode_formats and t.format.mode_ordering == fmt.mode_ordering
+
+
+def _to_sp_matrix(t, fmt, matrix_type):
+    if t.order != 2:
+        raise ValueError("Must be a matrix to convert to scipy")
+
+    if not _shares_layout(t, fmt):
+        t = remove_explicit_zeros(t, fmt)
+    levels, data = to_arrays(t)
+    indptr, indices = levels[1]
+    return matrix_type((data, indices, indptr), shape=t.shape, copy=False)
+
+
 def to_sp_csr(t):
     """
 
     Converts a taco tensor to a scipy csr_matrix.
 
-    Takes a matrix from taco in any format and converts the matrix to a scipy sparse csr matrix. This method removes
-    explicit zeros from the original taco tensor during the conversion.
+    Takes a matrix from taco in any format and converts the matrix to a scipy sparse csr matrix. Matrices stored in
+    any other format are converted to CSR first, which removes their explicit zeros.
 
     Parameters
     -----------
@@ -713,17 +729,17 @@ def to_sp_csr(t):
 
     Notes
     -------
-    The data and index values are always copied when making the scipy sparse array
+    If t is already stored as CSR, the scipy matrix shares its data and index arrays instead of copying them, and
+    explicit zeros are kept.
 
 
     Returns
     ---------
     matrix: scipy.sparse.csr_matrix
-        A matrix containing a copy of the data from the original order 2 tensor t.
+        A matrix containing the data from the original order 2 tensor t.
 
     """
-    arrs = _cm.to_sp_matrix(t._tensor, True)
-    return csr_matrix((arrs[2], arrs[1], arrs[0]), shape=t.shape)
+    return _to_sp_matrix(t, _cm.csr, csr_matrix)
 
 
 def to_sp_csc(t):
@@ -731,8 +747,8 @@ def to_sp_csc(t):
 
     Converts a taco tensor to a scipy csc_matrix.
 
-    Takes a matrix from taco in any format and converts the matrix to a scipy sparse csc matrix. This method removes
-    explicit zeros from the original taco tensor during the conversion.
+    Takes a matrix from taco in any format and converts the matrix to a scipy sparse csc matrix. Matrices stored in
+    any other format are converted to CSC first, which removes their explicit zeros.
 
     Parameters
     -----------
@@ -743,17 +759,170 @@ def to_sp_csc(t):
 
     Notes
     -------
-    The data and index values are always copied when making the scipy sparse array
+    If t is already stored as CSC, the scipy matrix shares its data and index arrays instead of copying them, and
+    explicit zeros are kept.
 
 
     Returns
     ---------
     matrix: scipy.sparse.csc_matrix
-        A matrix containing a copy of the data from the original order 2 tensor t.
+        A matrix containing the data from the original order 2 tensor t.
 
 """
-    arrs = _cm.to_sp_matrix(t._tensor, False)
-    return csc_matrix((arrs[2], arrs[1], arrs[0]), shape=t.shape)
+    return _to_sp_matrix(t, _cm.csc, csc_matrix)
+
+
+def from_arrays(shape, fmt, levels, values, copy=False):
+    """
+    Assembles a tensor from the numpy arrays of its levels.
+
+    The levels are given in the order the format stores them: dense levels store no arrays, compressed levels store a
+    ``(pos, crd)`` pair and singleton levels a ``(crd,)`` tuple. Values are stored in the order of the last level. The
+    index arrays may have any integer dtype, which becomes part of the format of the tensor.
+
+    Parameters
+    -----------
+    shape: iterable of ints
+        The dimensions of the tensor.
+
+    fmt: :class:`~pytaco.format`
+        The format the arrays are laid out in, for example :attr:`~pytaco.csr` or :func:`~pytaco.coo`.
+
+    levels: iterable of tuples of numpy.array
+        The index arrays of every level.
+
+    values: numpy.array
+        The values of the tensor. Its dtype becomes the dtype of the tensor.
+
+    copy: boolean, optional
+        If false, taco points to the same data as the arrays and keeps them alive, unless they are not contiguous.
+        Otherwise, taco copies them.
+
+    Examples
+    ----------
+    >>> import numpy as np
+    >>> import pytaco as pt
+    >>> pos, crd = np.array([0, 2]), np.array([0, 1])
+    >>> t = pt.from_arrays([2, 3], pt.coo(2), [(pos, crd), (np.array([2, 0]),)], np.array([1.0, 2.0]))
+    >>> t[1, 0]
+    2.0
+
+    Returns
+    --------
+    t: tensor
+        A tensor stored in fmt.
+    """
+    levels = [tuple(level) for level in levels]
+    return tensor.from_tensor_base(_cm.from_arrays(list(shape), fmt, levels, values, copy))
+
+
+def to_arrays(t):
+    """
+    Returns the numpy arrays that store a tensor.
+
+    The arrays are laid out as :func:`from_arrays` takes them and are views of the storage of the tensor, which they
+    keep alive. The tensor is computed first if needed.
+
+    Parameters
+    -----------
+    t: tensor
+        A taco tensor stored in dense, compressed and singleton levels.
+
+    Warnings
+    ---------
+    Inserting into the tensor or computing it again replaces its storage, so the views keep showing the old data.
+
+    Returns
+    ---------
+    levels: list of tuples of numpy.array
+        The index arrays of every level.
+
+    values: numpy.array
+        The values of the tensor.
+    """
+    t = as_tensor(t, copy=False)
+    levels, values = _cm.to_arrays(t._tensor)
+    return list(levels), values
+
+
+def _is_pydata_sparse(obj, name):
+    return type(obj).__name__ == name and type(obj).__module__.split('.')[0] == 'sparse'
+
+
+def from_sparse(array, copy=False):
+    """
+    Converts a pydata/sparse COO or GCXS array to a tensor.
+
+    COO arrays become tensors in the :func:`~pytaco.coo` format and two dimensional GCXS arrays CSR or CSC tensors.
+    GCXS arrays of other orders are converted to COO first.
+
+    Parameters
+    -----------
+    array: sparse.COO, sparse.GCXS
+        The array to convert.
+
+    copy: boolean, optional
+        If false, taco points to the same coordinates and data as the array. COO arrays that are not sorted or have
+        duplicates are always copied.
+
+    Returns
+    --------
+    t: tensor
+        A tensor holding the components of the array.
+    """
+    if _is_pydata_sparse(array, 'GCXS'):
+        if array.ndim == 2:
+            fmt = _cm.csr if tuple(array.compressed_axes) == (0,) else _cm.csc
+            return from_arrays(array.shape, fmt, [(), (array.indptr, array.indices)], array.data, copy)
+        array = array.tocoo()
+
+    if not _is_pydata_sparse(array, 'COO'):
+        raise ValueError("Expected a sparse.COO or sparse.GCXS array but got {}".format(type(array)))
+
+    if not array.sorted or array.has_duplicates:
+        array = array.copy()
+        array.sum_duplicates()
+        copy = False
+
+    coords = array.coords
+    pos = np.array([0, coords.shape[1]], dtype=coords.dtype)
+    levels = [(pos, coords[0])] + [(coords[i],) for i in range(1, array.ndim)]
+    return from_arrays(array.shape, _cm.coo(array.ndim), levels, array.data, copy)
+
+
+def to_sparse(t):
+    """
+    Converts a tensor to a pydata/sparse array.
+
+    CSR and CSC matrices become GCXS arrays that share their arrays with the tensor. Other tensors are converted to
+    the :func:`~pytaco.coo` format, which removes their explicit zeros, and become COO arrays.
+
+    Parameters
+    -----------
+    t: tensor
+        A taco tensor of order 1 or more.
+
+    Returns
+    ---------
+    array: sparse.GCXS, sparse.COO
+        An array holding the components of the tensor.
+    """
+    import sparse
+
+    t = as_tensor(t, copy=False)
+    if t.order == 2:
+        for fmt, compressed_axes in ((_cm.csr, (0,)), (_cm.csc, (1,))):
+            if _shares_layout(t, fmt):
+                levels, data = to_arrays(t)
+                indptr, indices = levels[1]
+                return sparse.GCXS((data, indices, indptr), shape=tuple(t.shape), compressed_axes=compressed_axes)
+
+    coo = _cm.coo(t.order)
+    if not _shares_layout(t, coo):
+        t = remove_explicit_zeros(t, coo)
+    levels, data = to_arrays(t)
+    coords = np.stack([level[-1] for level in levels])
+    return sparse.COO(coords, data, shape=tuple(t.shape), sorted=True, has_duplicates=False)
 
 
 def as_tensor(obj, copy=True):
@@ -803,6 +972,9 @@ def as_tensor(obj, copy=True):
     if isinstance(obj, csr_matrix):
         return from_sp_csr(obj, copy)
 
+    if _is_pydata_sparse(obj, 'COO') or _is_pydata_sparse(obj, 'GCXS'):
+        return from_sparse(obj, copy)
+
     # Try converting object to numpy array. This will ignore the copy flag
     arr = np.array(obj)
     return from_array(arr, True)
@@ -83,6 +83,15 @@ PyTaco currently exports the following mode formats:
 
 :attr:`~pytaco.dense` or :attr:`~pytaco.Dense` - Store all elements in dimension. eg. The first mode (dimension) in CSR
 
+:attr:`~pytaco.singleton` or :attr:`~pytaco.Singleton` - Store one coordinate for every element of the parent
+dimension. eg. The second mode (dimension) in COO
+
+:attr:`~pytaco.hashed` or :attr:`~pytaco.Hashed` - Store the non-zeros of every element of the parent dimension in a
+hash table. eg. The second mode (dimension) of a matrix product with random row insertions
+
+:attr:`~pytaco.bitmap` or :attr:`~pytaco.Bitmap` - Store all elements in dimension with a byte per element marking the
+non-zeros. eg. The second mode (dimension) of a matrix with medium density rows
+
 
 Explicit 0s resulting from computation are always stored even though a mode is marked as compressed. This is to avoid
 checking every result from a computation which would slow down taco.
@@ -125,6 +134,12 @@ Returns a string identifying the mode format. This will either be 'compressed' o
   m.attr("compressed") = taco::ModeFormat::Compressed;
   m.attr("Dense") = taco::ModeFormat::Dense;
   m.attr("dense") = taco::ModeFormat::Dense;
+  m.attr("Singleton") = taco::ModeFormat::Singleton;
+  m.attr("singleton") = taco::ModeFormat::Singleton;
+  m.attr("Hashed") = taco::ModeFormat::Hashed;
+  m.attr("hashed") = taco::ModeFormat::Hashed;
+  m.attr("Bitmap") = taco::ModeFormat::Bitmap;
+  m.attr("bitmap") = taco::ModeFormat::Bitmap;
 }
 
 void defineModeFormatPack(py::module& m){
@@ -193,6 +208,8 @@ PyTaco exports the following common formats:
 
 :attr:`~pytaco.csc` or :attr:`~pytaco.CSC` - Compressed Sparse Columns storage format.
 
+:func:`~pytaco.coo` - Coordinate storage format of a given order.
+
 Attributes
 -----------
 order
@@ -297,6 +314,36 @@ False
 >>> pt.is_dense(my_fmt)
 True
 
+)//");
+  m.def("coo", [](int order, bool isUnique, bool isOrdered) -> taco::Format {
+    if(order < 1) {
+      throw py::value_error("COO formats must have at least one mode.");
+    }
+    return taco::COO(order, isUnique, isOrdered);
+  }, py::arg("order"), py::arg("is_unique") = true, py::arg("is_ordered") = true, R"//(
+coo(order, is_unique=True, is_ordered=True)
+
+Creates a coordinate (COO) format that stores the coordinates of every component of an order `order` tensor.
+
+Parameters
+-------------
+    order: int
+    is_unique: bool, optional
+        Whether every coordinate is stored at most once.
+    is_ordered: bool, optional
+        Whether the coordinates are sorted lexicographically.
+
+Returns
+---------
+pytaco.format
+    A compressed first mode followed by order - 1 singleton modes.
+
+Examples
+------------
+>>> import pytaco as pt
+>>> pt.coo(3).order
+3
+
 )//");
   m.attr("CSR") = CSR;
   m.attr("csr") = CSR;
@@ -8,6 +8,8 @@
 
 #include "taco/type.h"
 #include "taco/tensor.h"
+#include "taco/storage/index.h"
+#include "taco/storage/array.h"
 
 // Add Python dictionary initializer with {tuple(coordinate) : data} pairs
 
@@ -89,116 +91,196 @@ static Tensor<T> fromNumpyC(py::array_t<T, py::array::c_style | py::array::force
   return fromNpArr<T>(array_buffer, fmt, copy);
 }
 
-template<typename IdxType, typename T>
-static Tensor<T> fromSpMatrix(py::array_t<IdxType> &ind_ptr, py::array_t<IdxType> &inds, py::array_t<T> &data,
-                               const std::vector<int> &dims, bool copy, bool CSR){
-
-  py::buffer_info ind_ptr_buf = ind_ptr.request();
-  py::buffer_info inds_buf = inds.request();
-  py::buffer_info data_buf = data.request();
+static Datatype toDatatype(const py::dtype& dtype) {
+  const int bits = (int)dtype.itemsize() * 8;
+  switch (dtype.kind()) {
+    case 'b': return Bool;
+    case 'i': return Int(bits);
+    case 'u': return UInt(bits);
+    case 'f':
+      if(bits == 32 || bits == 64) {
+        return Float(bits);
+      }
+      break;
+    default: break;
+  }
+  std::ostringstream o;
+  o << "Unsupported array dtype " << std::string(py::repr(dtype));
+  throw py::value_error(o.str());
+}
 
-  if(ind_ptr_buf.ndim != 1 || inds_buf.ndim != 1 || data_buf.ndim != 1) {
-    throw py::value_error("Data arrays must be 1D.");
+static py::dtype toNumpyDtype(Datatype type) {
+  switch (type.getKind()) {
+    case Datatype::Bool: return py::dtype::of<bool>();
+    case Datatype::UInt8: return py::dtype::of<uint8_t>();
+    case Datatype::UInt16: return py::dtype::of<uint16_t>();
+    case Datatype::UInt32: return py::dtype::of<uint32_t>();
+    case Datatype::UInt64: return py::dtype::of<uint64_t>();
+    case Datatype::Int8: return py::dtype::of<int8_t>();
+    case Datatype::Int16: return py::dtype::of<int16_t>();
+    case Datatype::Int32: return py::dtype::of<int32_t>();
+    case Datatype::Int64: return py::dtype::of<int64_t>();
+    case Datatype::Float32: return py::dtype::of<float>();
+    case Datatype::Float64: return py::dtype::of<double>();
+    default: break;
   }
+  std::ostringstream o;
+  o << "Arrays of type " << type << " cannot be exported to numpy";
+  throw py::value_error(o.str());
+}
 
-  IdxType *mat_ptr  = static_cast<IdxType *>(ind_ptr_buf.ptr);
-  IdxType *mat_ind  = static_cast<IdxType *>(inds_buf.ptr);
-  T *mat_data = static_cast<T *>(data_buf.ptr);
-  Array::Policy policy = Array::Policy::UserOwns;
+// Wraps a 1D numpy array in a taco array. Unless a copy is requested or the array is not contiguous, the taco array
+// points to the numpy data and keeps the numpy array alive.
+static Array fromNumpyArray(py::array array, bool copy) {
+  if(array.ndim() != 1) {
+    throw py::value_error("Level and value arrays must be 1D.");
+  }
+  if(!(array.flags() & py::array::c_style)) {
+    array = py::array(py::module::import("numpy").attr("ascontiguousarray")(array));
+    copy = false;
+  }
 
+  const Datatype type = toDatatype(array.dtype());
+  const size_t size = array.size();
   if(copy){
-    mat_ptr = new IdxType[ind_ptr_buf.size];
-    mat_ind = new IdxType[inds_buf.size];
-    mat_data = new T[data_buf.size];
-    memcpy(mat_ptr, ind_ptr_buf.ptr, ind_ptr_buf.size*ind_ptr_buf.itemsize);
-    memcpy(mat_ind, inds_buf.ptr, inds_buf.size * inds_buf.itemsize);
-    memcpy(mat_data, data_buf.ptr, data_buf.size * data_buf.itemsize);
-    policy = Array::Policy::Delete;
+    Array result = makeArray(type, size);
+    memcpy(result.getData(), array.data(), size * array.itemsize());
+    return result;
   }
 
-  // Create CSR Matrix
-  Tensor<T> tensor;
-  if(CSR){
-    tensor = makeCSR(util::uniqueName("csr"), dims, mat_ptr, mat_ind, mat_data, policy);
-  } else{
-    tensor = makeCSC(util::uniqueName("csc"), dims, mat_ptr, mat_ind, mat_data, policy);
-  }
+  // Arrays may be released by kernels running without the GIL
+  std::shared_ptr<void> owner(new py::object(array), [](void *p) {
+      py::gil_scoped_acquire acquire;
+      delete static_cast<py::object *>(p);
+  });
+  return Array(type, const_cast<void *>(array.data()), size, owner);
+}
 
-  return tensor;
+// Returns a numpy view of the first `size` elements of a taco array. The view keeps `owner` alive.
+static py::array toNumpyArray(const Array& array, size_t size, const py::capsule& owner) {
+  const py::dtype dtype = toNumpyDtype(array.getType());
+  const ssize_t stride = dtype.itemsize();
+  return py::array(dtype, {(ssize_t)size}, {stride}, array.getData(), owner);
 }
 
-template<typename T>
-static py::tuple toSpMatrix(Tensor<T> &tensor, bool tocsr) {
+static bool fitsCoordinates(Datatype crdType, int dimension) {
+  const int valueBits = crdType.getNumBits() - (crdType.isInt() ? 1 : 0);
+  return valueBits >= 31 || dimension <= (1 << valueBits);
+}
 
-  if(tensor.getOrder() != 2) {
-    throw py::value_error("Must be a matrix to convert to scipy");
-  }
+// Assembles a tensor from the arrays of its levels, in storage order: nothing for dense levels, (pos, crd) for
+// compressed levels and (crd,) for singleton levels. The index types of the format are taken from the arrays.
+static TensorBase fromArrays(const std::vector<int> &dims, Format format,
+                             const std::vector<std::vector<py::array>> &levels, py::array vals, bool copy) {
 
-  // Force computation of the tensor
-  tensor.pack();
-  if(tensor.needsCompute()){
-    tensor.evaluate();
+  const int order = format.getOrder();
+  if((size_t)order != dims.size() || (size_t)order != levels.size()) {
+    throw py::value_error("The shape, format and level arrays must have the same order.");
   }
 
-  int *ptr, *idx;
-  T* vals;
-  size_t ptr_arr_size, idx_arr_size, val_arr_size;
+  std::vector<ModeIndex> modeIndices;
+  std::vector<std::vector<Datatype>> levelArrayTypes;
+  size_t size = 1;
+  for(int i = 0; i < order; ++i) {
+    const ModeFormat modeFormat = format.getModeFormats()[i];
+    const int dimension = dims[format.getModeOrdering()[i]];
+    std::vector<Array> arrays;
+    for(const py::array &array : levels[i]) {
+      arrays.push_back(fromNumpyArray(array, copy));
+      const Datatype type = arrays.back().getType();
+      if(!type.isInt() && !type.isUInt()) {
+        throw py::value_error("Index arrays must hold integers.");
+      }
+    }
 
-  // We may get a matrix in any format so we copy into a new tensor. Also we remove any explicit 0s before
-  // moving to the scipy representation since the scipy contructor from dense arrays seems to do this as well.
-  Tensor<T> t(tensor.getDimensions(), tocsr? CSR: CSC);
+    if(modeFormat.getName() == Dense.getName()) {
+      if(!arrays.empty()) {
+        throw py::value_error("Dense levels do not store arrays.");
+      }
+      modeIndices.push_back(ModeIndex({makeArray({dimension})}));
+      levelArrayTypes.push_back({Int32});
+      size *= dimension;
+    } else if(modeFormat.getName() == Sparse.getName()) {
+      if(arrays.size() != 2 || arrays[0].getSize() != size + 1) {
+        throw py::value_error("Compressed levels store a pos array with one more element than the positions of "
+                              "their parent level, and a crd array.");
+      }
+      size = arrays[0].get(size).getAsIndex();
+      if(arrays[1].getSize() < size) {
+        throw py::value_error("The crd array of a compressed level is shorter than its pos array requires.");
+      }
+      modeIndices.push_back(ModeIndex(arrays));
+      levelArrayTypes.push_back({arrays[0].getType(), arrays[1].getType()});
+    } else if(modeFormat.getName() == Singleton.getName()) {
+      if(arrays.size() != 1 || arrays[0].getSize() < size) {
+        throw py::value_error("Singleton levels store a crd array with an element for every position of their "
+                              "parent level.");
+      }
+      levelArrayTypes.push_back({Int32, arrays[0].getType()});
+      modeIndices.push_back(ModeIndex({makeArray(levelArrayTypes.back()[0], 0), arrays[0]}));
+    } else {
+      throw py::value_error("Only dense, compressed and singleton levels can be assembled from arrays.");
+    }
 
-  for (auto& value : tensor) {
-    if (value.second != 0) {
-      t.insert(value.first.toVector(), value.second);
+    if(modeFormat.getName() != Dense.getName() && !fitsCoordinates(levelArrayTypes.back().back(), dimension)) {
+      throw py::value_error("The crd array of a level cannot hold the coordinates of its mode.");
     }
   }
-  t.pack();
 
-  if(tocsr){
-    getCSRArrays(t, &ptr, &idx, &vals);
-  }else {
-    getCSCArrays(t, &ptr, &idx, &vals);
+  Array values = fromNumpyArray(vals, copy);
+  if(values.getSize() < size) {
+    throw py::value_error("The values array is shorter than the level arrays require.");
   }
 
-  // Could return these arrays without the memcpy. Would need to get the data pointers and change the
-  // taco policies to UserOwn but would need to check the old policy to ensure that we free the right
-  // way in general in the py capsules below. This code works so left with the double copy for now.
-  auto index = t.getStorage().getIndex();
-  ptr_arr_size = index.getModeIndex(1).getIndexArray(0).getSize();
-  idx_arr_size = index.getModeIndex(1).getIndexArray(1).getSize();
-  val_arr_size = t.getStorage().getValues().getSize();
-
-
-  int *np_ptr = new int[ptr_arr_size];
-  int *np_idx = new int[idx_arr_size];
-  T   *np_vals   = new T[val_arr_size];
-
-  memcpy(np_ptr, ptr, ptr_arr_size*sizeof(int));
-  memcpy(np_idx, idx, idx_arr_size*sizeof(int));
-  memcpy(np_vals, vals, val_arr_size*sizeof(T));
-
-  py::capsule free_ptr(np_ptr, [](void *f) {
-      int *p = static_cast<int *>(f);
-      delete[] p;
-  });
+  format.setLevelArrayTypes(levelArrayTypes);
+  TensorBase tensor(values.getType(), dims, format);
+  TensorStorage storage = tensor.getStorage();
+  storage.setIndex(Index(format, modeIndices));
+  storage.setValues(values);
+  tensor.setStorage(storage);
+  return tensor;
+}
 
-  py::capsule free_idx(np_idx, [](void *f) {
-      int *p = static_cast<int *>(f);
-      delete[] p;
-  });
+// Returns the level arrays and values of a tensor as numpy views, in the layout fromArrays takes. The views keep the
+// storage of the tensor alive.
+static py::tuple toArrays(TensorBase &tensor) {
+  {
+    py::gil_scoped_release release;
+    tensor.pack();
+    if(tensor.needsCompute()){
+      tensor.evaluate();
+    }
+  }
 
-  py::capsule free_vals(np_vals, [](void *f) {
-      T *p = static_cast<T *>(f);
-      delete[] p;
+  const TensorStorage &storage = tensor.getStorage();
+  py::capsule owner(new TensorStorage(storage), [](void *p) {
+      delete static_cast<TensorStorage *>(p);
   });
 
-  py::array_t<int> ptr_arr({ptr_arr_size}, {sizeof(int)}, np_ptr, free_ptr);
-  py::array_t<int> idx_arr({idx_arr_size}, {sizeof(int)}, np_idx, free_idx);
-  py::array_t<T> val_arr({val_arr_size}, {sizeof(T)}, np_vals, free_vals);
-
-  return py::make_tuple(ptr_arr, idx_arr, val_arr);
+  // Index arrays may have spare capacity, so the views only cover the positions in use
+  const Format &format = storage.getFormat();
+  const Index index = storage.getIndex();
+  py::list levels;
+  size_t size = 1;
+  for(int i = 0; i < format.getOrder(); ++i) {
+    const std::string name = format.getModeFormats()[i].getName();
+    const ModeIndex &modeIndex = index.getModeIndex(i);
+    if(name == Dense.getName()) {
+      levels.append(py::tuple());
+      size *= tensor.getDimension(format.getModeOrdering()[i]);
+    } else if(name == Sparse.getName()) {
+      const Array &pos = modeIndex.getIndexArray(0);
+      py::array posView = toNumpyArray(pos, size + 1, owner);
+      size = pos.get(size).getAsIndex();
+      levels.append(py::make_tuple(posView, toNumpyArray(modeIndex.getIndexArray(1), size, owner)));
+    } else if(name == Singleton.getName()) {
+      levels.append(py::make_tuple(toNumpyArray(modeIndex.getIndexArray(1), size, owner)));
+    } else {
+      throw py::value_error("Only dense, compressed and singleton levels can be exported as arrays.");
+    }
+  }
 
+  return py::make_tuple(levels, toNumpyArray(storage.getValues(), size, owner));
 }
 
 template<typename CType, typename idxVar>
@@ -295,13 +377,9 @@ static void declareTensor(py::module &m, const std::string typestr) {
 
   using typedTensor = Tensor<CType>;
 
-  m.def("to_sp_matrix", &toSpMatrix<CType>);
-
   m.def("fromNpF", &fromNumpyF<CType>);
   m.def("fromNpC", &fromNumpyC<CType>);
 
-  m.def("fromSpMatrix", &fromSpMatrix<int, CType>);
-
   std::string pyClassName = std::string("Tensor") + typestr;
   py::class_<typedTensor, TensorBase>(m, pyClassName.c_str(), py::buffer_protocol())
 
@@ -329,9 +407,12 @@ static void declareTensor(py::module &m, const std::string typestr) {
               }
 
               // Force computation of the tensor
-              t.pack();
-              if(t.needsCompute()){
-                t.evaluate();
+              {
+                py::gil_scoped_release release;
+                t.pack();
+                if(t.needsCompute()){
+                  t.evaluate();
+                }
               }
 
               void *ptr = t.getStorage().getValues().getData();
@@ -376,16 +457,17 @@ static void declareTensor(py::module &m, const std::string typestr) {
 
           .def("format", &TensorBase::getFormat)
 
-          .def("pack", &typedTensor::pack)
+          // Packing, compiling and running kernels release the GIL so that other Python threads can run meanwhile
+          .def("pack", &typedTensor::pack, py::call_guard<py::gil_scoped_release>())
 
           // only bind .compile(), not .compile(IndexStmt, bool)
-          .def("compile", [](typedTensor &self) { self.compile(); } )
+          .def("compile", [](typedTensor &self) { self.compile(); }, py::call_guard<py::gil_scoped_release>())
 
-          .def("assemble", &typedTensor::assemble)
+          .def("assemble", &typedTensor::assemble, py::call_guard<py::gil_scoped_release>())
 
-          .def("evaluate", &typedTensor::evaluate)
+          .def("evaluate", &typedTensor::evaluate, py::call_guard<py::gil_scoped_release>())
 
-          .def("compute", &typedTensor::compute)
+          .def("compute", &typedTensor::compute, py::call_guard<py::gil_scoped_release>())
 
           .def("insert", &insert<CType>)
 
@@ -485,6 +567,9 @@ void defineTensor(py::module &m) {
   py::class_<TensorBase>(m, "TensorBase")
           .def("dtype", &TensorBase::getComponentType);
 
+  m.def("from_arrays", &fromArrays);
+  m.def("to_arrays", &toArrays);
+
   declareTensor<bool>(m, "Bool");
   declareTensor<int8_t>(m, "Int8");
   declareTensor<int16_t>(m, "Int16");
@@ -11,10 +11,10 @@ static Tensor<double> tensorRead(std::string filename, T modeType, bool pack = t
 
 void defineIOFuncs(py::module &m){
   m.def("_read", tensorRead<Format>, py::arg("filename"), py::arg("format").noconvert(),
-          py::arg("pack")=true);
+          py::arg("pack")=true, py::call_guard<py::gil_scoped_release>());
 
   m.def("_read", tensorRead<ModeFormat>, py::arg("filename"), py::arg("modeType").noconvert(),
-          py::arg("pack")=true);
+          py::arg("pack")=true, py::call_guard<py::gil_scoped_release>());
 
   m.def("_write",[](std::string s, TensorBase& t) -> void {
     // force tensor evaluation
@@ -23,7 +23,7 @@ void defineIOFuncs(py::module &m){
       t.evaluate();
     }
     write(s, t);
-  }, py::arg("filename"), py::arg("tensor").noconvert());
+  }, py::arg("filename"), py::arg("tensor").noconvert(), py::call_guard<py::gil_scoped_release>());
 }
 
 }}
@@ -108,6 +108,21 @@ class TestIO(unittest.TestCase):
         for ten, arr in zip(tens, arrs):
             self.assertTrue(np.array_equal(ten.to_array(), arr))
 
+    def test_arrays_are_shared(self):
+        csr = csr_matrix(np.array([[1, 0, 2], [0, 0, 3]], dtype=np.float64))
+        csr.indices = csr.indices.astype(np.int64)
+        csr.indptr = csr.indptr.astype(np.int64)
+        t = pt.from_sp_csr(csr, copy=False)
+        levels, vals = pt.to_arrays(t)
+        self.assertEqual(levels[1][1].__array_interface__['data'][0], csr.indices.__array_interface__['data'][0])
+        self.assertEqual(vals.__array_interface__['data'][0], csr.data.__array_interface__['data'][0])
+        self.assertEqual((t.to_sp_csr() != csr).nnz, 0)
+
+        pos, crd = np.array([0, 3]), np.array([0, 1, 1])
+        coo = pt.from_arrays([2, 3], pt.coo(2), [(pos, crd), (np.array([2, 0, 2]),)], np.array([1., 2., 3.]))
+        self.assertEqual(coo[1, 2], 3.)
+        self.assertTrue(np.array_equal(coo.to_array(), [[0, 0, 1], [2, 0, 3]]))
+
     def test_iterator(self):
         in_components = [([0, 1], 1.0), ([2, 2], 2.0), ([2, 3], 3.0), ([4, 0], 4.0)]
         A = pt.tensor([5, 5], pt.csr)
@@ -0,0 +1,586 @@
+#include "taco/autotuner.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <future>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <numeric>
+#include <sstream>
+#include <thread>
+
+#include "taco/error.h"
+#include "taco/index_notation/index_notation_nodes.h"
+#include "taco/index_notation/index_notation_rewriter.h"
+#include "taco/index_notation/provenance_graph.h"
+#include "taco/index_notation/transformations.h"
+#include "taco/util/collections.h"
+#include "taco/util/env.h"
+#include "taco/util/strings.h"
+
+using namespace std;
+
+namespace taco {
+
+typedef std::chrono::steady_clock Clock;
+
+// struct TuningSchedule
+bool operator==(const TuningSchedule& a, const TuningSchedule& b) {
+  return a.loopOrder == b.loopOrder && a.chunkSize == b.chunkSize &&
+         a.parallel == b.parallel &&
+         a.outputRaceStrategy == b.outputRaceStrategy &&
+         a.unrollFactor == b.unrollFactor;
+}
+
+bool operator!=(const TuningSchedule& a, const TuningSchedule& b) {
+  return !(a == b);
+}
+
+std::ostream& operator<<(std::ostream& os, const TuningSchedule& schedule) {
+  return os << "order=" << util::join(schedule.loopOrder, ",")
+            << " chunk=" << schedule.chunkSize
+            << " parallel=" << schedule.parallel
+            << " races="
+            << OutputRaceStrategy_NAMES[(int)schedule.outputRaceStrategy]
+            << " unroll=" << schedule.unrollFactor;
+}
+
+static OutputRaceStrategy parseOutputRaceStrategy(string name) {
+  for (auto strategy : {OutputRaceStrategy::IgnoreRaces,
+                        OutputRaceStrategy::NoRaces,
+                        OutputRaceStrategy::Atomics,
+                        OutputRaceStrategy::Temporary,
+                        OutputRaceStrategy::ParallelReduction,
+                        OutputRaceStrategy::ParallelAssembly}) {
+    if (name == OutputRaceStrategy_NAMES[(int)strategy]) {
+      return strategy;
+    }
+  }
+  taco_uerror << "Unknown output race strategy " << name;
+  return OutputRaceStrategy::NoRaces;
+}
+
+TuningSchedule parseTuningSchedule(string str) {
+  TuningSchedule schedule;
+  for (auto& field : util::split(str, " ")) {
+    if (field.empty()) {
+      continue;
+    }
+    const size_t separator = field.find('=');
+    taco_uassert(separator != string::npos) << "Malformed schedule " << str;
+    const string name = field.substr(0, separator);
+    const string value = field.substr(separator + 1);
+    if (name == "order") {
+      for (auto& position : util::split(value, ",")) {
+        if (!position.empty()) {
+          schedule.loopOrder.push_back(stoi(position));
+        }
+      }
+    } else if (name == "chunk") {
+      schedule.chunkSize = stoi(value);
+    } else if (name == "parallel") {
+      schedule.parallel = stoi(value) != 0;
+    } else if (name == "races") {
+      schedule.outputRaceStrategy = parseOutputRaceStrategy(value);
+    } else if (name == "unroll") {
+      schedule.unrollFactor = stoi(value);
+    } else {
+      taco_uerror << "Unknown schedule field " << name;
+    }
+  }
+  return schedule;
+}
+
+/// Returns the index variables of the outermost directly nested foralls.
+static vector<IndexVar> getOuterLoops(IndexStmt stmt) {
+  if (isa<SuchThat>(stmt)) {
+    stmt = to<SuchThat>(stmt).getStmt();
+  }
+  vector<IndexVar> loops;
+  while (isa<Forall>(stmt)) {
+    loops.push_back(to<Forall>(stmt).getIndexVar());
+    stmt = to<Forall>(stmt).getStmt();
+  }
+  return loops;
+}
+
+/// True if the loops visit the levels of every tensor in the order they are
+/// stored, for pairs of levels where one of the levels can not be located
+/// into (or, for results, inserted into). The lowerer requires this, but the
+/// reorder transformation does not check it.
+static bool isConcordant(IndexStmt stmt, const vector<IndexVar>& order,
+                         string* reason) {
+  map<IndexVar,size_t> positions;
+  for (size_t k = 0; k < order.size(); k++) {
+    positions.insert({order[k], k});
+  }
+
+  vector<pair<Access,bool>> accesses;
+  for (auto& access : getResultAccesses(stmt).first) {
+    accesses.push_back({access, true});
+  }
+  for (auto& access : getArgumentAccesses(stmt)) {
+    accesses.push_back({access, false});
+  }
+  for (auto& access : accesses) {
+    const Format format = access.first.getTensorVar().getFormat();
+    const vector<ModeFormat> modeFormats = format.getModeFormats();
+    const vector<int> modeOrdering = format.getModeOrdering();
+    const vector<IndexVar>& indexVars = access.first.getIndexVars();
+    auto isConstrained = [&](size_t level) {
+      return access.second ? !modeFormats[level].hasInsert()
+                           : !modeFormats[level].hasLocate();
+    };
+    for (size_t first = 0; first < modeFormats.size(); first++) {
+      for (size_t second = first + 1; second < modeFormats.size(); second++) {
+        if (!isConstrained(first) && !isConstrained(second)) {
+          continue;
+        }
+        const IndexVar firstVar = indexVars[modeOrdering[first]];
+        const IndexVar secondVar = indexVars[modeOrdering[second]];
+        if (util::contains(positions, firstVar) &&
+            util::contains(positions, secondVar) &&
+            positions.at(firstVar) > positions.at(secondVar)) {
+          *reason = "The loop order iterates over " +
+                    access.first.getTensorVar().getName() +
+                    " out of the order of its levels";
+          return false;
+        }
+      }
+    }
+  }
+  return true;
+}
+
+/// Split like IndexStmt::split, but return an undefined statement and a
+/// reason if the split is illegal.
+static IndexStmt splitLoop(IndexStmt stmt, IndexVar i, IndexVar i0,
+                           IndexVar i1, size_t splitFactor, string* reason) {
+  IndexVarRel rel = IndexVarRel(new SplitRelNode(i, i0, i1, splitFactor));
+  stmt = Transformation(AddSuchThatPredicates({rel})).apply(stmt, reason);
+  if (!stmt.defined()) {
+    return IndexStmt();
+  }
+  return Transformation(ForAllReplace({i}, {i0, i1})).apply(stmt, reason);
+}
+
+IndexStmt applySchedule(IndexStmt stmt, const TuningSchedule& schedule,
+                        string* reason) {
+  string ignored;
+  if (reason == nullptr) {
+    reason = &ignored;
+  }
+
+  const vector<IndexVar> loops = getOuterLoops(stmt);
+  if (loops.empty()) {
+    *reason = "The statement has no loops to schedule";
+    return IndexStmt();
+  }
+
+  vector<IndexVar> order = loops;
+  if (!schedule.loopOrder.empty()) {
+    vector<int> positions = schedule.loopOrder;
+    sort(positions.begin(), positions.end());
+    vector<int> identity(loops.size());
+    iota(identity.begin(), identity.end(), 0);
+    if (positions != identity) {
+      *reason = "The loop order " + util::join(schedule.loopOrder, ",") +
+                " is not a permutation of the statement's " +
+                util::toString(loops.size()) + " outer loops";
+      return IndexStmt();
+    }
+    for (size_t k = 0; k < loops.size(); k++) {
+      order[k] = loops[schedule.loopOrder[k]];
+    }
+    if (order != loops) {
+      if (!isConcordant(stmt, order, reason)) {
+        return IndexStmt();
+      }
+      stmt = Reorder(order).apply(stmt, reason);
+      if (!stmt.defined()) {
+        return IndexStmt();
+      }
+    }
+  }
+
+  IndexVar outer = order.front();
+  IndexVar inner = order.back();
+  if (schedule.parallel && schedule.chunkSize > 0) {
+    // The parallelize transformation checks the results that a loop writes,
+    // which the loop over chunks does not write, so a chunked loop may only
+    // be parallelized if the loop it splits may be
+    if (!Parallelize(outer, ParallelUnit::CPUThread,
+                     schedule.outputRaceStrategy).apply(stmt, reason)
+        .defined()) {
+      return IndexStmt();
+    }
+  }
+  if (schedule.chunkSize > 0) {
+    IndexVar outer0(outer.getName() + "0"), outer1(outer.getName() + "1");
+    stmt = splitLoop(stmt, outer, outer0, outer1, schedule.chunkSize, reason);
+    if (!stmt.defined()) {
+      return IndexStmt();
+    }
+    if (inner == outer) {
+      inner = outer1;
+    }
+    outer = outer0;
+  }
+
+  if (schedule.parallel) {
+    stmt = Parallelize(outer, ParallelUnit::CPUThread,
+                       schedule.outputRaceStrategy).apply(stmt, reason);
+    if (!stmt.defined()) {
+      return IndexStmt();
+    }
+  }
+
+  if (schedule.unrollFactor > 0) {
+    // The lowerer only unrolls loops over derived variables, whose bounds it
+    // can guard, so the unrolled loop is the inner loop of a split
+    IndexVar inner0(inner.getName() + "0"), inner1(inner.getName() + "1");
+    stmt = splitLoop(stmt, inner, inner0, inner1, schedule.unrollFactor,
+                     reason);
+    if (!stmt.defined()) {
+      return IndexStmt();
+    }
+    stmt = stmt.unroll(inner1, schedule.unrollFactor);
+  }
+  return stmt;
+}
+
+/// Returns the statement that `TensorBase::compile` schedules, before its
+/// outer loop is parallelized.
+static IndexStmt makeTuningStmt(const TensorBase& tensor) {
+  IndexStmt stmt = makeConcreteNotation(tensor.getAssignment());
+  stmt = reorderLoopsTopologically(stmt);
+  return insertTemporaries(stmt);
+}
+
+/// Returns the floor of the base 2 logarithm of n, or 0 if n is 0.
+static int getMagnitude(size_t n) {
+  int magnitude = 0;
+  while (n > 1) {
+    n >>= 1;
+    magnitude++;
+  }
+  return magnitude;
+}
+
+/// Returns the key of the tensor's best schedule, which identifies the
+/// statement, the formats of the tensor and its operands, and the magnitudes
+/// of their dimensions and nonzeros.
+static string getTuningKey(IndexStmt stmt, const TensorBase& tensor) {
+  vector<TensorBase> tensors = {tensor};
+  util::append(tensors, getOperands(tensor));
+
+  stringstream key;
+  key << isomorphicHash(stmt);
+  for (auto& t : tensors) {
+    key << " " << t.getFormat() << " [";
+    for (int dimension : t.getDimensions()) {
+      key << getMagnitude(dimension) << ",";
+    }
+    // The result has no nonzeros yet
+    const size_t nnz = (t == tensor) ? 0 : t.getStorage().getValues().getSize();
+    key << getMagnitude(nnz) << "]";
+  }
+  return key.str();
+}
+
+// The schedule database is a text file with one "<key>\t<schedule>" line per
+// key. Updates rewrite the file, and are serialized within the process.
+static std::mutex databaseMutex;
+
+static string getDatabasePath(const AutotuneOptions& options) {
+  return options.databasePath.empty()
+         ? util::getFromEnv("TACO_AUTOTUNE_DB", "")
+         : options.databasePath;
+}
+
+static map<string,string> readDatabase(string path) {
+  map<string,string> entries;
+  ifstream file(path);
+  string line;
+  while (getline(file, line)) {
+    const size_t separator = line.find('\t');
+    if (separator != string::npos) {
+      entries[line.substr(0, separator)] = line.substr(separator + 1);
+    }
+  }
+  return entries;
+}
+
+static void writeDatabase(string path, string key,
+                          const TuningSchedule& schedule) {
+  std::lock_guard<std::mutex> lock(databaseMutex);
+  map<string,string> entries = readDatabase(path);
+  entries[key] = util::toString(schedule);
+
+  // Write a temporary file and rename it, so that processes that read the
+  // database concurrently see either the old or the new entries
+  const string tmpPath = path + ".tmp";
+  {
+    ofstream file(tmpPath);
+    taco_uassert(file.good()) << "Could not write " << tmpPath;
+    for (auto& entry : entries) {
+      file << entry.first << "\t" << entry.second << "\n";
+    }
+  }
+  taco_uassert(rename(tmpPath.c_str(), path.c_str()) == 0)
+      << "Could not write " << path;
+}
+
+/// Returns the candidate schedules of the first round of the search: every
+/// loop order, each run serially and in parallel over every chunk size. The
+/// unroll factors are searched in a second round from the best of these,
+/// since loop orders and parallelization matter the most.
+static vector<TuningSchedule>
+getOrderCandidates(IndexStmt stmt, const AutotuneOptions& options) {
+  const size_t numLoops = getOuterLoops(stmt).size();
+  vector<int> order(numLoops);
+  iota(order.begin(), order.end(), 0);
+
+  // Every permutation of short loop nests is tried, and only the given order
+  // of long ones, which have too many permutations
+  vector<vector<int>> orders;
+  do {
+    orders.push_back(order);
+  } while (numLoops <= 4 && next_permutation(order.begin(), order.end()));
+
+  vector<int> chunkSizes = {0};
+  util::append(chunkSizes, options.chunkSizes);
+
+  vector<TuningSchedule> candidates;
+  for (auto& loopOrder : orders) {
+    TuningSchedule schedule;
+    if (loopOrder != orders.front()) {
+      schedule.loopOrder = loopOrder;
+    }
+    // The parallel, unchunked schedule comes first, since it is what
+    // TensorBase::compile applies when it can
+    for (int chunkSize : chunkSizes) {
+      schedule.parallel = true;
+      schedule.chunkSize = chunkSize;
+      candidates.push_back(schedule);
+    }
+    schedule.parallel = false;
+    schedule.chunkSize = 0;
+    candidates.push_back(schedule);
+  }
+  return candidates;
+}
+
+namespace {
+/// A schedule that is being compiled for timing.
+struct Trial {
+  TuningSchedule schedule;
+  IndexStmt stmt;
+  TensorBase tensor;
+  shared_future<void> compiled;
+};
+}
+
+/// Returns a new tensor that computes the same expression as the given one.
+static TensorBase makeTrialTensor(const TensorBase& tensor) {
+  TensorBase trial(tensor.getName(), tensor.getComponentType(),
+                   tensor.getDimensions(), tensor.getFormat());
+  Assignment assignment = tensor.getAssignment();
+  trial(assignment.getLhs().getIndexVars()) = assignment.getRhs();
+  return trial;
+}
+
+static double getSecondsSince(Clock::time_point begin) {
+  return std::chrono::duration<double>(Clock::now() - begin).count();
+}
+
+/// Returns the seconds it takes the compiled trial tensor to assemble and
+/// compute its expression.
+static double runTrial(TensorBase& trial) {
+  auto begin = Clock::now();
+  trial.assemble();
+  trial.compute();
+  return getSecondsSince(begin);
+}
+
+namespace {
+/// Compiles and times candidate schedules of a statement.
+class Search {
+public:
+  Search(const TensorBase& tensor, IndexStmt stmt,
+         const AutotuneOptions& options)
+      : tensor(tensor), stmt(stmt), options(options), begin(Clock::now()),
+        bestSeconds(numeric_limits<double>::infinity()) {
+    const unsigned threads = std::thread::hardware_concurrency();
+    batchSize = (threads > 0) ? threads : 1;
+  }
+
+  /// Time the candidates that are not timed yet, in batches that are
+  /// compiled concurrently, until the time budget is spent.
+  void run(const vector<TuningSchedule>& candidates) {
+    vector<TuningSchedule> untimed;
+    for (auto& candidate : candidates) {
+      if (!util::contains(timed, candidate)) {
+        untimed.push_back(candidate);
+      }
+    }
+
+    for (size_t start = 0; start < untimed.size(); start += batchSize) {
+      if (best.defined() && getSecondsSince(begin) > options.timeBudget) {
+        return;
+      }
+      const size_t end = std::min(untimed.size(), start + batchSize);
+      vector<Trial> trials;
+      for (size_t k = start; k < end; k++) {
+        timed.push_back(untimed[k]);
+        Trial trial;
+        if (startTrial(untimed[k], &trial)) {
+          trials.push_back(trial);
+        }
+      }
+      for (auto& trial : trials) {
+        finishTrial(trial);
+      }
+    }
+  }
+
+  /// The fastest schedule, and the statement that it schedules.
+  TuningSchedule bestSchedule;
+  IndexStmt best;
+
+private:
+  const TensorBase& tensor;
+  IndexStmt stmt;
+  const AutotuneOptions& options;
+  Clock::time_point begin;
+  size_t batchSize;
+
+  vector<TuningSchedule> timed;
+  double bestSeconds;
+
+  /// Schedule the statement and start compiling it for a new trial tensor.
+  /// Returns false if the schedule is illegal.
+  bool startTrial(TuningSchedule schedule, Trial* trial) {
+    string reason;
+    IndexStmt scheduled = applySchedule(stmt, schedule, &reason);
+    if (!scheduled.defined() && schedule.parallel) {
+      // Parallel loops that write to the same result components need atomics
+      schedule.outputRaceStrategy = OutputRaceStrategy::Atomics;
+      scheduled = applySchedule(stmt, schedule, &reason);
+    }
+    if (!scheduled.defined()) {
+      return false;
+    }
+
+    trial->schedule = schedule;
+    trial->stmt = scheduled;
+    trial->tensor = makeTrialTensor(tensor);
+    try {
+      trial->compiled = trial->tensor.compileAsync(getTrialStmt(*trial));
+    } catch (const TacoException&) {
+      // The lowerer does not support every legal schedule
+      return false;
+    }
+    return true;
+  }
+
+  /// Wait for the trial's kernels to compile and time them.
+  void finishTrial(Trial& trial) {
+    double seconds = numeric_limits<double>::infinity();
+    try {
+      trial.compiled.get();
+      seconds = runTrial(trial.tensor);
+      for (int k = 1; k < options.repetitions; k++) {
+        // Later runs get the compiled kernels from the kernel cache
+        TensorBase repetition = makeTrialTensor(tensor);
+        repetition.compile(getTrialStmt(trial, repetition));
+        seconds = std::min(seconds, runTrial(repetition));
+      }
+    } catch (const TacoException&) {
+      return;
+    }
+    if (seconds < bestSeconds) {
+      bestSeconds = seconds;
+      bestSchedule = trial.schedule;
+      best = trial.stmt;
+    }
+  }
+
+  /// Returns the trial's statement, computing the given trial tensor.
+  IndexStmt getTrialStmt(const Trial& trial, const TensorBase& result) const {
+    map<TensorVar,TensorVar> substitutions = {{tensor.getTensorVar(),
+                                               result.getTensorVar()}};
+    return replace(trial.stmt, substitutions);
+  }
+
+  IndexStmt getTrialStmt(const Trial& trial) const {
+    return getTrialStmt(trial, trial.tensor);
+  }
+};
+}
+
+IndexStmt autotune(TensorBase& tensor, const AutotuneOptions& options) {
+  taco_uassert(tensor.getAssignment().defined())
+      << error::compile_without_expr;
+  return autotune(tensor, makeTuningStmt(tensor), options);
+}
+
+IndexStmt autotune(TensorBase& tensor, IndexStmt stmt,
+                   const AutotuneOptions& options) {
+  Assignment assignment = tensor.getAssignment();
+  taco_uassert(assignment.defined()) << error::compile_without_expr;
+  taco_uassert(!assignment.getOperator().defined())
+      << "Compound assignments can not be autotuned";
+  taco_uassert(options.repetitions > 0)
+      << "Schedules must be timed at least once";
+
+  // The nonzeros of the operands are part of the key
+  for (auto& operand : getOperands(tensor)) {
+    if (operand.needsPack()) {
+      operand.pack();
+    }
+  }
+
+  const string databasePath = getDatabasePath(options);
+  const string key = getTuningKey(stmt, tensor);
+  if (!databasePath.empty()) {
+    map<string,string> entries;
+    {
+      std::lock_guard<std::mutex> lock(databaseMutex);
+      entries = readDatabase(databasePath);
+    }
+    if (util::contains(entries, key)) {
+      IndexStmt scheduled = applySchedule(stmt,
+                                          parseTuningSchedule(entries.at(key)));
+      if (scheduled.defined()) {
+        tensor.compile(scheduled);
+        return scheduled;
+      }
+    }
+  }
+
+  Search search(tensor, stmt, options);
+  search.run(getOrderCandidates(stmt, options));
+  if (search.best.defined()) {
+    vector<TuningSchedule> unrolled;
+    for (int unrollFactor : options.unrollFactors) {
+      TuningSchedule schedule = search.bestSchedule;
+      schedule.unrollFactor = unrollFactor;
+      unrolled.push_back(schedule);
+    }
+    search.run(unrolled);
+  }
+  taco_uassert(search.best.defined())
+      << "None of the candidate schedules of " << stmt << " could be compiled";
+
+  if (!databasePath.empty()) {
+    writeDatabase(databasePath, key, search.bestSchedule);
+  }
+  tensor.compile(search.best);
+  return search.best;
+}
+
+}
@@ -20,6 +20,7 @@ const std::string stateName = "state";
 const std::string bufSizeName = "__bufsize__";
 const std::string bufCapacityCopyName = "__bufcapcopy__";
 const std::string labelPrefix = "resume_";
+const std::string allocatorName = "__allocator__";
 
 
 shared_ptr<CodeGen> CodeGen::init_default(std::ostream &dest, OutputKind outputKind) {
@@ -222,7 +223,7 @@ string CodeGen::printTensorProperty(string varname, const GetProperty* op, bool
     ret << tp << " " << varname;
   } else {
     taco_iassert(op->property == TensorProperty::Indices);
-    tp = "int*" + star;
+    tp = printType(op->type, true) + star;
     ret << tp << " " << varname;
   }
 
@@ -257,10 +258,10 @@ string CodeGen::unpackTensorProperty(string varname, const GetProperty* op,
         << "->dimensions[" << op->mode << "]);\n";
   } else {
     taco_iassert(op->property == TensorProperty::Indices);
-    tp = "int*";
+    tp = printType(op->type, true);
     auto nm = op->index;
     ret << tp << " " << restrictKeyword() << " " << varname << " = ";
-    ret << "(int*)(" << tensor->name << "->indices[" << op->mode;
+    ret << "(" << tp << ")(" << tensor->name << "->indices[" << op->mode;
     ret << "][" << nm << "]);\n";
   }
 
@@ -574,6 +575,11 @@ string CodeGen::printFuncName(const Function *func,
     }
   }
 
+  // CUDA kernels allocate unified memory themselves
+  if (codeGenType == C) {
+    ret << delimiter << "taco_allocator_t *" << allocatorName;
+  }
+
   ret << ")";
   return ret.str();
 }
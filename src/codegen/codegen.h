@@ -8,6 +8,9 @@
 namespace taco {
 namespace ir {
 
+/// The name of the taco_allocator_t parameter that generated C functions
+/// allocate memory through (see taco/taco_allocator_t.h).
+extern const std::string allocatorName;
 
 class CodeGen : public IRPrinter {
 public:
@@ -23,7 +23,11 @@ namespace {
 // stdlib.h for malloc/realloc
 // math.h for sqrt
 // MIN preprocessor macro
-// This *must* be kept in sync with taco_tensor_t.h
+// TACO_SIMD_CLONES to compile functions with vectorized loops for several
+// instruction sets, which are dispatched on at load time
+// The runtime functions are static, so that the code of many modules can be
+// linked into one program (see Module::compileToStaticLibrary).
+// This *must* be kept in sync with taco_tensor_t.h and taco_allocator_t.h
 const string cHeaders =
   "#ifndef TACO_C_HEADERS\n"
   "#define TACO_C_HEADERS\n"
@@ -37,6 +41,15 @@ const string cHeaders =
   "#define TACO_MIN(_a,_b) ((_a) < (_b) ? (_a) : (_b))\n"
   "#define TACO_MAX(_a,_b) ((_a) > (_b) ? (_a) : (_b))\n"
   "#define TACO_DEREF(_a) (((___context___*)(*__ctx__))->_a)\n"
+  "#if defined(__x86_64__) && defined(__has_attribute)\n"
+  "#if __has_attribute(target_clones)\n"
+  "#define TACO_SIMD_CLONES \\\n"
+  "  __attribute__((target_clones(\"arch=skylake-avx512\",\"arch=haswell\",\"default\")))\n"
+  "#endif\n"
+  "#endif\n"
+  "#ifndef TACO_SIMD_CLONES\n"
+  "#define TACO_SIMD_CLONES\n"
+  "#endif\n"
   "#ifndef TACO_TENSOR_T_DEFINED\n"
   "#define TACO_TENSOR_T_DEFINED\n"
   "typedef enum { taco_mode_dense, taco_mode_sparse } taco_mode_t;\n"
@@ -51,10 +64,33 @@ const string cHeaders =
   "  int32_t      vals_size;     // values array size\n"
   "} taco_tensor_t;\n"
   "#endif\n"
-  "int cmp(const void *a, const void *b) {\n"
+  "#ifndef TACO_ALLOCATOR_T_DEFINED\n"
+  "#define TACO_ALLOCATOR_T_DEFINED\n"
+  "typedef struct {\n"
+  "  void* (*allocate)(void* state, size_t size);\n"
+  "  void* (*reallocate)(void* state, void* ptr, size_t old_size, size_t size);\n"
+  "  void  (*deallocate)(void* state, void* ptr);\n"
+  "  void*   state;       // passed to the functions, e.g. an arena\n"
+  "} taco_allocator_t;\n"
+  "#endif\n"
+  "static void* taco_alloc(taco_allocator_t* allocator, size_t size) {\n"
+  "  return allocator ? allocator->allocate(allocator->state, size) : malloc(size);\n"
+  "}\n"
+  "static void* taco_realloc(taco_allocator_t* allocator, void* ptr, size_t old_size, size_t size) {\n"
+  "  return allocator ? allocator->reallocate(allocator->state, ptr, old_size, size)\n"
+  "                   : realloc(ptr, size);\n"
+  "}\n"
+  "static void taco_free(taco_allocator_t* allocator, void* ptr) {\n"
+  "  if (allocator) {\n"
+  "    allocator->deallocate(allocator->state, ptr);\n"
+  "  } else {\n"
+  "    free(ptr);\n"
+  "  }\n"
+  "}\n"
+  "static int cmp(const void *a, const void *b) {\n"
   "  return *((const int*)a) - *((const int*)b);\n"
   "}\n"
-  "int taco_binarySearchAfter(int *array, int arrayStart, int arrayEnd, int target) {\n"
+  "static int taco_binarySearchAfter(int *array, int arrayStart, int arrayEnd, int target) {\n"
   "  if (array[arrayStart] >= target) {\n"
   "    return arrayStart;\n"
   "  }\n"
@@ -75,7 +111,7 @@ const string cHeaders =
   "  }\n"
   "  return upperBound;\n"
   "}\n"
-  "int taco_binarySearchBefore(int *array, int arrayStart, int arrayEnd, int target) {\n"
+  "static int taco_binarySearchBefore(int *array, int arrayStart, int arrayEnd, int target) {\n"
   "  if (array[arrayEnd] <= target) {\n"
   "    return arrayEnd;\n"
   "  }\n"
@@ -96,9 +132,9 @@ const string cHeaders =
   "  }\n"
   "  return lowerBound;\n"
   "}\n"
-  "taco_tensor_t* init_taco_tensor_t(int32_t order, int32_t csize,\n"
-  "                                  int32_t* dimensions, int32_t* mode_ordering,\n"
-  "                                  taco_mode_t* mode_types) {\n"
+  "static taco_tensor_t* init_taco_tensor_t(int32_t order, int32_t csize,\n"
+  "                                         int32_t* dimensions, int32_t* mode_ordering,\n"
+  "                                         taco_mode_t* mode_types) {\n"
   "  taco_tensor_t* t = (taco_tensor_t *) malloc(sizeof(taco_tensor_t));\n"
   "  t->order         = order;\n"
   "  t->dimensions    = (int32_t *) malloc(order * sizeof(int32_t));\n"
@@ -121,7 +157,7 @@ const string cHeaders =
   "  }\n"
   "  return t;\n"
   "}\n"
-  "void deinit_taco_tensor_t(taco_tensor_t* t) {\n"
+  "static void deinit_taco_tensor_t(taco_tensor_t* t) {\n"
   "  for (int i = 0; i < t->order; i++) {\n"
   "    free(t->indices[i]);\n"
   "  }\n"
@@ -132,6 +168,115 @@ const string cHeaders =
   "  free(t);\n"
   "}\n"
   "#endif\n";
+
+// Checks whether the iterations of a vectorized loop are independent, so that
+// it can be annotated with `#pragma omp simd`. Unlike the clang loop hints,
+// that pragma is honored by GCC as well and lets compilers vectorize gathers
+// and reductions they can't prove to be safe. The loop must only assign
+// variables declared within it, store to locations that depend on such
+// variables, and update other variables as `v = v + e` (the reductions).
+class SimdLoopChecker : public IRVisitor {
+public:
+  bool independent = true;
+  vector<Expr> reductions;
+
+  SimdLoopChecker(const For* loop) {
+    innerVars.insert(loop->var);
+    loop->contents.accept(this);
+    for (auto& reduction : reductions) {
+      if (util::contains(reads, reduction)) {
+        independent = false;
+      }
+    }
+  }
+
+private:
+  set<Expr> innerVars;
+  set<Expr> reads;
+  bool readsInnerVar = false;
+
+  using IRVisitor::visit;
+
+  void visit(const Var* op) {
+    reads.insert(op);
+    if (util::contains(innerVars, op)) {
+      readsInnerVar = true;
+    }
+  }
+
+  void visit(const VarDecl* op) {
+    innerVars.insert(op->var);
+    op->rhs.accept(this);
+  }
+
+  void visit(const For* op) {
+    innerVars.insert(op->var);
+    IRVisitor::visit(op);
+  }
+
+  void visit(const Assign* op) {
+    independent &= !op->use_atomics && isa<Var>(op->lhs);
+    if (!independent || util::contains(innerVars, op->lhs)) {
+      op->rhs.accept(this);
+      return;
+    }
+
+    // Reductions are left out of the reads, so long as the update is their
+    // only use in the loop
+    const Add* add = op->rhs.as<Add>();
+    const Datatype type = op->lhs.type();
+    if (add == nullptr || add->a != op->lhs || type.isComplex() ||
+        op->lhs.as<Var>()->is_ptr) {
+      independent = false;
+      return;
+    }
+    add->b.accept(this);
+    if (!util::contains(reductions, op->lhs)) {
+      reductions.push_back(op->lhs);
+    }
+  }
+
+  void visit(const Store* op) {
+    independent &= !op->use_atomics;
+    readsInnerVar = false;
+    op->loc.accept(this);
+    independent &= readsInnerVar;
+    op->arr.accept(this);
+    op->data.accept(this);
+  }
+
+  void visit(const While*) {
+    independent = false;
+  }
+
+  void visit(const Break*) {
+    independent = false;
+  }
+
+  void visit(const Allocate*) {
+    independent = false;
+  }
+
+  void visit(const Yield*) {
+    independent = false;
+  }
+};
+
+static bool hasVectorizedLoops(const Function* func) {
+  struct VectorizedLoopFinder : public IRVisitor {
+    bool vectorized = false;
+
+    using IRVisitor::visit;
+
+    void visit(const For* op) {
+      vectorized |= (op->kind == LoopKind::Vectorized);
+      IRVisitor::visit(op);
+    }
+  };
+  VectorizedLoopFinder finder;
+  func->body.accept(&finder);
+  return finder.vectorized;
+}
 } // anonymous namespace
 
 // find variables for generating declarations
@@ -267,8 +412,13 @@ void CodeGen_C::visit(const Function* func) {
   FindVars outputVarFinder({}, func->outputs, this);
   func->body.accept(&outputVarFinder);
 
-  // output function declaration
+  // output function declaration, compiled for each vector instruction set
+  // that is dispatched on at runtime if it has vectorized loops
   doIndent();
+  if (outputKind == ImplementationGen && hasVectorizedLoops(func)) {
+    out << "TACO_SIMD_CLONES\n";
+    doIndent();
+  }
   out << printFuncName(func, inputVarFinder.varDecls, outputVarFinder.varDecls);
 
   // if we're just generating a header, this is all we need to do
@@ -359,6 +509,18 @@ static string genVectorizePragma(int width) {
   return ret.str();
 }
 
+static string getSimdPragma(int width, const vector<string>& reductions) {
+  stringstream ret;
+  ret << "#pragma omp simd";
+  if (width) {
+    ret << " simdlen(" << width << ")";
+  }
+  if (!reductions.empty()) {
+    ret << " reduction(+:" << util::join(reductions, ",") << ")";
+  }
+  return ret.str();
+}
+
 static string getParallelizePragma(LoopKind kind) {
   stringstream ret;
   ret << "#pragma omp parallel for schedule";
@@ -396,11 +558,22 @@ static string getAtomicPragma() {
 // http://clang.llvm.org/docs/LanguageExtensions.html#extensions-for-loop-hint-optimizations
 void CodeGen_C::visit(const For* op) {
   switch (op->kind) {
-    case LoopKind::Vectorized:
+    case LoopKind::Vectorized: {
       doIndent();
-      out << genVectorizePragma(op->vec_width);
+      SimdLoopChecker checker(op);
+      if (checker.independent) {
+        vector<string> reductions;
+        for (auto& reduction : checker.reductions) {
+          reductions.push_back(varMap[reduction]);
+        }
+        out << getSimdPragma(op->vec_width, reductions);
+      }
+      else {
+        out << genVectorizePragma(op->vec_width);
+      }
       out << "\n";
       break;
+    }
     case LoopKind::Static:
     case LoopKind::Dynamic:
     case LoopKind::Runtime:
@@ -510,12 +683,16 @@ void CodeGen_C::visit(const Allocate* op) {
   stream << elementType << "*";
   stream << ")";
   if (op->is_realloc) {
-    stream << "realloc(";
+    stream << "taco_realloc(" << allocatorName << ", ";
     op->var.accept(this);
+    stream << ", sizeof(" << elementType << ")";
+    stream << " * ";
+    parentPrecedence = MUL;
+    op->old_elements.accept(this);
     stream << ", ";
   }
   else {
-    stream << "malloc(";
+    stream << "taco_alloc(" << allocatorName << ", ";
   }
   stream << "sizeof(" << elementType << ")";
   stream << " * ";
@@ -526,6 +703,15 @@ void CodeGen_C::visit(const Allocate* op) {
     stream << endl;
 }
 
+void CodeGen_C::visit(const Free* op) {
+  doIndent();
+  stream << "taco_free(" << allocatorName << ", ";
+  parentPrecedence = Precedence::TOP;
+  op->var.accept(this);
+  stream << ");";
+  stream << endl;
+}
+
 void CodeGen_C::visit(const Sqrt* op) {
   taco_tassert(op->type.isFloat() && op->type.getNumBits() == 64) <<
       "Codegen doesn't currently support non-double sqrt";
@@ -585,6 +771,7 @@ void CodeGen_C::generateShim(const Stmt& func, stringstream &ret) {
     ret << delimiter << "(" << cast_type << ")(parameterPack[" << i++ << "])";
     delimiter = ", ";
   }
+  ret << delimiter << "(taco_allocator_t*)(parameterPack[" << i++ << "])";
   ret << ");\n";
   ret << "}\n";
 }
@@ -38,6 +38,7 @@ protected:
   void visit(const Min*);
   void visit(const Max*);
   void visit(const Allocate*);
+  void visit(const Free*);
   void visit(const Sqrt*);
   void visit(const Store*);
   void visit(const Assign*);
@@ -0,0 +1,1561 @@
+#include "codegen_llvm.h"
+
+#include <mutex>
+#include <tuple>
+
+#include "llvm/ExecutionEngine/Orc/Core.h"
+#include "llvm/ExecutionEngine/Orc/ExecutionUtils.h"
+#include "llvm/ExecutionEngine/Orc/JITTargetMachineBuilder.h"
+#include "llvm/ExecutionEngine/Orc/LLJIT.h"
+#include "llvm/ExecutionEngine/Orc/ThreadSafeModule.h"
+#include "llvm/IR/IRBuilder.h"
+#include "llvm/IR/Intrinsics.h"
+#include "llvm/IR/LLVMContext.h"
+#include "llvm/IR/Module.h"
+#include "llvm/IR/Verifier.h"
+#include "llvm/Passes/PassBuilder.h"
+#include "llvm/Transforms/InstCombine/InstCombine.h"
+#include "llvm/Transforms/Scalar/EarlyCSE.h"
+#include "llvm/Transforms/Scalar/GVN.h"
+#include "llvm/Transforms/Scalar/IndVarSimplify.h"
+#include "llvm/Transforms/Scalar/LICM.h"
+#include "llvm/Transforms/Scalar/LoopPassManager.h"
+#include "llvm/Transforms/Scalar/SROA.h"
+#include "llvm/Transforms/Scalar/SimplifyCFG.h"
+#include "llvm/Support/TargetSelect.h"
+#include "llvm/Support/raw_ostream.h"
+#include "llvm/Target/TargetMachine.h"
+
+#include "taco/ir/ir_visitor.h"
+#include "taco/ir/simplify.h"
+#include "taco/taco_allocator_t.h"
+#include "taco/error.h"
+#include "taco/util/collections.h"
+
+using namespace std;
+
+namespace taco {
+namespace ir {
+
+namespace {
+
+// The runtime functions that lowered code may call. The C backend emits these
+// into every source file (see cHeaders in codegen_c.cpp); the JIT instead
+// binds their names to these host implementations.
+int binarySearchAfter(int *array, int arrayStart, int arrayEnd, int target) {
+  if (array[arrayStart] >= target) {
+    return arrayStart;
+  }
+  int lowerBound = arrayStart; // always < target
+  int upperBound = arrayEnd; // always >= target
+  while (upperBound - lowerBound > 1) {
+    int mid = (upperBound + lowerBound) / 2;
+    int midValue = array[mid];
+    if (midValue < target) {
+      lowerBound = mid;
+    }
+    else if (midValue > target) {
+      upperBound = mid;
+    }
+    else {
+      return mid;
+    }
+  }
+  return upperBound;
+}
+
+int binarySearchBefore(int *array, int arrayStart, int arrayEnd, int target) {
+  if (array[arrayEnd] <= target) {
+    return arrayEnd;
+  }
+  int lowerBound = arrayStart; // always <= target
+  int upperBound = arrayEnd; // always > target
+  while (upperBound - lowerBound > 1) {
+    int mid = (upperBound + lowerBound) / 2;
+    int midValue = array[mid];
+    if (midValue < target) {
+      lowerBound = mid;
+    }
+    else if (midValue > target) {
+      upperBound = mid;
+    }
+    else {
+      return mid;
+    }
+  }
+  return lowerBound;
+}
+
+void* allocate(taco_allocator_t* allocator, uint64_t size) {
+  return allocator ? allocator->allocate(allocator->state, size)
+                   : malloc(size);
+}
+
+void* reallocate(taco_allocator_t* allocator, void* ptr, uint64_t oldSize,
+                 uint64_t size) {
+  return allocator ? allocator->reallocate(allocator->state, ptr, oldSize, size)
+                   : realloc(ptr, size);
+}
+
+void deallocate(taco_allocator_t* allocator, void* ptr) {
+  if (allocator) {
+    allocator->deallocate(allocator->state, ptr);
+  } else {
+    free(ptr);
+  }
+}
+
+template <typename T>
+T check(llvm::Expected<T> expected) {
+  if (!expected) {
+    taco_uerror << "JIT compilation failed: "
+                << llvm::toString(expected.takeError());
+  }
+  return std::move(*expected);
+}
+
+void check(llvm::Error error) {
+  if (error) {
+    taco_uerror << "JIT compilation failed: " << llvm::toString(std::move(error));
+  }
+}
+
+void initializeLLVM() {
+  static once_flag initialized;
+  call_once(initialized, []() {
+    llvm::InitializeNativeTarget();
+    llvm::InitializeNativeTargetAsmPrinter();
+  });
+}
+
+// The key of a tensor property, as used by the C backend to declare a single
+// variable per distinct property.
+typedef tuple<Expr, TensorProperty, int, int> PropertyKey;
+
+PropertyKey getPropertyKey(const GetProperty* op) {
+  return PropertyKey(op->tensor, op->property, op->mode, op->index);
+}
+
+/// Checks whether a function only uses IR constructs the JIT can compile.
+class CheckSupported : public IRVisitor {
+public:
+  bool supported = true;
+
+  bool check(const Stmt& func) {
+    const Function* function = func.as<Function>();
+    for (auto& param : util::combine(function->outputs, function->inputs)) {
+      const Var* var = param.as<Var>();
+      if (var == nullptr || var->is_parameter ||
+          (!var->is_tensor && !var->is_ptr && var->type.isFloat())) {
+        return false;
+      }
+    }
+    func.accept(this);
+    return supported;
+  }
+
+protected:
+  using IRVisitor::visit;
+
+  void checkType(Datatype type) {
+    if (type.isComplex() || type.getKind() == Datatype::Int128 ||
+        type.getKind() == Datatype::UInt128) {
+      supported = false;
+    }
+  }
+
+  void visit(const Literal* op) {
+    checkType(op->type);
+  }
+
+  void visit(const Var* op) {
+    checkType(op->type);
+  }
+
+  void visit(const Cast* op) {
+    checkType(op->type);
+    op->a.accept(this);
+  }
+
+  void visit(const Call* op) {
+    checkType(op->type);
+    IRVisitor::visit(op);
+  }
+
+  void visit(const Load* op) {
+    checkType(op->type);
+    IRVisitor::visit(op);
+  }
+
+  // Without OpenMP the C backend's parallel and atomic pragmas are ignored, so
+  // parallel loops are compiled as serial loops.
+  void visit(const For* op) {
+#if USE_OPENMP
+    switch (op->kind) {
+      case LoopKind::Static:
+      case LoopKind::Dynamic:
+      case LoopKind::Runtime:
+      case LoopKind::Static_Chunked:
+        supported = false;
+        break;
+      default:
+        break;
+    }
+#endif
+    IRVisitor::visit(op);
+  }
+
+  void visit(const Store* op) {
+#if USE_OPENMP
+    if (op->use_atomics) {
+      supported = false;
+    }
+#endif
+    IRVisitor::visit(op);
+  }
+
+  void visit(const Assign* op) {
+#if USE_OPENMP
+    if (op->use_atomics) {
+      supported = false;
+    }
+#endif
+    IRVisitor::visit(op);
+  }
+
+  void visit(const GetProperty* op) {
+    checkType(op->type);
+    if (op->property != TensorProperty::Values &&
+        op->property != TensorProperty::ValuesSize &&
+        op->property != TensorProperty::Dimension &&
+        op->property != TensorProperty::Indices) {
+      supported = false;
+    }
+    IRVisitor::visit(op);
+  }
+};
+
+/// Finds the tensor properties that a function unpacks and the local variables
+/// that a coroutine must save across yields, in the same order as the C
+/// backend declares them.
+class FindVars : public IRVisitor {
+public:
+  vector<Expr> localVars;
+  vector<PropertyKey> properties;
+  map<PropertyKey, Datatype> propertyTypes;
+
+protected:
+  using IRVisitor::visit;
+
+  void visit(const VarDecl* op) {
+    if (!util::contains(localVars, op->var)) {
+      localVars.push_back(op->var);
+    }
+    op->rhs.accept(this);
+  }
+
+  void visit(const For* op) {
+    if (!util::contains(localVars, op->var)) {
+      localVars.push_back(op->var);
+    }
+    IRVisitor::visit(op);
+  }
+
+  void visit(const GetProperty* op) {
+    PropertyKey key = getPropertyKey(op);
+    if (!util::contains(properties, key)) {
+      properties.push_back(key);
+      propertyTypes.insert({key, op->type});
+    }
+  }
+};
+
+/// Returns the type that C converts both operands of a binary arithmetic or
+/// comparison operator to (the "usual arithmetic conversions").
+Datatype commonType(Datatype a, Datatype b) {
+  if (a.isFloat() || b.isFloat()) {
+    if (!a.isFloat()) return b;
+    if (!b.isFloat()) return a;
+    return (a.getNumBits() >= b.getNumBits()) ? a : b;
+  }
+
+  // integer promotion
+  auto promote = [](Datatype type) {
+    return (type.isBool() || type.getNumBits() < 32) ? Int32 : type;
+  };
+  a = promote(a);
+  b = promote(b);
+  if (a == b) {
+    return a;
+  }
+  if (a.isInt() == b.isInt()) {
+    return (a.getNumBits() >= b.getNumBits()) ? a : b;
+  }
+  Datatype signedType = a.isInt() ? a : b;
+  Datatype unsignedType = a.isInt() ? b : a;
+  return (unsignedType.getNumBits() >= signedType.getNumBits())
+         ? unsignedType : signedType;
+}
+
+/// Translates lowered functions to LLVM IR. The generated code mirrors the
+/// code that CodeGen_C emits: tensor properties are unpacked into locals when
+/// a function starts and output properties are packed back if the function
+/// allocates memory, expressions follow C conversion rules, and functions that
+/// yield are compiled to resumable coroutines with the same context layout
+/// semantics.
+class CodeGen_LLVM : public IRVisitorStrict {
+public:
+  CodeGen_LLVM(llvm::Module* module)
+      : context(module->getContext()), module(module), builder(context) {
+    llvm::FastMathFlags fastMath;
+    fastMath.setFast();
+    builder.setFastMathFlags(fastMath);
+
+    llvm::Type* int32Type = builder.getInt32Ty();
+    llvm::Type* int8PtrType = builder.getInt8PtrTy();
+    tensorType = llvm::StructType::create(context, {
+        int32Type,                                        // order
+        int32Type->getPointerTo(),                        // dimensions
+        int32Type,                                        // csize
+        int32Type->getPointerTo(),                        // mode_ordering
+        int32Type->getPointerTo(),                        // mode_types
+        int8PtrType->getPointerTo()->getPointerTo(),      // indices
+        int8PtrType,                                      // vals
+        int32Type                                         // vals_size
+      }, "taco_tensor_t");
+  }
+
+  void compile(Stmt stmt) {
+    const Function* func = stmt.as<Function>();
+    taco_iassert(func) << "Only functions can be compiled";
+    compileFunction(func);
+    compileShim(func);
+  }
+
+  /// Returns true if any compiled loop was scheduled for vectorization.
+  bool hasVectorizedLoops() const {
+    return vectorizedLoops;
+  }
+
+private:
+  llvm::LLVMContext& context;
+  llvm::Module* module;
+  llvm::IRBuilder<> builder;
+  llvm::StructType* tensorType;
+
+  // The value and the C type of the most recently visited expression.
+  // Pointer values carry their element type.
+  llvm::Value* value = nullptr;
+  Datatype valueType;
+
+  llvm::Function* function = nullptr;
+  llvm::BasicBlock* entryBlock = nullptr;
+  // The taco_allocator_t* that every function takes as its last parameter
+  llvm::Value* allocatorArg = nullptr;
+  map<Expr, llvm::AllocaInst*, ExprCompare> varSlots;
+  map<PropertyKey, llvm::AllocaInst*> propertySlots;
+
+  // The blocks that a Break in the enclosing loops jumps to. A Break is
+  // printed as `continue` by the C backend, so these are the loop latches.
+  vector<llvm::BasicBlock*> continueBlocks;
+
+  // Coroutine state
+  bool emittingCoroutine = false;
+  vector<Expr> localVars;
+  llvm::StructType* contextType = nullptr;
+  llvm::Value* contextArg = nullptr;
+  llvm::Value* coordsArg = nullptr;
+  llvm::Value* valArg = nullptr;
+  Datatype yieldType;
+  llvm::AllocaInst* bufSize = nullptr;
+  llvm::AllocaInst* bufCapacity = nullptr;
+  vector<llvm::BasicBlock*> resumeBlocks;
+  int labelCount = 0;
+
+  bool vectorizedLoops = false;
+
+  llvm::Type* getType(Datatype type) {
+    switch (type.getKind()) {
+      case Datatype::Bool:
+        return builder.getInt1Ty();
+      case Datatype::UInt8:
+      case Datatype::Int8:
+        return builder.getInt8Ty();
+      case Datatype::UInt16:
+      case Datatype::Int16:
+        return builder.getInt16Ty();
+      case Datatype::UInt32:
+      case Datatype::Int32:
+        return builder.getInt32Ty();
+      case Datatype::UInt64:
+      case Datatype::Int64:
+        return builder.getInt64Ty();
+      case Datatype::Float32:
+        return builder.getFloatTy();
+      case Datatype::Float64:
+        return builder.getDoubleTy();
+      default:
+        taco_ierror << "Type " << type << " is not supported by the JIT";
+        return nullptr;
+    }
+  }
+
+  // Booleans are stored as bytes in memory, like the C `bool` type.
+  llvm::Type* getMemoryType(Datatype type) {
+    return type.isBool() ? builder.getInt8Ty() : getType(type);
+  }
+
+  llvm::Type* getPointerType(Datatype type) {
+    return getMemoryType(type)->getPointerTo();
+  }
+
+  llvm::Type* getVarType(const Var* var) {
+    if (var->is_tensor) {
+      return tensorType->getPointerTo();
+    }
+    return var->is_ptr ? getPointerType(var->type) : getType(var->type);
+  }
+
+  llvm::Type* getPropertyType(TensorProperty property, Datatype type) {
+    switch (property) {
+      case TensorProperty::Values:
+      case TensorProperty::Indices:
+        return getPointerType(type);
+      default:
+        return builder.getInt32Ty();
+    }
+  }
+
+  llvm::BasicBlock* newBlock(string name) {
+    return llvm::BasicBlock::Create(context, name, function);
+  }
+
+  llvm::AllocaInst* createSlot(llvm::Type* type, string name) {
+    llvm::IRBuilder<> entryBuilder(entryBlock, entryBlock->begin());
+    return entryBuilder.CreateAlloca(type, nullptr, name);
+  }
+
+  llvm::AllocaInst* getSlot(const Expr& expr) {
+    if (const GetProperty* property = expr.as<GetProperty>()) {
+      PropertyKey key = getPropertyKey(property);
+      taco_iassert(propertySlots.count(key)) <<
+          "Property " << expr << " of " << property->tensor << " not found";
+      return propertySlots.at(key);
+    }
+    const Var* var = expr.as<Var>();
+    taco_iassert(var) << "Cannot assign to " << expr;
+    if (!varSlots.count(var)) {
+      varSlots.insert({var, createSlot(getVarType(var), var->name)});
+    }
+    return varSlots.at(var);
+  }
+
+  llvm::Value* codegen(const Expr& expr) {
+    expr.accept(this);
+    return value;
+  }
+
+  void codegen(const Stmt& stmt) {
+    if (stmt.defined()) {
+      stmt.accept(this);
+    }
+  }
+
+  /// Convert a value between C scalar types.
+  llvm::Value* convert(llvm::Value* val, Datatype from, Datatype to) {
+    if (from == to) {
+      return val;
+    }
+    llvm::Type* type = getType(to);
+    if (to.isBool()) {
+      return from.isFloat()
+             ? builder.CreateFCmpUNE(val, llvm::ConstantFP::get(val->getType(), 0.0))
+             : builder.CreateICmpNE(val, llvm::ConstantInt::get(val->getType(), 0));
+    }
+    if (from.isBool()) {
+      return to.isFloat() ? builder.CreateUIToFP(val, type)
+                          : builder.CreateZExt(val, type);
+    }
+    if (from.isFloat()) {
+      if (to.isFloat()) {
+        return builder.CreateFPCast(val, type);
+      }
+      return to.isInt() ? builder.CreateFPToSI(val, type)
+                        : builder.CreateFPToUI(val, type);
+    }
+    if (to.isFloat()) {
+      return from.isInt() ? builder.CreateSIToFP(val, type)
+                          : builder.CreateUIToFP(val, type);
+    }
+    return builder.CreateIntCast(val, type, from.isInt());
+  }
+
+  /// Convert a value to the type of the variable, property or array element
+  /// it is stored to.
+  llvm::Value* coerce(llvm::Value* val, Datatype from, llvm::Type* type,
+                      Datatype to) {
+    if (type->isPointerTy()) {
+      return val->getType()->isPointerTy()
+             ? builder.CreatePointerCast(val, type)
+             : builder.CreateIntToPtr(val, type);
+    }
+    val = convert(val, from, to);
+    if (to.isBool() && type != val->getType()) {
+      val = builder.CreateZExt(val, type);
+    }
+    return val;
+  }
+
+  void storeTo(const Expr& lhs, const Expr& rhs) {
+    llvm::AllocaInst* slot = getSlot(lhs);
+    llvm::Value* val = codegen(rhs);
+    builder.CreateStore(coerce(val, valueType, slot->getAllocatedType(),
+                               lhs.type()), slot);
+  }
+
+  llvm::Value* toBool(llvm::Value* val, Datatype type) {
+    return convert(val, type, Bool);
+  }
+
+  llvm::Value* getElementPtr(const Expr& arr, const Expr& loc, Datatype type) {
+    llvm::Value* ptr = builder.CreatePointerCast(codegen(arr),
+                                                 getPointerType(type));
+    llvm::Value* index = codegen(loc);
+    index = convert(index, valueType, valueType.isInt() ? Int64 : UInt64);
+    return builder.CreateInBoundsGEP(getMemoryType(type), ptr, index);
+  }
+
+  llvm::Value* loadTensorField(llvm::Value* tensor, unsigned field) {
+    llvm::Value* ptr = builder.CreateStructGEP(tensorType, tensor, field);
+    return builder.CreateLoad(tensorType->getElementType(field), ptr);
+  }
+
+  llvm::FunctionCallee getRuntimeFunction(string name, llvm::Type* result,
+                                          vector<llvm::Type*> args,
+                                          bool isVarArg=false) {
+    return module->getOrInsertFunction(name,
+        llvm::FunctionType::get(result, args, isVarArg));
+  }
+
+  llvm::Value* callMalloc(llvm::Value* size) {
+    return builder.CreateCall(getRuntimeFunction("malloc",
+        builder.getInt8PtrTy(), {builder.getInt64Ty()}), {size});
+  }
+
+  void callFree(llvm::Value* ptr) {
+    builder.CreateCall(getRuntimeFunction("free", builder.getVoidTy(),
+        {builder.getInt8PtrTy()}),
+        {builder.CreatePointerCast(ptr, builder.getInt8PtrTy())});
+  }
+
+  // Attach loop hints that correspond to the pragmas the C backend emits.
+  void addLoopMetadata(llvm::Instruction* latch, LoopKind kind, int vecWidth,
+                       size_t unrollFactor) {
+    vector<llvm::Metadata*> hints;
+    auto hint = [&](string name, llvm::Constant* val) {
+      hints.push_back(llvm::MDNode::get(context, {
+          llvm::MDString::get(context, name),
+          llvm::ConstantAsMetadata::get(val)}));
+    };
+    if (kind == LoopKind::Vectorized) {
+      vectorizedLoops = true;
+      hint("llvm.loop.vectorize.enable", builder.getTrue());
+      hint("llvm.loop.interleave.count", builder.getInt32(0));
+      if (vecWidth > 0) {
+        hint("llvm.loop.vectorize.width", builder.getInt32(vecWidth));
+      }
+    }
+    else if (unrollFactor > 0) {
+      hint("llvm.loop.unroll.count", builder.getInt32(unrollFactor));
+    }
+    if (hints.empty()) {
+      return;
+    }
+    hints.insert(hints.begin(), nullptr);
+    llvm::MDNode* loopID = llvm::MDNode::getDistinct(context, hints);
+    loopID->replaceOperandWith(0, loopID);
+    latch->setMetadata(llvm::LLVMContext::MD_loop, loopID);
+  }
+
+  void compileFunction(const Function* func) {
+    // The C backend simplifies function bodies while printing them.
+    Stmt body = func->body;
+    if (isa<Scope>(body)) {
+      body = to<Scope>(body)->scopedStmt;
+    }
+    body = simplify(body);
+
+    FindVars varFinder;
+    body.accept(&varFinder);
+
+    const auto returnType = func->getReturnType();
+    emittingCoroutine = (returnType.second != Datatype());
+    yieldType = returnType.second;
+
+    // Build the function signature
+    vector<Expr> params;
+    vector<llvm::Type*> paramTypes;
+    if (emittingCoroutine) {
+      paramTypes.push_back(builder.getInt8PtrTy()->getPointerTo());
+      paramTypes.push_back(builder.getInt8PtrTy());
+      paramTypes.push_back(getPointerType(yieldType));
+      paramTypes.push_back(builder.getInt32Ty()->getPointerTo());
+    }
+    for (auto& param : util::combine(func->outputs, func->inputs)) {
+      params.push_back(param);
+      paramTypes.push_back(getVarType(param.as<Var>()));
+    }
+    paramTypes.push_back(builder.getInt8PtrTy());
+    function = llvm::Function::Create(
+        llvm::FunctionType::get(builder.getInt32Ty(), paramTypes, false),
+        llvm::Function::ExternalLinkage, func->name, module);
+    function->addFnAttr(llvm::Attribute::NoUnwind);
+
+    varSlots.clear();
+    propertySlots.clear();
+    continueBlocks.clear();
+    entryBlock = newBlock("entry");
+    builder.SetInsertPoint(entryBlock);
+
+    auto arg = function->arg_begin();
+    if (emittingCoroutine) {
+      contextArg = &*arg++;
+      coordsArg = &*arg++;
+      valArg = &*arg++;
+      llvm::Value* bufCapacityArg = &*arg++;
+      bufSize = createSlot(builder.getInt32Ty(), "bufsize");
+      bufCapacity = createSlot(builder.getInt32Ty(), "bufcapcopy");
+      builder.CreateStore(builder.getInt32(0), bufSize);
+      builder.CreateStore(builder.CreateLoad(builder.getInt32Ty(),
+                                             bufCapacityArg), bufCapacity);
+    }
+    for (auto& param : params) {
+      llvm::Value* argValue = &*arg++;
+      argValue->setName(param.as<Var>()->name);
+      builder.CreateStore(argValue, getSlot(param));
+    }
+    allocatorArg = &*arg++;
+    allocatorArg->setName("allocator");
+
+    // Unpack the tensor properties
+    for (auto& key : varFinder.properties) {
+      const Var* tensor = get<0>(key).as<Var>();
+      taco_iassert(util::contains(params, get<0>(key))) <<
+          "Temporaries can not be unpacked";
+      llvm::Value* tensorValue = codegen(get<0>(key));
+      llvm::Type* type = getPropertyType(get<1>(key),
+                                         varFinder.propertyTypes.at(key));
+      llvm::Value* propertyValue = nullptr;
+      switch (get<1>(key)) {
+        case TensorProperty::Values:
+          propertyValue = builder.CreatePointerCast(
+              loadTensorField(tensorValue, 6), type);
+          break;
+        case TensorProperty::ValuesSize:
+          propertyValue = loadTensorField(tensorValue, 7);
+          break;
+        case TensorProperty::Dimension: {
+          llvm::Value* dims = loadTensorField(tensorValue, 1);
+          propertyValue = builder.CreateLoad(builder.getInt32Ty(),
+              builder.CreateConstInBoundsGEP1_32(builder.getInt32Ty(), dims,
+                                                 get<2>(key)));
+          break;
+        }
+        case TensorProperty::Indices: {
+          llvm::Type* int8PtrType = builder.getInt8PtrTy();
+          llvm::Value* indices = loadTensorField(tensorValue, 5);
+          llvm::Value* modeIndices = builder.CreateLoad(
+              int8PtrType->getPointerTo(),
+              builder.CreateConstInBoundsGEP1_32(int8PtrType->getPointerTo(),
+                                                 indices, get<2>(key)));
+          llvm::Value* index = builder.CreateLoad(int8PtrType,
+              builder.CreateConstInBoundsGEP1_32(int8PtrType, modeIndices,
+                                                 get<3>(key)));
+          propertyValue = builder.CreatePointerCast(index, type);
+          break;
+        }
+        default:
+          taco_ierror << "Unsupported tensor property";
+          break;
+      }
+      llvm::AllocaInst* slot = createSlot(type, tensor->name + "_property");
+      builder.CreateStore(propertyValue, slot);
+      propertySlots.insert({key, slot});
+    }
+
+    if (emittingCoroutine) {
+      compileCoroutineEntry(varFinder.localVars, countYields(func));
+    }
+
+    codegen(body);
+
+    // Pack output properties only if we allocated memory
+    if (checkForAlloc(func)) {
+      for (auto& key : varFinder.properties) {
+        if (!util::contains(func->outputs, get<0>(key))) {
+          continue;
+        }
+        llvm::Value* tensorValue = codegen(get<0>(key));
+        llvm::AllocaInst* slot = propertySlots.at(key);
+        llvm::Value* propertyValue =
+            builder.CreateLoad(slot->getAllocatedType(), slot);
+        switch (get<1>(key)) {
+          case TensorProperty::Values:
+            builder.CreateStore(
+                builder.CreatePointerCast(propertyValue, builder.getInt8PtrTy()),
+                builder.CreateStructGEP(tensorType, tensorValue, 6));
+            break;
+          case TensorProperty::ValuesSize:
+            builder.CreateStore(propertyValue,
+                builder.CreateStructGEP(tensorType, tensorValue, 7));
+            break;
+          case TensorProperty::Indices: {
+            llvm::Type* int8PtrType = builder.getInt8PtrTy();
+            llvm::Value* indices = loadTensorField(tensorValue, 5);
+            llvm::Value* modeIndices = builder.CreateLoad(
+                int8PtrType->getPointerTo(),
+                builder.CreateConstInBoundsGEP1_32(int8PtrType->getPointerTo(),
+                                                   indices, get<2>(key)));
+            builder.CreateStore(
+                builder.CreatePointerCast(propertyValue, int8PtrType),
+                builder.CreateConstInBoundsGEP1_32(int8PtrType, modeIndices,
+                                                   get<3>(key)));
+            break;
+          }
+          default:
+            break;
+        }
+      }
+    }
+
+    if (emittingCoroutine) {
+      compileCoroutineFinish();
+    }
+    builder.CreateRet(builder.getInt32(0));
+  }
+
+  static int countYields(const Function* func) {
+    struct CountYields : public IRVisitor {
+      int yields = 0;
+      using IRVisitor::visit;
+      void visit(const Yield*) {
+        yields++;
+      }
+    };
+    CountYields counter;
+    func->accept(&counter);
+    return counter.yields;
+  }
+
+  static bool checkForAlloc(const Function* func) {
+    struct CheckForAlloc : public IRVisitor {
+      bool hasAlloc = false;
+      using IRVisitor::visit;
+      void visit(const Allocate*) {
+        hasAlloc = true;
+      }
+    };
+    CheckForAlloc checker;
+    func->accept(&checker);
+    return checker.hasAlloc;
+  }
+
+  llvm::Value* getContext() {
+    llvm::Value* ctx = builder.CreateLoad(builder.getInt8PtrTy(), contextArg);
+    return builder.CreatePointerCast(ctx, contextType->getPointerTo());
+  }
+
+  llvm::Value* getContextField(llvm::Value* ctx, unsigned field) {
+    return builder.CreateStructGEP(contextType, ctx, field);
+  }
+
+  // Restores the saved locals and jumps to the yield a coroutine returned
+  // from, or allocates the context on the first call.
+  void compileCoroutineEntry(vector<Expr> locals, int numYields) {
+    localVars = locals;
+    labelCount = 0;
+
+    vector<llvm::Type*> fields = {builder.getInt32Ty(),   // size
+                                  builder.getInt32Ty()};  // state
+    for (auto& localVar : localVars) {
+      fields.push_back(getSlot(localVar)->getAllocatedType());
+    }
+    contextType = llvm::StructType::create(context, fields,
+                                           function->getName().str() + "_ctx");
+
+    resumeBlocks.clear();
+    for (int i = 0; i <= numYields; i++) {
+      resumeBlocks.push_back(newBlock("resume" + to_string(i)));
+    }
+
+    llvm::BasicBlock* resumeBlock = newBlock("resume");
+    llvm::BasicBlock* initBlock = newBlock("init");
+    llvm::BasicBlock* bodyBlock = newBlock("body");
+    llvm::Value* ctx = builder.CreateLoad(builder.getInt8PtrTy(), contextArg);
+    builder.CreateCondBr(builder.CreateIsNotNull(ctx), resumeBlock, initBlock);
+
+    builder.SetInsertPoint(resumeBlock);
+    llvm::Value* typedCtx = getContext();
+    for (size_t i = 0; i < localVars.size(); i++) {
+      llvm::AllocaInst* slot = getSlot(localVars[i]);
+      builder.CreateStore(builder.CreateLoad(slot->getAllocatedType(),
+                                             getContextField(typedCtx, i + 2)),
+                          slot);
+    }
+    llvm::Value* state = builder.CreateLoad(builder.getInt32Ty(),
+                                            getContextField(typedCtx, 1));
+    llvm::SwitchInst* resume = builder.CreateSwitch(state, bodyBlock,
+                                                    resumeBlocks.size());
+    for (size_t i = 0; i < resumeBlocks.size(); i++) {
+      resume->addCase(builder.getInt32(i), resumeBlocks[i]);
+    }
+
+    builder.SetInsertPoint(initBlock);
+    const uint64_t size =
+        module->getDataLayout().getTypeAllocSize(contextType).getFixedSize();
+    builder.CreateStore(callMalloc(builder.getInt64(size)), contextArg);
+    builder.CreateStore(builder.getInt32(size),
+                        getContextField(getContext(), 0));
+    builder.CreateBr(bodyBlock);
+
+    builder.SetInsertPoint(bodyBlock);
+  }
+
+  // Saves the locals and returns the number of buffered results, resuming at
+  // the given block on the next call.
+  void compileCoroutineReturn(int label) {
+    llvm::Value* ctx = getContext();
+    for (size_t i = 0; i < localVars.size(); i++) {
+      llvm::AllocaInst* slot = getSlot(localVars[i]);
+      builder.CreateStore(builder.CreateLoad(slot->getAllocatedType(), slot),
+                          getContextField(ctx, i + 2));
+    }
+    builder.CreateStore(builder.getInt32(label), getContextField(ctx, 1));
+    builder.CreateRet(builder.CreateLoad(builder.getInt32Ty(), bufSize));
+  }
+
+  void compileCoroutineFinish() {
+    const int numYields = resumeBlocks.size() - 1;
+    llvm::BasicBlock* flushBlock = newBlock("flush");
+    llvm::Value* size = builder.CreateLoad(builder.getInt32Ty(), bufSize);
+    builder.CreateCondBr(builder.CreateICmpSGT(size, builder.getInt32(0)),
+                         flushBlock, resumeBlocks[numYields]);
+
+    builder.SetInsertPoint(flushBlock);
+    builder.CreateStore(builder.getInt32(numYields),
+                        getContextField(getContext(), 1));
+    builder.CreateRet(builder.CreateLoad(builder.getInt32Ty(), bufSize));
+
+    builder.SetInsertPoint(resumeBlocks[numYields]);
+    callFree(builder.CreateLoad(builder.getInt8PtrTy(), contextArg));
+    builder.CreateStore(llvm::ConstantPointerNull::get(builder.getInt8PtrTy()),
+                        contextArg);
+  }
+
+  // Generates `_shim_<name>(void** parameterPack)`, which unpacks an array of
+  // pointers into a call of the function.
+  void compileShim(const Function* func) {
+    llvm::Function* callee = module->getFunction(func->name);
+    llvm::Type* int8PtrType = builder.getInt8PtrTy();
+    llvm::Function* shim = llvm::Function::Create(
+        llvm::FunctionType::get(builder.getInt32Ty(),
+                                {int8PtrType->getPointerTo()}, false),
+        llvm::Function::ExternalLinkage, "_shim_" + func->name, module);
+    shim->addFnAttr(llvm::Attribute::NoUnwind);
+    builder.SetInsertPoint(llvm::BasicBlock::Create(context, "entry", shim));
+
+    llvm::Value* parameterPack = &*shim->arg_begin();
+    vector<llvm::Value*> args;
+    for (auto& param : callee->args()) {
+      llvm::Value* arg = builder.CreateLoad(int8PtrType,
+          builder.CreateConstInBoundsGEP1_32(int8PtrType, parameterPack,
+                                             args.size()));
+      llvm::Type* type = param.getType();
+      if (type->isPointerTy()) {
+        arg = builder.CreatePointerCast(arg, type);
+      }
+      else {
+        taco_iassert(type->isIntegerTy());
+        arg = builder.CreateTrunc(builder.CreatePtrToInt(arg,
+                                      builder.getInt64Ty()), type);
+      }
+      args.push_back(arg);
+    }
+    builder.CreateRet(builder.CreateCall(callee, args));
+  }
+
+  using IRVisitorStrict::visit;
+
+  void visit(const Literal* op) {
+    llvm::Type* type = getType(op->type);
+    if (op->type.isBool()) {
+      value = builder.getInt1(op->getBoolValue());
+    }
+    else if (op->type.isInt()) {
+      value = llvm::ConstantInt::get(type, op->getIntValue(), true);
+    }
+    else if (op->type.isUInt()) {
+      value = llvm::ConstantInt::get(type, op->getUIntValue(), false);
+    }
+    else {
+      value = llvm::ConstantFP::get(type, op->getFloatValue());
+    }
+    valueType = op->type;
+  }
+
+  void visit(const Var* op) {
+    llvm::AllocaInst* slot = getSlot(op);
+    value = builder.CreateLoad(slot->getAllocatedType(), slot);
+    valueType = op->type;
+  }
+
+  void visit(const Neg* op) {
+    llvm::Value* a = codegen(op->a);
+    if (valueType.isFloat()) {
+      value = builder.CreateFNeg(a);
+    }
+    else {
+      Datatype type = commonType(valueType, valueType);
+      value = builder.CreateNeg(convert(a, valueType, type));
+      valueType = type;
+    }
+  }
+
+  void visit(const Sqrt* op) {
+    llvm::Value* a = convert(codegen(op->a), valueType, op->type);
+    llvm::Function* sqrt = llvm::Intrinsic::getDeclaration(module,
+        llvm::Intrinsic::sqrt, {a->getType()});
+    value = builder.CreateCall(sqrt, {a});
+    valueType = op->type;
+  }
+
+  // Evaluates both operands and converts them to their common type.
+  Datatype codegenOperands(const Expr& a, const Expr& b, llvm::Value** va,
+                           llvm::Value** vb) {
+    llvm::Value* x = codegen(a);
+    Datatype xType = valueType;
+    llvm::Value* y = codegen(b);
+    Datatype yType = valueType;
+    Datatype type = commonType(xType, yType);
+    *va = convert(x, xType, type);
+    *vb = convert(y, yType, type);
+    return type;
+  }
+
+  void visit(const Add* op) {
+    llvm::Value *a, *b;
+    valueType = codegenOperands(op->a, op->b, &a, &b);
+    value = valueType.isFloat() ? builder.CreateFAdd(a, b)
+          : valueType.isInt()   ? builder.CreateNSWAdd(a, b)
+                                : builder.CreateAdd(a, b);
+  }
+
+  void visit(const Sub* op) {
+    llvm::Value *a, *b;
+    valueType = codegenOperands(op->a, op->b, &a, &b);
+    value = valueType.isFloat() ? builder.CreateFSub(a, b)
+          : valueType.isInt()   ? builder.CreateNSWSub(a, b)
+                                : builder.CreateSub(a, b);
+  }
+
+  void visit(const Mul* op) {
+    llvm::Value *a, *b;
+    valueType = codegenOperands(op->a, op->b, &a, &b);
+    value = valueType.isFloat() ? builder.CreateFMul(a, b)
+          : valueType.isInt()   ? builder.CreateNSWMul(a, b)
+                                : builder.CreateMul(a, b);
+  }
+
+  void visit(const Div* op) {
+    llvm::Value *a, *b;
+    valueType = codegenOperands(op->a, op->b, &a, &b);
+    value = valueType.isFloat() ? builder.CreateFDiv(a, b)
+          : valueType.isInt()   ? builder.CreateSDiv(a, b)
+                                : builder.CreateUDiv(a, b);
+  }
+
+  void visit(const Rem* op) {
+    llvm::Value *a, *b;
+    valueType = codegenOperands(op->a, op->b, &a, &b);
+    value = valueType.isFloat() ? builder.CreateFRem(a, b)
+          : valueType.isInt()   ? builder.CreateSRem(a, b)
+                                : builder.CreateURem(a, b);
+  }
+
+  llvm::Value* compare(Datatype type, llvm::CmpInst::Predicate floatPred,
+                       llvm::CmpInst::Predicate signedPred,
+                       llvm::CmpInst::Predicate unsignedPred,
+                       llvm::Value* a, llvm::Value* b) {
+    if (type.isFloat()) {
+      return builder.CreateFCmp(floatPred, a, b);
+    }
+    return builder.CreateICmp(type.isInt() ? signedPred : unsignedPred, a, b);
+  }
+
+  // Min and max are printed as nested TACO_MIN/TACO_MAX macros.
+  void codegenMinMax(const vector<Expr>& operands, bool isMin) {
+    value = codegen(operands.back());
+    Datatype type = valueType;
+    for (size_t i = operands.size() - 1; i-- > 0;) {
+      llvm::Value* b = value;
+      Datatype bType = type;
+      llvm::Value* a = codegen(operands[i]);
+      type = commonType(valueType, bType);
+      a = convert(a, valueType, type);
+      b = convert(b, bType, type);
+      llvm::Value* cond = isMin
+          ? compare(type, llvm::CmpInst::FCMP_OLT, llvm::CmpInst::ICMP_SLT,
+                    llvm::CmpInst::ICMP_ULT, a, b)
+          : compare(type, llvm::CmpInst::FCMP_OGT, llvm::CmpInst::ICMP_SGT,
+                    llvm::CmpInst::ICMP_UGT, a, b);
+      value = builder.CreateSelect(cond, a, b);
+    }
+    valueType = type;
+  }
+
+  void visit(const Min* op) {
+    codegenMinMax(op->operands, true);
+  }
+
+  void visit(const Max* op) {
+    codegenMinMax(op->operands, false);
+  }
+
+  void visit(const BitAnd* op) {
+    llvm::Value *a, *b;
+    valueType = codegenOperands(op->a, op->b, &a, &b);
+    value = builder.CreateAnd(a, b);
+  }
+
+  void visit(const BitOr* op) {
+    llvm::Value *a, *b;
+    valueType = codegenOperands(op->a, op->b, &a, &b);
+    value = builder.CreateOr(a, b);
+  }
+
+  void codegenCompare(const Expr& x, const Expr& y,
+                      llvm::CmpInst::Predicate floatPred,
+                      llvm::CmpInst::Predicate signedPred,
+                      llvm::CmpInst::Predicate unsignedPred) {
+    llvm::Value *a, *b;
+    Datatype type = codegenOperands(x, y, &a, &b);
+    value = compare(type, floatPred, signedPred, unsignedPred, a, b);
+    valueType = Bool;
+  }
+
+  void visit(const Eq* op) {
+    codegenCompare(op->a, op->b, llvm::CmpInst::FCMP_OEQ,
+                   llvm::CmpInst::ICMP_EQ, llvm::CmpInst::ICMP_EQ);
+  }
+
+  void visit(const Neq* op) {
+    codegenCompare(op->a, op->b, llvm::CmpInst::FCMP_UNE,
+                   llvm::CmpInst::ICMP_NE, llvm::CmpInst::ICMP_NE);
+  }
+
+  void visit(const Gt* op) {
+    codegenCompare(op->a, op->b, llvm::CmpInst::FCMP_OGT,
+                   llvm::CmpInst::ICMP_SGT, llvm::CmpInst::ICMP_UGT);
+  }
+
+  void visit(const Lt* op) {
+    codegenCompare(op->a, op->b, llvm::CmpInst::FCMP_OLT,
+                   llvm::CmpInst::ICMP_SLT, llvm::CmpInst::ICMP_ULT);
+  }
+
+  void visit(const Gte* op) {
+    codegenCompare(op->a, op->b, llvm::CmpInst::FCMP_OGE,
+                   llvm::CmpInst::ICMP_SGE, llvm::CmpInst::ICMP_UGE);
+  }
+
+  void visit(const Lte* op) {
+    codegenCompare(op->a, op->b, llvm::CmpInst::FCMP_OLE,
+                   llvm::CmpInst::ICMP_SLE, llvm::CmpInst::ICMP_ULE);
+  }
+
+  // && and || short circuit, as in C.
+  void codegenLogical(const Expr& x, const Expr& y, bool isAnd) {
+    llvm::Value* a = toBool(codegen(x), valueType);
+    llvm::BasicBlock* lhsBlock = builder.GetInsertBlock();
+    llvm::BasicBlock* rhsBlock = newBlock(isAnd ? "and.rhs" : "or.rhs");
+    llvm::BasicBlock* endBlock = newBlock(isAnd ? "and.end" : "or.end");
+    if (isAnd) {
+      builder.CreateCondBr(a, rhsBlock, endBlock);
+    }
+    else {
+      builder.CreateCondBr(a, endBlock, rhsBlock);
+    }
+
+    builder.SetInsertPoint(rhsBlock);
+    llvm::Value* b = toBool(codegen(y), valueType);
+    rhsBlock = builder.GetInsertBlock();
+    builder.CreateBr(endBlock);
+
+    builder.SetInsertPoint(endBlock);
+    llvm::PHINode* phi = builder.CreatePHI(builder.getInt1Ty(), 2);
+    phi->addIncoming(builder.getInt1(!isAnd), lhsBlock);
+    phi->addIncoming(b, rhsBlock);
+    value = phi;
+    valueType = Bool;
+  }
+
+  void visit(const And* op) {
+    codegenLogical(op->a, op->b, true);
+  }
+
+  void visit(const Or* op) {
+    codegenLogical(op->a, op->b, false);
+  }
+
+  void visit(const Cast* op) {
+    value = convert(codegen(op->a), valueType, op->type);
+    valueType = op->type;
+  }
+
+  // Calls external (mostly math library) functions. Their prototypes convert
+  // integer arguments of floating point functions, so we do the same.
+  void visit(const Call* op) {
+    vector<llvm::Value*> args;
+    vector<llvm::Type*> argTypes;
+    for (auto& arg : op->args) {
+      llvm::Value* argValue = codegen(arg);
+      if (op->type.isFloat() && !argValue->getType()->isPointerTy()) {
+        argValue = convert(argValue, valueType, op->type);
+      }
+      args.push_back(argValue);
+      argTypes.push_back(argValue->getType());
+    }
+    value = builder.CreateCall(getRuntimeFunction(op->func,
+                                                  getType(op->type), argTypes),
+                               args);
+    valueType = op->type;
+  }
+
+  void visit(const IfThenElse* op) {
+    llvm::Value* cond = toBool(codegen(op->cond), valueType);
+    llvm::BasicBlock* thenBlock = newBlock("then");
+    llvm::BasicBlock* endBlock = newBlock("endif");
+    llvm::BasicBlock* elseBlock =
+        op->otherwise.defined() ? newBlock("else") : endBlock;
+    builder.CreateCondBr(cond, thenBlock, elseBlock);
+
+    builder.SetInsertPoint(thenBlock);
+    codegen(op->then);
+    builder.CreateBr(endBlock);
+
+    if (op->otherwise.defined()) {
+      builder.SetInsertPoint(elseBlock);
+      codegen(op->otherwise);
+      builder.CreateBr(endBlock);
+    }
+    builder.SetInsertPoint(endBlock);
+  }
+
+  void visit(const Case* op) {
+    if (op->clauses.empty()) {
+      return;
+    }
+    llvm::BasicBlock* endBlock = newBlock("endcase");
+    for (size_t i = 0; i < op->clauses.size(); i++) {
+      auto& clause = op->clauses[i];
+      if (i == op->clauses.size() - 1 && op->alwaysMatch) {
+        codegen(clause.second);
+        builder.CreateBr(endBlock);
+        break;
+      }
+      llvm::Value* cond = toBool(codegen(clause.first), valueType);
+      llvm::BasicBlock* thenBlock = newBlock("case");
+      llvm::BasicBlock* nextBlock = newBlock("nextcase");
+      builder.CreateCondBr(cond, thenBlock, nextBlock);
+      builder.SetInsertPoint(thenBlock);
+      codegen(clause.second);
+      builder.CreateBr(endBlock);
+      builder.SetInsertPoint(nextBlock);
+      if (i == op->clauses.size() - 1) {
+        builder.CreateBr(endBlock);
+      }
+    }
+    builder.SetInsertPoint(endBlock);
+  }
+
+  void visit(const Switch* op) {
+    llvm::Value* control = codegen(op->controlExpr);
+    Datatype controlType = commonType(valueType, valueType);
+    control = convert(control, valueType, controlType);
+    llvm::BasicBlock* endBlock = newBlock("endswitch");
+    llvm::SwitchInst* switchInst = builder.CreateSwitch(control, endBlock,
+                                                        op->cases.size());
+    for (auto& switchCase : op->cases) {
+      llvm::Value* caseValue = convert(codegen(switchCase.first), valueType,
+                                       controlType);
+      llvm::ConstantInt* caseConstant = llvm::dyn_cast<llvm::ConstantInt>(caseValue);
+      taco_iassert(caseConstant) << "Switch cases must be constants";
+      llvm::BasicBlock* caseBlock = newBlock("switchcase");
+      switchInst->addCase(caseConstant, caseBlock);
+      builder.SetInsertPoint(caseBlock);
+      codegen(switchCase.second);
+      builder.CreateBr(endBlock);
+    }
+    builder.SetInsertPoint(endBlock);
+  }
+
+  void visit(const Load* op) {
+    llvm::Value* ptr = getElementPtr(op->arr, op->loc, op->type);
+    value = builder.CreateLoad(getMemoryType(op->type), ptr);
+    if (op->type.isBool()) {
+      value = builder.CreateTrunc(value, builder.getInt1Ty());
+    }
+    valueType = op->type;
+  }
+
+  void visit(const Malloc* op) {
+    llvm::Value* size = convert(codegen(op->size), valueType, UInt64);
+    value = callMalloc(size);
+    valueType = op->type;
+  }
+
+  void visit(const Sizeof* op) {
+    value = builder.getInt64(op->sizeofType.getDataType().getNumBytes());
+    valueType = UInt64;
+  }
+
+  void visit(const Store* op) {
+    Datatype type = op->arr.type();
+    llvm::Value* ptr = getElementPtr(op->arr, op->loc, type);
+    llvm::Value* data = codegen(op->data);
+    builder.CreateStore(coerce(data, valueType, getMemoryType(type), type),
+                        ptr);
+  }
+
+  void visit(const For* op) {
+    llvm::AllocaInst* slot = getSlot(op->var);
+    Datatype type = op->var.type();
+    builder.CreateStore(convert(codegen(op->start), valueType, type), slot);
+
+    llvm::BasicBlock* condBlock = newBlock("for.cond");
+    llvm::BasicBlock* bodyBlock = newBlock("for.body");
+    llvm::BasicBlock* incBlock = newBlock("for.inc");
+    llvm::BasicBlock* endBlock = newBlock("for.end");
+    builder.CreateBr(condBlock);
+
+    builder.SetInsertPoint(condBlock);
+    llvm::Value *var, *end;
+    Datatype cmpType = codegenOperands(op->var, op->end, &var, &end);
+    builder.CreateCondBr(compare(cmpType, llvm::CmpInst::FCMP_OLT,
+                                 llvm::CmpInst::ICMP_SLT,
+                                 llvm::CmpInst::ICMP_ULT, var, end),
+                         bodyBlock, endBlock);
+
+    builder.SetInsertPoint(bodyBlock);
+    continueBlocks.push_back(incBlock);
+    codegen(op->contents);
+    continueBlocks.pop_back();
+    builder.CreateBr(incBlock);
+
+    builder.SetInsertPoint(incBlock);
+    llvm::Value *a, *b;
+    Datatype incType = codegenOperands(op->var, op->increment, &a, &b);
+    llvm::Value* next = incType.isFloat() ? builder.CreateFAdd(a, b)
+                      : incType.isInt()   ? builder.CreateNSWAdd(a, b)
+                                          : builder.CreateAdd(a, b);
+    builder.CreateStore(convert(next, incType, type), slot);
+    addLoopMetadata(builder.CreateBr(condBlock), op->kind, op->vec_width,
+                    op->unrollFactor);
+
+    builder.SetInsertPoint(endBlock);
+  }
+
+  void visit(const While* op) {
+    llvm::BasicBlock* condBlock = newBlock("while.cond");
+    llvm::BasicBlock* bodyBlock = newBlock("while.body");
+    llvm::BasicBlock* endBlock = newBlock("while.end");
+    builder.CreateBr(condBlock);
+
+    builder.SetInsertPoint(condBlock);
+    builder.CreateCondBr(toBool(codegen(op->cond), valueType), bodyBlock,
+                         endBlock);
+
+    builder.SetInsertPoint(bodyBlock);
+    continueBlocks.push_back(condBlock);
+    codegen(op->contents);
+    continueBlocks.pop_back();
+    addLoopMetadata(builder.CreateBr(condBlock), op->kind, op->vec_width, 0);
+
+    builder.SetInsertPoint(endBlock);
+  }
+
+  void visit(const Block* op) {
+    for (auto& stmt : op->contents) {
+      codegen(stmt);
+    }
+  }
+
+  void visit(const Scope* op) {
+    codegen(op->scopedStmt);
+  }
+
+  void visit(const Function*) {
+    taco_ierror << "Functions can not be nested";
+  }
+
+  void visit(const VarDecl* op) {
+    storeTo(op->var, op->rhs);
+  }
+
+  void visit(const Assign* op) {
+    storeTo(op->lhs, op->rhs);
+  }
+
+  void visit(const Yield* op) {
+    taco_iassert(emittingCoroutine);
+    int stride = 0;
+    for (auto& coord : op->coords) {
+      stride += coord.type().getNumBytes();
+    }
+
+    llvm::Value* size = builder.CreateSExt(
+        builder.CreateLoad(builder.getInt32Ty(), bufSize), builder.getInt64Ty());
+    llvm::Value* base = builder.CreateMul(size, builder.getInt64(stride));
+    int offset = 0;
+    for (auto& coord : op->coords) {
+      llvm::Value* ptr = builder.CreateInBoundsGEP(builder.getInt8Ty(),
+          coordsArg, builder.CreateAdd(base, builder.getInt64(offset)));
+      ptr = builder.CreatePointerCast(ptr, getPointerType(coord.type()));
+      llvm::Value* coordValue = codegen(coord);
+      builder.CreateStore(coerce(coordValue, valueType,
+                                 getMemoryType(coord.type()), coord.type()),
+                          ptr);
+      offset += coord.type().getNumBytes();
+    }
+    llvm::Value* val = codegen(op->val);
+    builder.CreateStore(coerce(val, valueType, getMemoryType(yieldType),
+                               yieldType),
+                        builder.CreateInBoundsGEP(getMemoryType(yieldType),
+                                                  valArg, size));
+
+    llvm::Value* next = builder.CreateAdd(
+        builder.CreateLoad(builder.getInt32Ty(), bufSize), builder.getInt32(1));
+    builder.CreateStore(next, bufSize);
+    llvm::BasicBlock* returnBlock = newBlock("yield");
+    llvm::BasicBlock* resumeBlock = resumeBlocks[labelCount];
+    builder.CreateCondBr(builder.CreateICmpEQ(next,
+        builder.CreateLoad(builder.getInt32Ty(), bufCapacity)),
+        returnBlock, resumeBlock);
+
+    builder.SetInsertPoint(returnBlock);
+    compileCoroutineReturn(labelCount++);
+    builder.SetInsertPoint(resumeBlock);
+  }
+
+  void visit(const Allocate* op) {
+    Datatype type = op->var.type();
+    llvm::AllocaInst* slot = getSlot(op->var);
+    llvm::Type* int8PtrType = builder.getInt8PtrTy();
+    llvm::Type* int64Type = builder.getInt64Ty();
+    auto getSize = [&](Expr elements) {
+      llvm::Value* numElements = codegen(elements);
+      numElements = convert(numElements, valueType, UInt64);
+      return builder.CreateMul(numElements,
+                               builder.getInt64(type.getNumBytes()));
+    };
+    llvm::Value* size = getSize(op->num_elements);
+    llvm::Value* ptr;
+    if (op->is_realloc) {
+      llvm::Value* old = builder.CreatePointerCast(
+          builder.CreateLoad(slot->getAllocatedType(), slot), int8PtrType);
+      llvm::Value* oldSize = getSize(op->old_elements);
+      ptr = builder.CreateCall(getRuntimeFunction("taco_realloc", int8PtrType,
+          {int8PtrType, int8PtrType, int64Type, int64Type}),
+          {allocatorArg, old, oldSize, size});
+    }
+    else {
+      ptr = builder.CreateCall(getRuntimeFunction("taco_alloc", int8PtrType,
+          {int8PtrType, int64Type}), {allocatorArg, size});
+    }
+    builder.CreateStore(builder.CreatePointerCast(ptr,
+                                                  slot->getAllocatedType()),
+                        slot);
+  }
+
+  void visit(const Free* op) {
+    llvm::Type* int8PtrType = builder.getInt8PtrTy();
+    builder.CreateCall(getRuntimeFunction("taco_free", builder.getVoidTy(),
+        {int8PtrType, int8PtrType}),
+        {allocatorArg, builder.CreatePointerCast(codegen(op->var),
+                                                 int8PtrType)});
+  }
+
+  void visit(const Comment*) {
+  }
+
+  void visit(const BlankLine*) {
+  }
+
+  void visit(const Break*) {
+    taco_iassert(!continueBlocks.empty()) << "Break outside of a loop";
+    builder.CreateBr(continueBlocks.back());
+    builder.SetInsertPoint(newBlock("unreachable"));
+  }
+
+  // printf promotes its variadic arguments.
+  void visit(const Print* op) {
+    vector<llvm::Value*> args = {builder.CreateGlobalStringPtr(op->fmt)};
+    for (auto& param : op->params) {
+      llvm::Value* arg = codegen(param);
+      if (!arg->getType()->isPointerTy()) {
+        if (valueType.isFloat()) {
+          arg = convert(arg, valueType, Float64);
+        }
+        else if (valueType.isBool() || valueType.getNumBits() < 32) {
+          arg = convert(arg, valueType, Int32);
+        }
+      }
+      args.push_back(arg);
+    }
+    builder.CreateCall(getRuntimeFunction("printf", builder.getInt32Ty(),
+                                          {builder.getInt8PtrTy()}, true),
+                       args);
+  }
+
+  void visit(const GetProperty* op) {
+    llvm::AllocaInst* slot = getSlot(op);
+    value = builder.CreateLoad(slot->getAllocatedType(), slot);
+    valueType = op->type;
+  }
+};
+
+/// Optimize the module. Compile latency matters more than peak performance
+/// for most kernels, so by default only a short scalar pipeline is run, which
+/// takes a fraction of the time of the full -O3 pipeline. Modules with loops
+/// that were scheduled for vectorization get the full pipeline.
+void optimize(llvm::Module& module, llvm::TargetMachine* targetMachine,
+              bool fullPipeline) {
+  llvm::LoopAnalysisManager lam;
+  llvm::FunctionAnalysisManager fam;
+  llvm::CGSCCAnalysisManager cgam;
+  llvm::ModuleAnalysisManager mam;
+
+  llvm::PassBuilder passBuilder(targetMachine);
+  passBuilder.registerModuleAnalyses(mam);
+  passBuilder.registerCGSCCAnalyses(cgam);
+  passBuilder.registerFunctionAnalyses(fam);
+  passBuilder.registerLoopAnalyses(lam);
+  passBuilder.crossRegisterProxies(lam, fam, cgam, mam);
+
+  if (fullPipeline) {
+    passBuilder.buildPerModuleDefaultPipeline(llvm::OptimizationLevel::O3)
+               .run(module, mam);
+    return;
+  }
+
+  llvm::FunctionPassManager fpm;
+  fpm.addPass(llvm::SROAPass());
+  fpm.addPass(llvm::EarlyCSEPass(true));
+  fpm.addPass(llvm::InstCombinePass());
+  fpm.addPass(llvm::SimplifyCFGPass());
+  fpm.addPass(llvm::createFunctionToLoopPassAdaptor(llvm::LICMPass(), true));
+  fpm.addPass(llvm::createFunctionToLoopPassAdaptor(
+      llvm::IndVarSimplifyPass()));
+  fpm.addPass(llvm::GVNPass());
+  fpm.addPass(llvm::InstCombinePass());
+  fpm.addPass(llvm::SimplifyCFGPass());
+
+  llvm::ModulePassManager mpm;
+  mpm.addPass(llvm::createModuleToFunctionPassAdaptor(std::move(fpm)));
+  mpm.run(module, mam);
+}
+
+} // anonymous namespace
+
+struct JITModule::Content {
+  unique_ptr<llvm::orc::LLJIT> jit;
+  map<string, void*> funcPtrs;
+  string source;
+};
+
+bool JITModule::supports(const vector<Stmt>& funcs) {
+  for (auto& func : funcs) {
+    CheckSupported checker;
+    if (!func.as<Function>() || !checker.check(func)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+JITModule::JITModule(const vector<Stmt>& funcs) : content(new Content) {
+  initializeLLVM();
+
+  auto targetMachineBuilder =
+      check(llvm::orc::JITTargetMachineBuilder::detectHost());
+  targetMachineBuilder.setCodeGenOptLevel(llvm::CodeGenOpt::Default);
+  auto targetMachine = check(targetMachineBuilder.createTargetMachine());
+
+  auto llvmContext = make_unique<llvm::LLVMContext>();
+  auto llvmModule = make_unique<llvm::Module>("taco", *llvmContext);
+  llvmModule->setDataLayout(targetMachine->createDataLayout());
+  llvmModule->setTargetTriple(targetMachine->getTargetTriple().str());
+
+  CodeGen_LLVM codegen(llvmModule.get());
+  for (auto& func : funcs) {
+    codegen.compile(func);
+  }
+  string errors;
+  llvm::raw_string_ostream errorStream(errors);
+  taco_iassert(!llvm::verifyModule(*llvmModule, &errorStream)) <<
+      "Invalid LLVM IR:\n" << errorStream.str();
+
+  optimize(*llvmModule, targetMachine.get(), codegen.hasVectorizedLoops());
+  llvm::raw_string_ostream sourceStream(content->source);
+  sourceStream << *llvmModule;
+  sourceStream.flush();
+
+  content->jit = check(llvm::orc::LLJITBuilder()
+      .setJITTargetMachineBuilder(std::move(targetMachineBuilder))
+      .create());
+  llvm::orc::LLJIT& jit = *content->jit;
+  llvm::orc::JITDylib& dylib = jit.getMainJITDylib();
+  dylib.addGenerator(check(
+      llvm::orc::DynamicLibrarySearchGenerator::GetForCurrentProcess(
+          jit.getDataLayout().getGlobalPrefix())));
+  llvm::orc::SymbolMap runtime;
+  auto define = [&](string name, void* ptr) {
+    runtime[jit.mangleAndIntern(name)] = llvm::JITEvaluatedSymbol(
+        llvm::pointerToJITTargetAddress(ptr), llvm::JITSymbolFlags::Exported);
+  };
+  define("taco_binarySearchAfter", (void*)binarySearchAfter);
+  define("taco_binarySearchBefore", (void*)binarySearchBefore);
+  define("taco_alloc", (void*)allocate);
+  define("taco_realloc", (void*)reallocate);
+  define("taco_free", (void*)deallocate);
+  check(dylib.define(llvm::orc::absoluteSymbols(runtime)));
+  check(jit.addIRModule(llvm::orc::ThreadSafeModule(std::move(llvmModule),
+                                                    std::move(llvmContext))));
+
+  // Look up every function now, so that the module is compiled here rather
+  // than when a function is first called, and so that later lookups do not
+  // have to go through the JIT.
+  for (auto& func : funcs) {
+    const string name = func.as<Function>()->name;
+    for (auto& symbol : {name, "_shim_" + name}) {
+      content->funcPtrs[symbol] =
+          llvm::jitTargetAddressToPointer<void*>(
+              check(jit.lookup(symbol)).getAddress());
+    }
+  }
+}
+
+JITModule::~JITModule() {
+}
+
+void* JITModule::getFuncPtr(string name) const {
+  auto it = content->funcPtrs.find(name);
+  return (it != content->funcPtrs.end()) ? it->second : nullptr;
+}
+
+string JITModule::getSource() const {
+  return content->source;
+}
+
+} // namespace ir
+} // namespace taco
@@ -0,0 +1,45 @@
+#ifndef TACO_BACKEND_LLVM_H
+#define TACO_BACKEND_LLVM_H
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "taco/ir/ir.h"
+
+namespace taco {
+namespace ir {
+
+/// A set of lowered functions compiled to machine code in process, by
+/// translating the IR to LLVM IR and handing it to an LLVM ORC JIT. Unlike the
+/// C backend this neither writes files nor forks a system compiler. Every
+/// function is also given a `_shim_` wrapper with the same calling convention
+/// as the shims generated by CodeGen_C::generateShim.
+class JITModule {
+public:
+  /// Returns true if all the functions can be compiled by the JIT. Functions
+  /// with complex arithmetic or unfolded tensor parameters, and functions with
+  /// parallel loops or atomics when building with OpenMP, must be compiled by
+  /// the C backend instead.
+  static bool supports(const std::vector<Stmt>& funcs);
+
+  /// JIT compile the functions.
+  JITModule(const std::vector<Stmt>& funcs);
+  ~JITModule();
+
+  /// Get a pointer to a compiled function or shim, or nullptr if there is no
+  /// function of this name.
+  void* getFuncPtr(std::string name) const;
+
+  /// Get the optimized LLVM IR of the module.
+  std::string getSource() const;
+
+private:
+  struct Content;
+  std::shared_ptr<Content> content;
+};
+
+} // namespace ir
+} // namespace taco
+#endif
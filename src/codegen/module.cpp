@@ -2,6 +2,12 @@
 
 #include <iostream>
 #include <fstream>
+#include <sstream>
+#include <map>
+#include <mutex>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
 #include <dlfcn.h>
 #include <unistd.h>
 #if USE_OPENMP
@@ -12,9 +18,13 @@
 #include "taco/error.h"
 #include "taco/util/strings.h"
 #include "taco/util/env.h"
+#include "taco/util/thread_pool.h"
 #include "codegen/codegen_c.h"
 #include "codegen/codegen_cuda.h"
 #include "taco/cuda.h"
+#if LLVM_BUILT
+#include "codegen/codegen_llvm.h"
+#endif
 
 using namespace std;
 
@@ -33,18 +43,36 @@ void Module::setJITLibname() {
 }
 
 void Module::reset() {
+  waitForCompile();
+  compiled = shared_future<void>();
   funcs.clear();
   moduleFromUserSource = false;
   header.str("");
   header.clear();
   source.str("");
   source.clear();
+  extraSource.str("");
+  extraSource.clear();
+  extraHeader.str("");
+  extraHeader.clear();
+  precompiledFuncs.clear();
 }
 
 void Module::addFunction(Stmt func) {
   funcs.push_back(func);
 }
 
+void Module::addSource(string source, string header) {
+  extraSource << source;
+  extraHeader << header;
+}
+
+void Module::setPrecompiledFunctions(map<string,void*> funcPtrs) {
+  waitForCompile();
+  compiled = shared_future<void>();
+  precompiledFuncs = funcPtrs;
+}
+
 void Module::compileToSource(string path, string prefix) {
   if (!moduleFromUserSource) {
   
@@ -56,8 +84,7 @@ void Module::compileToSource(string path, string prefix) {
     source.str("");
     source.clear();
 
-    taco_tassert(target.arch == Target::C99) <<
-        "Only C99 codegen supported currently";
+    // Source files are C, also when the module targets the JIT
     std::shared_ptr<CodeGen> sourcegen =
         CodeGen::init_default(source, CodeGen::ImplementationGen);
     std::shared_ptr<CodeGen> headergen =
@@ -83,7 +110,28 @@ void Module::compileToSource(string path, string prefix) {
 }
 
 void Module::compileToStaticLibrary(string path, string prefix) {
-  taco_tassert(false) << "Compiling to a static library is not supported";
+  taco_uassert(!should_use_CUDA_codegen()) <<
+      "Compiling to a static library is not supported for CUDA";
+  writeLibrarySource(path, prefix);
+
+  string cmd = getCompiler() + " " + getCompilerFlags(false) + " -c " +
+               path + prefix + ".c -o " + path + prefix + ".o && " +
+               "ar rcs " + path + prefix + ".a " + path + prefix + ".o";
+  int err = system(cmd.data());
+  taco_uassert(err == 0) << "Compilation command failed:\n" << cmd
+    << "\nreturned " << err;
+}
+
+void Module::compileToSharedLibrary(string path, string prefix) {
+  taco_uassert(!should_use_CUDA_codegen()) <<
+      "Compiling to a shared library is not supported for CUDA";
+  writeLibrarySource(path, prefix);
+
+  string cmd = getCompiler() + " " + getCompilerFlags() + " " +
+               path + prefix + ".c -o " + path + prefix + ".so -lm";
+  int err = system(cmd.data());
+  taco_uassert(err == 0) << "Compilation command failed:\n" << cmd
+    << "\nreturned " << err;
 }
   
 namespace {
@@ -111,30 +159,193 @@ void writeShims(vector<Stmt> funcs, string path, string prefix) {
   shims_file.close();
 }
 
+/// Bump whenever the layout of generated libraries changes in a way that makes
+/// previously cached libraries unusable.
+const char* diskCacheVersion = "taco-kernel-cache-3";
+
+uint64_t hashString(const string& str) {
+  uint64_t hash = 14695981039346656037ull;
+  for (char c : str) {
+    hash ^= (uint8_t)c;
+    hash *= 1099511628211ull;
+  }
+  return hash;
+}
+
+/// Returns the version banner of the given compiler, so that libraries built
+/// by different compilers do not share cache entries. Each compiler is only
+/// queried once per process.
+string getCompilerVersion(const string& cc) {
+  static map<string,string> versions;
+  static mutex versionsMutex;
+  lock_guard<mutex> lock(versionsMutex);
+  if (versions.find(cc) == versions.end()) {
+    string version;
+    FILE* pipe = popen((cc + " --version 2>&1").c_str(), "r");
+    if (pipe) {
+      char buffer[256];
+      while (fgets(buffer, sizeof(buffer), pipe)) {
+        version += buffer;
+      }
+      pclose(pipe);
+    }
+    versions.insert({cc, version});
+  }
+  return versions.at(cc);
+}
+
+/// Store a copy of a library in the on-disk cache. The copy is written to a
+/// temporary file and then renamed, so that concurrent processes never load a
+/// partially written library.
+void storeInDiskCache(const string& libraryPath, const string& cachePath,
+                      const string& libname) {
+  if (cachePath.empty()) {
+    return;
+  }
+  const string tmpCachePath = cachePath + "." + libname + ".tmp";
+  ifstream src(libraryPath, ios::binary);
+  ofstream dst(tmpCachePath, ios::binary);
+  if (src && dst) {
+    dst << src.rdbuf();
+    dst.close();
+    if (!dst || rename(tmpCachePath.c_str(), cachePath.c_str()) != 0) {
+      remove(tmpCachePath.c_str());
+    }
+  }
+}
+
+/// The workers that run the system compiler for Module::compileAsync.
+util::ThreadPool& getCompilePool() {
+  static util::ThreadPool pool([]() {
+    const int numThreads =
+        atoi(util::getFromEnv("TACO_COMPILE_THREADS", "0").c_str());
+    return (numThreads > 0) ? (size_t)numThreads
+                            : (size_t)thread::hardware_concurrency();
+  }());
+  return pool;
+}
+
 } // anonymous namespace
 
-string Module::compile() {
+Module::~Module() {
+  // A pending compilation writes the library handle into this module
+  waitForCompile();
+  if (lib_handle) {
+    dlclose(lib_handle);
+  }
+}
+
+string Module::getCompiler() {
+  if (should_use_CUDA_codegen()) {
+    return "nvcc";
+  }
+  return util::getFromEnv(target.compiler_env, target.compiler);
+}
+
+string Module::getCompilerFlags(bool shared) {
+  if (should_use_CUDA_codegen()) {
+    return util::getFromEnv("TACO_NVCCFLAGS",
+                            get_default_CUDA_compiler_flags());
+  }
+  string cflags = util::getFromEnv("TACO_CFLAGS",
+                                   "-O3 -ffast-math -std=c99") +
+                  (shared ? " -shared -fPIC" : " -fPIC");
+#if USE_OPENMP
+  cflags += " -fopenmp";
+#else
+  // Honor the `omp simd` pragmas of vectorized loops
+  cflags += " -fopenmp-simd";
+#endif
+  return cflags;
+}
+
+string Module::getDiskCachePath(string diskCacheKey) {
+  string cachedir = util::getFromEnv("TACO_KERNEL_CACHE_DIR", "");
+  if (diskCacheKey.empty() || cachedir.empty()) {
+    return "";
+  }
+  if (cachedir.back() != '/') {
+    cachedir += '/';
+  }
+  const string cc = getCompiler();
+  const string signature = string(diskCacheVersion) + "\n" + diskCacheKey +
+                           "\n" + cc + "\n" + getCompilerFlags() + "\n" +
+                           getCompilerVersion(cc);
+  stringstream path;
+  path << cachedir << "taco_" << std::hex << hashString(signature) << ".so";
+  return path.str();
+}
+
+void Module::writeLibrarySource(string path, string prefix) {
+  // open the output file & write out the source
+  compileToSource(path, prefix);
+
+  // write out the shims
+  writeShims(funcs, path, prefix);
+
+  if (!extraSource.str().empty()) {
+    ofstream source_file(path+prefix+".c", ios::app);
+    source_file << extraSource.str();
+  }
+  if (!extraHeader.str().empty()) {
+    ofstream header_file(path+prefix+".h", ios::app);
+    header_file << extraHeader.str();
+  }
+}
+
+void Module::loadLibrary(string path) {
+  jit = nullptr;
+  if (lib_handle) {
+    dlclose(lib_handle);
+  }
+  lib_handle = dlopen(path.data(), RTLD_NOW | RTLD_LOCAL);
+  taco_uassert(lib_handle) << "Failed to load generated code";
+}
+
+bool Module::loadFromDiskCache(string diskCacheKey) {
+  waitForCompile();
+  const string path = getDiskCachePath(diskCacheKey);
+  if (path.empty() || access(path.c_str(), R_OK) != 0) {
+    return false;
+  }
+  compiled = shared_future<void>();
+  loadLibrary(path);
+  return true;
+}
+
+shared_future<void> Module::compileAsync(string diskCacheKey) {
+  waitForCompile();
+
+#if LLVM_BUILT
+  if (target.arch != Target::C99 && !moduleFromUserSource &&
+      JITModule::supports(funcs)) {
+    // The JIT compiles in a few milliseconds and reads the IR, which may not
+    // be shared with other threads, so it runs on the calling thread.
+    jit = make_shared<JITModule>(funcs);
+    header.str("");
+    header.clear();
+    source.str("");
+    source.clear();
+    source << jit->getSource();
+    promise<void> done;
+    done.set_value();
+    compiled = done.get_future().share();
+    return compiled;
+  }
+#endif
+
   string prefix = tmpdir+libname;
   string fullpath = prefix + ".so";
   
-  string cc;
-  string cflags;
+  string cc = getCompiler();
+  string cflags = getCompilerFlags();
   string file_ending;
   string shims_file;
   if (should_use_CUDA_codegen()) {
-    cc = "nvcc";
-    cflags = util::getFromEnv("TACO_NVCCFLAGS",
-    get_default_CUDA_compiler_flags());
     file_ending = ".cu";
     shims_file = prefix + "_shims.cpp";
   }
   else {
-    cc = util::getFromEnv(target.compiler_env, target.compiler);
-    cflags = util::getFromEnv("TACO_CFLAGS",
-    "-O3 -ffast-math -std=c99") + " -shared -fPIC";
-#if USE_OPENMP
-    cflags += " -fopenmp";
-#endif
     file_ending = ".c";
     shims_file = "";
   }
@@ -143,28 +354,46 @@ string Module::compile() {
     prefix + file_ending + " " + shims_file + " " + 
     "-o " + fullpath + " -lm";
 
-  // open the output file & write out the source
-  compileToSource(tmpdir, libname);
-  
-  // write out the shims
-  writeShims(funcs, tmpdir, libname);
-  
-  // now compile it
-  int err = system(cmd.data());
-  taco_uassert(err == 0) << "Compilation command failed:\n" << cmd
-    << "\nreturned " << err;
+  // write out the source and the shims
+  writeLibrarySource(tmpdir, libname);
 
-  // use dlsym() to open the compiled library
-  if (lib_handle) {
-    dlclose(lib_handle);
+  // now compile it in the background
+  const string cachePath = getDiskCachePath(diskCacheKey);
+  compiled = getCompilePool().submit([this, cmd, fullpath, cachePath]() {
+    int err = system(cmd.data());
+    taco_uassert(err == 0) << "Compilation command failed:\n" << cmd
+      << "\nreturned " << err;
+
+    // use dlsym() to open the compiled library
+    loadLibrary(fullpath);
+
+    storeInDiskCache(fullpath, cachePath, libname);
+  }).share();
+  return compiled;
+}
+
+string Module::compile(string diskCacheKey) {
+  compileAsync(diskCacheKey).get();
+  return jit ? "" : tmpdir + libname + ".so";
+}
+
+shared_future<void> Module::getCompileFuture() const {
+  if (compiled.valid()) {
+    return compiled;
   }
-  lib_handle = dlopen(fullpath.data(), RTLD_NOW | RTLD_LOCAL);
-  taco_uassert(lib_handle) << "Failed to load generated code";
+  promise<void> done;
+  done.set_value();
+  return done.get_future().share();
+}
 
-  return fullpath;
+void Module::waitForCompile() {
+  if (compiled.valid()) {
+    compiled.wait();
+  }
 }
 
 void Module::setSource(string source) {
+  waitForCompile();
   this->source << source;
   moduleFromUserSource = true;
 }
@@ -173,15 +402,35 @@ string Module::getSource() {
   return source.str();
 }
 
+Target Module::getTarget() const {
+  return target;
+}
+
 void* Module::getFuncPtr(std::string name) {
+  if (!precompiledFuncs.empty()) {
+    auto it = precompiledFuncs.find(name);
+    return (it != precompiledFuncs.end()) ? it->second : nullptr;
+  }
+  if (compiled.valid()) {
+    // Rethrows the error if the compilation failed
+    compiled.get();
+  }
+#if LLVM_BUILT
+  if (jit) {
+    return jit->getFuncPtr(name);
+  }
+#endif
   return dlsym(lib_handle, name.data());
 }
 
 int Module::callFuncPackedRaw(std::string name, void** args) {
+  return callFuncPtrPackedRaw(getFuncPtr(name), args);
+}
+
+int Module::callFuncPtrPackedRaw(void* v_func_ptr, void** args) {
   typedef int (*fnptr_t)(void**);
   static_assert(sizeof(void*) == sizeof(fnptr_t),
     "Unable to cast dlsym() returned void pointer to function pointer");
-  void* v_func_ptr = getFuncPtr(name);
   fnptr_t func_ptr;
   *reinterpret_cast<void**>(&func_ptr) = v_func_ptr;
 
@@ -9,6 +9,8 @@
 #include "taco/lower/mode_format_dense.h"
 #include "taco/lower/mode_format_compressed.h"
 #include "taco/lower/mode_format_singleton.h"
+#include "taco/lower/mode_format_hashed.h"
+#include "taco/lower/mode_format_bitmap.h"
 
 #include "taco/error.h"
 #include "taco/util/strings.h"
@@ -89,13 +91,47 @@ Datatype Format::getCoordinateTypeIdx(size_t level) const {
   if (level >= levelArrayTypes.size()) {
     return Int32;
   }
-  if (getModeFormats()[level].getName() == Dense.getName()) {
+  if (getModeFormats()[level].getName() == Dense.getName() ||
+      levelArrayTypes[level].size() < 2) {
     return levelArrayTypes[level][0];
   }
   return levelArrayTypes[level][1];
 }
 
+Datatype Format::getPositionType(size_t level) const {
+  for (size_t i = 0; i <= level && i < levelArrayTypes.size(); ++i) {
+    const Datatype posType = getCoordinateTypePos(i);
+    if (posType.getNumBits() > 32 ||
+        (posType.isUInt() && posType.getNumBits() == 32)) {
+      return Int64;
+    }
+  }
+  return Int32;
+}
+
 void Format::setLevelArrayTypes(std::vector<std::vector<Datatype>> levelArrayTypes) {
+  for (auto& arrayTypes : levelArrayTypes) {
+    taco_uassert(!arrayTypes.empty()) <<
+        "Every level needs the types of its index arrays";
+    for (auto& arrayType : arrayTypes) {
+      taco_uassert((arrayType.isInt() || arrayType.isUInt()) &&
+                   arrayType.getNumBits() <= 64) <<
+          "Index arrays must have integer types of at most 64 bits, not " <<
+          arrayType;
+    }
+  }
+  for (size_t level = 0;
+       level < levelArrayTypes.size() && level < (size_t)getOrder(); ++level) {
+    if (getModeFormats()[level].getName() != Hashed.getName()) {
+      continue;
+    }
+    // The runtime sizes and grows hash tables through Int32 arrays, and marks
+    // empty slots with -1
+    for (auto& arrayType : levelArrayTypes[level]) {
+      taco_uassert(arrayType == Int32) <<
+          "Hashed levels must have Int32 index arrays, not " << arrayType;
+    }
+  }
   this->levelArrayTypes = levelArrayTypes;
 }
 
@@ -120,6 +156,12 @@ bool operator==(const Format& a, const Format& b){
       return false;
     }
   } 
+  for (int i = 0; i < a.getOrder(); i++) {
+    if (a.getCoordinateTypePos(i) != b.getCoordinateTypePos(i) ||
+        a.getCoordinateTypeIdx(i) != b.getCoordinateTypeIdx(i)) {
+      return false;
+    }
+  }
   return true;
 }
 
@@ -332,21 +374,29 @@ ModeFormat ModeFormat::Dense(std::make_shared<DenseModeFormat>());
 ModeFormat ModeFormat::Compressed(std::make_shared<CompressedModeFormat>());
 ModeFormat ModeFormat::Sparse = ModeFormat::Compressed;
 ModeFormat ModeFormat::Singleton(std::make_shared<SingletonModeFormat>());
+ModeFormat ModeFormat::Hashed(std::make_shared<HashedModeFormat>());
+ModeFormat ModeFormat::Bitmap(std::make_shared<BitmapModeFormat>());
 
 ModeFormat ModeFormat::dense = ModeFormat::Dense;
 ModeFormat ModeFormat::compressed = ModeFormat::Compressed;
 ModeFormat ModeFormat::sparse = ModeFormat::Compressed;
 ModeFormat ModeFormat::singleton = ModeFormat::Singleton;
+ModeFormat ModeFormat::hashed = ModeFormat::Hashed;
+ModeFormat ModeFormat::bitmap = ModeFormat::Bitmap;
 
 const ModeFormat Dense = ModeFormat::Dense;
 const ModeFormat Compressed = ModeFormat::Compressed;
 const ModeFormat Sparse = ModeFormat::Compressed;
 const ModeFormat Singleton = ModeFormat::Singleton;
+const ModeFormat Hashed = ModeFormat::Hashed;
+const ModeFormat Bitmap = ModeFormat::Bitmap;
 
 const ModeFormat dense = ModeFormat::Dense;
 const ModeFormat compressed = ModeFormat::Compressed;
 const ModeFormat sparse = ModeFormat::Compressed;
 const ModeFormat singleton = ModeFormat::Singleton;
+const ModeFormat hashed = ModeFormat::Hashed;
+const ModeFormat bitmap = ModeFormat::Bitmap;
 
 const Format CSR({Dense, Sparse}, {0,1});
 const Format CSC({Dense, Sparse}, {1,0});
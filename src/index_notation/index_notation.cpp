@@ -434,6 +434,278 @@ bool isomorphic(IndexStmt a, IndexStmt b) {
   return Isomorphic().check(a,b);
 }
 
+/// Computes a 64-bit FNV-1a hash over the structure of an index statement.
+/// Tensors and index variables are numbered in order of first occurrence, so
+/// that statements that are isomorphic hash to the same value. If `key` is
+/// set, the hashed bytes are also appended to it.
+struct IsomorphicHash : public IndexNotationVisitorStrict {
+  uint64_t hash = 14695981039346656037ull;
+  std::string* key = nullptr;
+  std::map<TensorVar,uint64_t> tensorIds;
+  std::map<IndexVar,uint64_t> indexVarIds;
+
+  using IndexNotationVisitorStrict::visit;
+
+  void combine(const void* data, size_t size) {
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+    for (size_t i = 0; i < size; ++i) {
+      hash ^= bytes[i];
+      hash *= 1099511628211ull;
+    }
+    if (key) {
+      key->append(static_cast<const char*>(data), size);
+    }
+  }
+
+  void combine(uint64_t value) {
+    combine(&value, sizeof(value));
+  }
+
+  void combine(const std::string& str) {
+    combine(str.size());
+    combine(str.data(), str.size());
+  }
+
+  void combine(const Datatype& datatype) {
+    combine((uint64_t)datatype.getKind());
+  }
+
+  void combine(const Type& type) {
+    combine(type.getDataType());
+    combine((uint64_t)type.getOrder());
+    for (const Dimension& dimension : type.getShape()) {
+      combine((uint64_t)dimension.isFixed());
+      combine((uint64_t)(dimension.isFixed() ? dimension.getSize() : 0));
+    }
+  }
+
+  void combine(const Format& format) {
+    combine((uint64_t)format.getOrder());
+    for (int mode : format.getModeOrdering()) {
+      combine((uint64_t)mode);
+    }
+    for (const ModeFormatPack& pack : format.getModeFormatPacks()) {
+      combine((uint64_t)pack.getModeFormats().size());
+      for (const ModeFormat& modeFormat : pack.getModeFormats()) {
+        combine(modeFormat.getName());
+        if (modeFormat.defined()) {
+          combine((uint64_t)modeFormat.isFull());
+          combine((uint64_t)modeFormat.isOrdered());
+          combine((uint64_t)modeFormat.isUnique());
+          combine((uint64_t)modeFormat.isBranchless());
+          combine((uint64_t)modeFormat.isCompact());
+        }
+      }
+    }
+    for (int level = 0; level < format.getOrder(); ++level) {
+      combine((uint64_t)format.getCoordinateTypePos(level).getKind());
+      combine((uint64_t)format.getCoordinateTypeIdx(level).getKind());
+    }
+  }
+
+  void combine(const TensorVar& tensorVar) {
+    if (!util::contains(tensorIds, tensorVar)) {
+      uint64_t id = tensorIds.size();
+      tensorIds.insert({tensorVar, id});
+      combine(id);
+      combine(tensorVar.getType());
+      combine(tensorVar.getFormat());
+      return;
+    }
+    combine(tensorIds.at(tensorVar));
+  }
+
+  void combine(const IndexVar& indexVar) {
+    if (!util::contains(indexVarIds, indexVar)) {
+      indexVarIds.insert({indexVar, (uint64_t)indexVarIds.size()});
+    }
+    combine(indexVarIds.at(indexVar));
+  }
+
+  void combine(const IndexExpr& expr) {
+    if (!expr.defined()) {
+      combine((uint64_t)0);
+      return;
+    }
+    expr.accept(this);
+  }
+
+  void combine(const IndexStmt& stmt) {
+    if (!stmt.defined()) {
+      combine((uint64_t)0);
+      return;
+    }
+    stmt.accept(this);
+  }
+
+  void combine(const IndexVarRel& rel) {
+    combine((uint64_t)rel.getRelType());
+    if (rel.getRelType() == UNDEFINED) {
+      return;
+    }
+    for (const IndexVar& parent : rel.getNode()->getParents()) {
+      combine(parent);
+    }
+    for (const IndexVar& child : rel.getNode()->getChildren()) {
+      combine(child);
+    }
+    switch (rel.getRelType()) {
+      case SPLIT:
+        combine((uint64_t)rel.getNode<SplitRelNode>()->getSplitFactor());
+        break;
+      case DIVIDE:
+        combine((uint64_t)rel.getNode<DivideRelNode>()->getDivideFactor());
+        break;
+      case POS:
+        combine(rel.getNode<PosRelNode>()->getAccess());
+        break;
+      case BOUND:
+        combine((uint64_t)rel.getNode<BoundRelNode>()->getBound());
+        combine((uint64_t)rel.getNode<BoundRelNode>()->getBoundType());
+        break;
+      default:
+        break;
+    }
+  }
+
+  void visit(const AccessNode* node) {
+    combine((uint64_t)1);
+    combine(node->tensorVar);
+    combine((uint64_t)node->indexVars.size());
+    for (const IndexVar& indexVar : node->indexVars) {
+      combine(indexVar);
+    }
+  }
+
+  void visit(const LiteralNode* node) {
+    combine((uint64_t)2);
+    combine(node->getDataType());
+    combine(node->val, node->getDataType().getNumBytes());
+  }
+
+  void visit(const NegNode* node) {
+    combine((uint64_t)3);
+    combine(node->a);
+  }
+
+  void visit(const SqrtNode* node) {
+    combine((uint64_t)4);
+    combine(node->a);
+  }
+
+  void visit(const AddNode* node) {
+    combine((uint64_t)5);
+    combine(node->a);
+    combine(node->b);
+  }
+
+  void visit(const SubNode* node) {
+    combine((uint64_t)6);
+    combine(node->a);
+    combine(node->b);
+  }
+
+  void visit(const MulNode* node) {
+    combine((uint64_t)7);
+    combine(node->a);
+    combine(node->b);
+  }
+
+  void visit(const DivNode* node) {
+    combine((uint64_t)8);
+    combine(node->a);
+    combine(node->b);
+  }
+
+  void visit(const CastNode* node) {
+    combine((uint64_t)9);
+    combine(node->getDataType());
+    combine(node->a);
+  }
+
+  void visit(const CallIntrinsicNode* node) {
+    combine((uint64_t)10);
+    combine(node->func->getName());
+    combine((uint64_t)node->args.size());
+    for (const IndexExpr& arg : node->args) {
+      combine(arg);
+    }
+  }
+
+  void visit(const ReductionNode* node) {
+    combine((uint64_t)11);
+    combine(node->op);
+    combine(node->var);
+    combine(node->a);
+  }
+
+  void visit(const AssignmentNode* node) {
+    combine((uint64_t)12);
+    combine(node->lhs);
+    combine(node->rhs);
+    combine(node->op);
+  }
+
+  void visit(const YieldNode* node) {
+    combine((uint64_t)13);
+    combine((uint64_t)node->indexVars.size());
+    for (const IndexVar& indexVar : node->indexVars) {
+      combine(indexVar);
+    }
+    combine(node->expr);
+  }
+
+  void visit(const ForallNode* node) {
+    combine((uint64_t)14);
+    combine(node->indexVar);
+    combine(node->stmt);
+    combine((uint64_t)node->parallel_unit);
+    combine((uint64_t)node->output_race_strategy);
+    combine((uint64_t)node->unrollFactor);
+  }
+
+  void visit(const WhereNode* node) {
+    combine((uint64_t)15);
+    combine(node->consumer);
+    combine(node->producer);
+  }
+
+  void visit(const SequenceNode* node) {
+    combine((uint64_t)16);
+    combine(node->definition);
+    combine(node->mutation);
+  }
+
+  void visit(const MultiNode* node) {
+    combine((uint64_t)17);
+    combine(node->stmt1);
+    combine(node->stmt2);
+  }
+
+  void visit(const SuchThatNode* node) {
+    combine((uint64_t)18);
+    combine(node->stmt);
+    combine((uint64_t)node->predicate.size());
+    for (const IndexVarRel& rel : node->predicate) {
+      combine(rel);
+    }
+  }
+};
+
+uint64_t isomorphicHash(IndexStmt stmt) {
+  IsomorphicHash hasher;
+  hasher.combine(stmt);
+  return hasher.hash;
+}
+
+std::string isomorphicKey(IndexStmt stmt) {
+  std::string key;
+  IsomorphicHash hasher;
+  hasher.key = &key;
+  hasher.combine(stmt);
+  return key;
+}
+
 struct Equals : public IndexNotationVisitorStrict {
   bool eq = false;
   IndexExpr bExpr;
@@ -1371,10 +1643,24 @@ IndexStmt IndexStmt::split(IndexVar i, IndexVar i1, IndexVar i2, size_t splitFac
   return transformed;
 }
 
-IndexStmt IndexStmt::divide(IndexVar i, IndexVar i1, IndexVar i2, size_t splitFactor) const {
-  taco_not_supported_yet;
-  // mostly the same as split, but instead of splitFactor being a constant use an expression
-  return *this;
+IndexStmt IndexStmt::divide(IndexVar i, IndexVar i1, IndexVar i2, size_t divideFactor) const {
+  taco_uassert(divideFactor > 0) << "divide factor must be a positive integer";
+  IndexVarRel rel = IndexVarRel(new DivideRelNode(i, i1, i2, divideFactor));
+  string reason;
+
+  // Add predicate to concrete index notation
+  IndexStmt transformed = Transformation(AddSuchThatPredicates({rel})).apply(*this, &reason);
+  if (!transformed.defined()) {
+    taco_uerror << reason;
+  }
+
+  // Replace all occurrences of i with nested i1, i2
+  transformed = Transformation(ForAllReplace({i}, {i1, i2})).apply(transformed, &reason);
+  if (!transformed.defined()) {
+    taco_uerror << reason;
+  }
+
+  return transformed;
 }
 
 IndexStmt IndexStmt::precompute(IndexExpr expr, IndexVar i, IndexVar iw, TensorVar workspace) const {
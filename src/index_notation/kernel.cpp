@@ -1,6 +1,7 @@
 #include "taco/index_notation/kernel.h"
 
 #include <iostream>
+#include <algorithm>
 
 #include "taco/index_notation/index_notation.h"
 #include "taco/lower/lower.h"
@@ -11,6 +12,7 @@
 #include "taco/taco_tensor_t.h"
 #include <taco/index_notation/transformations.h>
 #include "taco/index_notation/index_notation_nodes.h"
+#include "taco/util/collections.h"
 
 
 using namespace std;
@@ -19,6 +21,19 @@ namespace taco {
 
 struct Kernel::Content {
   shared_ptr<ir::Module> module;
+
+  /// Results and arguments of the kernel in the order it takes them
+  vector<TensorVar> parameters;
+
+  /// Shims that take packed arguments, which are looked up once
+  void* evaluateShim;
+  void* assembleShim;
+  void* computeShim;
+
+  /// Storage bound to the parameters and their packed arguments, followed by
+  /// the allocator argument
+  vector<unique_ptr<TensorStorage>> boundStorage;
+  vector<void*> boundArguments;
 };
 
 Kernel::Kernel() : content(nullptr) {
@@ -31,6 +46,14 @@ Kernel::Kernel() : content(nullptr) {
 Kernel::Kernel(IndexStmt stmt, shared_ptr<ir::Module> module, void* evaluate,
                void* assemble, void* compute) : content(new Content) {
   content->module = module;
+  content->parameters = getResults(stmt);
+  util::append(content->parameters, getArguments(stmt));
+  content->evaluateShim = module->getFuncPtr("_shim_evaluate");
+  content->assembleShim = module->getFuncPtr("_shim_assemble");
+  content->computeShim = module->getFuncPtr("_shim_compute");
+  content->boundStorage.resize(content->parameters.size());
+  // Kernels allocate with malloc
+  content->boundArguments.resize(content->parameters.size() + 1, nullptr);
   this->numResults = getResults(stmt).size();
   this->evaluateFunction = evaluate;
   this->assembleFunction = assemble;
@@ -40,66 +63,170 @@ Kernel::Kernel(IndexStmt stmt, shared_ptr<ir::Module> module, void* evaluate,
 static inline
 vector<void*> packArguments(const vector<TensorStorage>& args) {
   vector<void*> arguments;
-  arguments.reserve(args.size());
+  arguments.reserve(args.size() + 1);
   for (auto& arg : args) {
     arguments.push_back(static_cast<taco_tensor_t*>(arg));
   }
+  // Kernels allocate with malloc
+  arguments.push_back(nullptr);
   return arguments;
 }
 
 static inline
-void unpackResults(size_t numResults, const vector<void*> arguments,
+void unpackResult(taco_tensor_t* tensorData, TensorStorage storage) {
+  const Format& format = storage.getFormat();
+
+  vector<ModeIndex> modeIndices;
+  size_t num = 1;
+  for (int i = 0; i < storage.getOrder(); i++) {
+    ModeFormat modeType = format.getModeFormats()[i];
+    if (modeType.getName() == Dense.getName()) {
+      Array size = makeArray({*(int*)tensorData->indices[i][0]});
+      modeIndices.push_back(ModeIndex({size}));
+      num *= ((int*)tensorData->indices[i][0])[0];
+    } else if (modeType.getName() == Sparse.getName()) {
+      Array pos = Array(format.getCoordinateTypePos(i),
+                        tensorData->indices[i][0], num+1, Array::UserOwns);
+      auto size = pos.get(num).getAsIndex();
+      Array idx = Array(format.getCoordinateTypeIdx(i),
+                        tensorData->indices[i][1], size, Array::UserOwns);
+      modeIndices.push_back(ModeIndex({pos, idx}));
+      num = size;
+    } else if (modeType.getName() == Singleton.getName()) {
+      Array idx = Array(format.getCoordinateTypeIdx(i),
+                        tensorData->indices[i][1], num, Array::UserOwns);
+      modeIndices.push_back(ModeIndex({makeArray(format.getCoordinateTypePos(i),
+                                                 0), idx}));
+    } else if (modeType.getName() == Hashed.getName() ||
+               modeType.getName() == Bitmap.getName()) {
+      const int width = *(int*)tensorData->indices[i][0];
+      Array idx = Array(format.getCoordinateTypeIdx(i),
+                        tensorData->indices[i][1], num*width, Array::UserOwns);
+      modeIndices.push_back(ModeIndex({makeArray({width}), idx}));
+      num *= width;
+    } else {
+      taco_not_supported_yet;
+    }
+  }
+  storage.setIndex(Index(format, modeIndices));
+  storage.setValues(Array(storage.getComponentType(), tensorData->vals, num));
+}
+
+/// Reject results with levels that `unpackResult` cannot read back from a
+/// kernel, before the kernel writes to them.
+static void checkResultFormat(const TensorStorage& storage) {
+  for (const ModeFormat& modeType : storage.getFormat().getModeFormats()) {
+    const std::string name = modeType.getName();
+    taco_uassert(name == Dense.getName() || name == Sparse.getName() ||
+                 name == Singleton.getName() || name == Hashed.getName() ||
+                 name == Bitmap.getName())
+        << "Kernels cannot return results with " << name << " levels";
+  }
+}
+
+static inline
+void unpackResults(size_t numResults, const vector<void*>& arguments,
                    const vector<TensorStorage>& args) {
   for (size_t i = 0; i < numResults; i++) {
-    taco_tensor_t* tensorData = ((taco_tensor_t*)arguments[i]);
-    TensorStorage storage = args[i];
-    Format format = storage.getFormat();
-
-    vector<ModeIndex> modeIndices;
-    size_t num = 1;
-    for (int i = 0; i < storage.getOrder(); i++) {
-      ModeFormat modeType = format.getModeFormats()[i];
-      if (modeType.getName() == Dense.getName()) {
-        Array size = makeArray({*(int*)tensorData->indices[i][0]});
-        modeIndices.push_back(ModeIndex({size}));
-        num *= ((int*)tensorData->indices[i][0])[0];
-      } else if (modeType.getName() == Sparse.getName()) {
-        auto size = ((int*)tensorData->indices[i][0])[num];
-        Array pos = Array(type<int>(), tensorData->indices[i][0],
-                          num+1, Array::UserOwns);
-        Array idx = Array(type<int>(), tensorData->indices[i][1],
-                          size, Array::UserOwns);
-        modeIndices.push_back(ModeIndex({pos, idx}));
-        num = size;
-      } else {
-        taco_not_supported_yet;
-      }
-    }
-    storage.setIndex(Index(format, modeIndices));
-    storage.setValues(Array(storage.getComponentType(), tensorData->vals, num));
+    unpackResult((taco_tensor_t*)arguments[i], args[i]);
   }
 }
 
 bool Kernel::operator()(const vector<TensorStorage>& args) const {
+  taco_uassert(args.size() == content->parameters.size())
+      << "Kernel takes " << content->parameters.size() << " tensors";
+  for (size_t i = 0; i < this->numResults; i++) {
+    checkResultFormat(args[i]);
+  }
   vector<void*> arguments = packArguments(args);
-  int result = content->module->callFuncPacked("evaluate", arguments.data());
+  int result = ir::Module::callFuncPtrPackedRaw(content->evaluateShim,
+                                                arguments.data());
   unpackResults(this->numResults, arguments, args);
   return (result == 0);
 }
 
 bool Kernel::assemble(const vector<TensorStorage>& args) const {
+  taco_uassert(args.size() == content->parameters.size())
+      << "Kernel takes " << content->parameters.size() << " tensors";
+  for (size_t i = 0; i < this->numResults; i++) {
+    checkResultFormat(args[i]);
+  }
   vector<void*> arguments = packArguments(args);
-  int result = content->module->callFuncPacked("assemble", arguments.data());
+  int result = ir::Module::callFuncPtrPackedRaw(content->assembleShim,
+                                                arguments.data());
   unpackResults(this->numResults, arguments, args);
   return (result == 0);
 }
 
 bool Kernel::compute(const vector<TensorStorage>& args) const {
+  taco_uassert(args.size() == content->parameters.size())
+      << "Kernel takes " << content->parameters.size() << " tensors";
   vector<void*> arguments = packArguments(args);
-  int result = content->module->callFuncPacked("compute", arguments.data());
+  int result = ir::Module::callFuncPtrPackedRaw(content->computeShim,
+                                                arguments.data());
   return (result == 0);
 }
 
+void Kernel::bind(const TensorVar& parameter, const TensorStorage& storage) {
+  taco_uassert(defined()) << "Cannot bind storage to an undefined kernel";
+  const auto& parameters = content->parameters;
+  auto it = std::find(parameters.begin(), parameters.end(), parameter);
+  taco_uassert(it != parameters.end())
+      << parameter.getName() << " is not a result or argument of the kernel";
+  if ((size_t)(it - parameters.begin()) < this->numResults) {
+    checkResultFormat(storage);
+  }
+  content->boundStorage[it - parameters.begin()].reset(
+      new TensorStorage(storage));
+}
+
+/// Refresh the packed arguments of the bound storage, since assembling results
+/// replaces their arrays.
+static inline
+void** packBoundArguments(const vector<unique_ptr<TensorStorage>>& storage,
+                          vector<void*>& arguments) {
+  for (size_t i = 0; i < storage.size(); i++) {
+    taco_uassert(storage[i] != nullptr)
+        << "Every result and argument of the kernel must be bound";
+    arguments[i] = static_cast<taco_tensor_t*>(*storage[i]);
+  }
+  return arguments.data();
+}
+
+bool Kernel::operator()() const {
+  void** arguments = packBoundArguments(content->boundStorage,
+                                        content->boundArguments);
+  int result = ir::Module::callFuncPtrPackedRaw(content->evaluateShim,
+                                                arguments);
+  for (size_t i = 0; i < this->numResults; i++) {
+    unpackResult((taco_tensor_t*)arguments[i], *content->boundStorage[i]);
+  }
+  return (result == 0);
+}
+
+bool Kernel::assemble() const {
+  void** arguments = packBoundArguments(content->boundStorage,
+                                        content->boundArguments);
+  int result = ir::Module::callFuncPtrPackedRaw(content->assembleShim,
+                                                arguments);
+  for (size_t i = 0; i < this->numResults; i++) {
+    unpackResult((taco_tensor_t*)arguments[i], *content->boundStorage[i]);
+  }
+  return (result == 0);
+}
+
+bool Kernel::compute() const {
+  void** arguments = packBoundArguments(content->boundStorage,
+                                        content->boundArguments);
+  int result = ir::Module::callFuncPtrPackedRaw(content->computeShim,
+                                                arguments);
+  return (result == 0);
+}
+
+const vector<TensorVar>& Kernel::getParameters() const {
+  return content->parameters;
+}
+
 bool Kernel::defined() {
   return content != nullptr;
 }
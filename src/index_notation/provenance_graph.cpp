@@ -30,6 +30,9 @@ void IndexVarRel::print(std::ostream& stream) const {
       case SPLIT:
         getNode<SplitRelNode>()->print(stream);
         break;
+      case DIVIDE:
+        getNode<DivideRelNode>()->print(stream);
+        break;
       case POS:
         getNode<PosRelNode>()->print(stream);
         break;
@@ -56,6 +59,8 @@ bool IndexVarRel::equals(const IndexVarRel &rel) const {
   switch(getRelType()) {
     case SPLIT:
       return getNode<SplitRelNode>()->equals(*rel.getNode<SplitRelNode>());
+    case DIVIDE:
+      return getNode<DivideRelNode>()->equals(*rel.getNode<DivideRelNode>());
     case POS:
       return getNode<PosRelNode>()->equals(*rel.getNode<PosRelNode>());
       break;
@@ -262,6 +267,144 @@ bool operator==(const SplitRelNode& a, const SplitRelNode& b) {
   return a.equals(b);
 }
 
+struct DivideRelNode::Content {
+  IndexVar parentVar;
+  IndexVar outerVar;
+  IndexVar innerVar;
+  size_t divideFactor;
+};
+
+DivideRelNode::DivideRelNode(IndexVar parentVar, IndexVar outerVar, IndexVar innerVar, size_t divideFactor)
+  : IndexVarRelNode(DIVIDE), content(new Content) {
+  content->parentVar = parentVar;
+  content->outerVar = outerVar;
+  content->innerVar = innerVar;
+  content->divideFactor = divideFactor;
+}
+
+const IndexVar& DivideRelNode::getParentVar() const {
+  return content->parentVar;
+}
+const IndexVar& DivideRelNode::getOuterVar() const {
+  return content->outerVar;
+}
+const IndexVar& DivideRelNode::getInnerVar() const {
+  return content->innerVar;
+}
+const size_t& DivideRelNode::getDivideFactor() const {
+  return content->divideFactor;
+}
+
+void DivideRelNode::print(std::ostream &stream) const {
+  stream << "divide(" << getParentVar() << ", " << getOuterVar() << ", " << getInnerVar() << ", " << getDivideFactor() << ")";
+}
+
+bool DivideRelNode::equals(const DivideRelNode &rel) const {
+  return getParentVar() == rel.getParentVar() && getOuterVar() == rel.getOuterVar()
+        && getInnerVar() == rel.getInnerVar() && getDivideFactor() == rel.getDivideFactor();
+}
+
+std::vector<IndexVar> DivideRelNode::getParents() const {
+  return {getParentVar()};
+}
+
+std::vector<IndexVar> DivideRelNode::getChildren() const {
+  return {getOuterVar(), getInnerVar()};
+}
+
+std::vector<IndexVar> DivideRelNode::getIrregulars() const {
+  return {getOuterVar()};
+}
+
+ir::Expr DivideRelNode::getBlockSize(std::vector<ir::Expr> parentBound) const {
+  Datatype divideFactorType = parentBound[0].type();
+  ir::Expr extent = ir::Sub::make(parentBound[1], parentBound[0]);
+  return ir::Div::make(ir::Add::make(extent, ir::Literal::make(getDivideFactor()-1, divideFactorType)),
+                       ir::Literal::make(getDivideFactor(), divideFactorType));
+}
+
+std::vector<ir::Expr> DivideRelNode::computeRelativeBound(std::set<IndexVar> definedVars, std::map<IndexVar, std::vector<ir::Expr>> computedBounds, std::map<IndexVar, ir::Expr> variableExprs, Iterators iterators, ProvenanceGraph provGraph) const {
+  taco_iassert(computedBounds.count(getParentVar()) == 1);
+  std::vector<ir::Expr> parentBound = computedBounds.at(getParentVar());
+  bool outerVarDefined = definedVars.count(getOuterVar());
+  bool innerVarDefined = definedVars.count(getInnerVar());
+
+  if (provGraph.isPosVariable(getParentVar())) {
+    return parentBound; // dividing pos space does not change coordinate bounds
+  }
+
+  ir::Expr blockSize = getBlockSize(parentBound);
+
+  if (!outerVarDefined && !innerVarDefined) {
+    return parentBound;
+  }
+  else if(outerVarDefined && !innerVarDefined) {
+    // outerVar constrains space to a length blockSize strip starting at outerVar * blockSize
+    ir::Expr minBound = parentBound[0];
+    minBound = ir::Add::make(minBound, ir::Mul::make(variableExprs[getOuterVar()], blockSize));
+    ir::Expr maxBound = ir::Min::make(parentBound[1], ir::Add::make(minBound, blockSize));
+    return {minBound, maxBound};
+  }
+  else if(!outerVarDefined && innerVarDefined) {
+    // when innerVar is defined first does not limit coordinate space
+    return parentBound;
+  }
+  else {
+    taco_iassert(outerVarDefined && innerVarDefined);
+    // outerVar and innervar constrains space to a length 1 strip starting at outerVar * blockSize + innerVar
+    ir::Expr minBound = parentBound[0];
+    minBound = ir::Add::make(minBound, ir::Add::make(ir::Mul::make(variableExprs[getOuterVar()], blockSize), variableExprs[getInnerVar()]));
+    ir::Expr maxBound = ir::Min::make(parentBound[1], ir::Add::make(minBound, ir::Literal::make(1, variableExprs[getParentVar()].type())));
+    return {minBound, maxBound};
+  }
+}
+
+std::vector<ir::Expr> DivideRelNode::deriveIterBounds(taco::IndexVar indexVar,
+                                                      std::map<IndexVar, std::vector<ir::Expr>> parentIterBounds,
+                                                      std::map<IndexVar, std::vector<ir::Expr>> parentCoordBounds,
+                                                      std::map<taco::IndexVar, taco::ir::Expr> variableNames,
+                                                      Iterators iterators, ProvenanceGraph provGraph) const {
+  taco_iassert(indexVar == getOuterVar() || indexVar == getInnerVar());
+  taco_iassert(parentIterBounds.size() == 1);
+  taco_iassert(parentIterBounds.count(getParentVar()) == 1);
+
+  std::vector<ir::Expr> parentBound = parentIterBounds.at(getParentVar());
+  Datatype divideFactorType = parentBound[0].type();
+  if (indexVar == getOuterVar()) {
+    ir::Expr minBound = ir::Literal::make(0, divideFactorType);
+    ir::Expr maxBound = ir::Literal::make(getDivideFactor(), divideFactorType);
+    return {minBound, maxBound};
+  }
+  else if (indexVar == getInnerVar()) {
+    ir::Expr minBound = ir::Literal::make(0, divideFactorType);
+    ir::Expr maxBound = getBlockSize(parentBound);
+    return {minBound, maxBound};
+  }
+  taco_ierror;
+  return {};
+}
+
+ir::Expr DivideRelNode::recoverVariable(taco::IndexVar indexVar,
+                                        std::map<taco::IndexVar, taco::ir::Expr> variableNames,
+                                        Iterators iterators, std::map<IndexVar, std::vector<ir::Expr>> parentIterBounds, std::map<IndexVar, std::vector<ir::Expr>> parentCoordBounds, ProvenanceGraph provGraph) const {
+  taco_iassert(indexVar == getParentVar());
+  taco_iassert(variableNames.count(getParentVar()) && variableNames.count(getOuterVar()) && variableNames.count(getInnerVar()));
+  taco_iassert(parentIterBounds.count(getParentVar()) == 1);
+  std::vector<ir::Expr> parentBound = parentIterBounds.at(getParentVar());
+  ir::Expr blockStart = ir::Add::make(parentBound[0], ir::Mul::make(variableNames[getOuterVar()], getBlockSize(parentBound)));
+  return ir::Add::make(blockStart, variableNames[getInnerVar()]);
+}
+
+ir::Stmt DivideRelNode::recoverChild(taco::IndexVar indexVar,
+                                     std::map<taco::IndexVar, taco::ir::Expr> variableNames, bool emitVarDecl, Iterators iterators, ProvenanceGraph provGraph) const {
+  taco_not_supported_yet;
+  return ir::Stmt();
+}
+
+bool operator==(const DivideRelNode& a, const DivideRelNode& b) {
+  return a.equals(b);
+}
+
 struct PosRelNode::Content {
   Content(IndexVar parentVar, IndexVar posVar, Access access) : parentVar(parentVar), posVar(posVar), access(access) {}
   IndexVar parentVar;
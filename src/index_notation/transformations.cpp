@@ -499,7 +499,8 @@ IndexStmt Parallelize::apply(IndexStmt stmt, std::string* reason) const {
       MergeLattice lattice = MergeLattice::make(foralli, iterators, provGraph, definedIndexVars);
       // Precondition 3: No parallelization of variables under a reduction
       // variable (ie MergePoint has at least 1 result iterators)
-      if (parallelize.getOutputRaceStrategy() == OutputRaceStrategy::NoRaces && lattice.results().empty()
+      if ((parallelize.getOutputRaceStrategy() == OutputRaceStrategy::NoRaces ||
+           parallelize.getOutputRaceStrategy() == OutputRaceStrategy::ParallelAssembly) && lattice.results().empty()
           && lattice != MergeLattice({MergePoint({iterators.modeIterator(foralli.getIndexVar())}, {}, {})})) {
         reason = "Precondition failed: Free variables cannot be dominated by reduction variables in the iteration graph, "
                  "as this causes scatter behavior and we do not yet emit parallel synchronization constructs";
@@ -513,12 +514,27 @@ IndexStmt Parallelize::apply(IndexStmt stmt, std::string* reason) const {
           return;
         }
 
-        // Precondition 2: Every result iterator must have insert capability
+        // Precondition 2: Every result iterator must have insert capability,
+        // except that parallel assembly may append to the last result mode if
+        // its parent is the mode that the parallelized loop iterates over,
+        // since the appended segments are then located by the parallel
+        // iterations
         for (Iterator iterator : lattice.results()) {
+          const Iterator parallelIterator = iterator;
           while (true) {
             if (!iterator.hasInsert()) {
-              reason = "Precondition failed: The output tensor must allow inserts";
-              return;
+              if (parallelize.getOutputRaceStrategy() != OutputRaceStrategy::ParallelAssembly) {
+                reason = "Precondition failed: The output tensor must allow inserts";
+                return;
+              }
+              if (!iterator.hasAppend() || !iterator.isLeaf() || iterator.isBranchless() ||
+                  iterator == parallelIterator ||
+                  !(iterator.getParent() == parallelIterator)) {
+                reason = "Precondition failed: Parallel assembly requires the output tensor "
+                         "to allow inserts in every mode but the last, which must allow appends "
+                         "and be a child of the mode iterated by the parallelized loop";
+                return;
+              }
             }
             if (iterator.isLeaf()) {
               break;
@@ -677,6 +693,175 @@ IndexStmt parallelizeOuterLoop(IndexStmt stmt) {
   }
 }
 
+// The cost model of autoschedule, in which work is measured in components of
+// the operand that the outer loop iterates over.
+
+/// Statements with less work are not worth starting threads for.
+static const size_t minParallelWork = 1 << 14;
+
+/// Operands whose segment lengths vary more are split by their nonzeros.
+static const double maxSegmentLengthVariation = 1.0;
+
+/// The work of a chunk of rows, which is enough to amortize scheduling the
+/// chunk on a thread while leaving enough chunks to balance the threads.
+static const double rowChunkWork = 256.0;
+static const int maxRowsPerChunk = 256;
+
+/// The number of nonzeros in a chunk of nonzeros.
+static const size_t nonzerosPerChunk = 2048;
+
+static int getRowsPerChunk(const OperandStatistics& statistics) {
+  const double rows = rowChunkWork / std::max(statistics.meanSegmentLength, 1.0);
+  int rowsPerChunk = 1;
+  while (rowsPerChunk * 2 <= rows && rowsPerChunk * 2 <= maxRowsPerChunk) {
+    rowsPerChunk *= 2;
+  }
+  return rowsPerChunk;
+}
+
+/// Parallelize the outer loop over chunks of rows, with the first race
+/// strategy that the statement allows, where atomics are only allowed if
+/// requested. Parallel assembly is only allowed
+/// into results whose appended mode is a child of the mode that the outer
+/// loop iterates over (e.g. CSR matrices), since it locates the segment of
+/// each row from the counts of the rows. Returns an undefined statement if
+/// no strategy is allowed.
+static IndexStmt parallelizeRows(IndexStmt stmt, IndexVar i,
+                                 const OperandStatistics& statistics,
+                                 bool allowAtomics) {
+  const int rowsPerChunk = getRowsPerChunk(statistics);
+  for (auto strategy : {OutputRaceStrategy::NoRaces,
+                        OutputRaceStrategy::ParallelAssembly,
+                        OutputRaceStrategy::Atomics}) {
+    if (strategy == OutputRaceStrategy::Atomics && !allowAtomics) {
+      break;
+    }
+    string reason;
+    IndexStmt parallelized =
+        Parallelize(i, ParallelUnit::CPUThread, strategy).apply(stmt, &reason);
+    if (!parallelized.defined()) {
+      continue;
+    }
+    // Parallel assembly gives every iteration of the parallel loop its own
+    // segment of the result, so that loop is not split
+    if (rowsPerChunk == 1 || strategy == OutputRaceStrategy::ParallelAssembly) {
+      return parallelized;
+    }
+    // The loop over chunks writes no results, so whether it may be
+    // parallelized follows from whether the loop over rows may be
+    IndexVar i0(i.getName() + "0"), i1(i.getName() + "1");
+    IndexStmt chunked = Parallelize(i0, ParallelUnit::CPUThread, strategy)
+        .apply(stmt.split(i, i0, i1, rowsPerChunk), &reason);
+    return chunked.defined() ? chunked : parallelized;
+  }
+  return IndexStmt();
+}
+
+/// Fuse the two outer loops, which iterate over the first two levels of the
+/// sparse operand, and parallelize over chunks of the operand's nonzeros, so
+/// that long rows are shared by threads. Chunks may share rows, so they
+/// write the result with atomics. Returns an undefined statement if the
+/// statement does not have this form.
+static IndexStmt parallelizeNonzeros(IndexStmt stmt, Forall foralli,
+                                     Access access) {
+  if (!isa<Forall>(foralli.getStmt())) {
+    return IndexStmt();
+  }
+  IndexVar i = foralli.getIndexVar();
+  IndexVar j = to<Forall>(foralli.getStmt()).getIndexVar();
+
+  const Format& format = access.getTensorVar().getFormat();
+  const vector<int>& modeOrdering = format.getModeOrdering();
+  const vector<IndexVar>& indexVars = access.getIndexVars();
+  if (format.getOrder() < 2 ||
+      format.getModeFormats()[1].getName() != "compressed" ||
+      indexVars[modeOrdering[0]] != i || indexVars[modeOrdering[1]] != j) {
+    return IndexStmt();
+  }
+
+  // The position loop can only coiterate the operand with dense operands
+  for (auto& argument : getArgumentAccesses(stmt)) {
+    if (argument.getTensorVar() == access.getTensorVar()) {
+      continue;
+    }
+    for (auto& modeFormat : argument.getTensorVar().getFormat()
+                                    .getModeFormats()) {
+      if (modeFormat.getName() != "dense") {
+        return IndexStmt();
+      }
+    }
+  }
+
+  string reason;
+  if (!Parallelize(i, ParallelUnit::CPUThread, OutputRaceStrategy::Atomics)
+      .apply(stmt, &reason).defined()) {
+    return IndexStmt();
+  }
+  IndexVar f("f"), fpos("fpos"), chunk("chunk"), fpos1("fpos1");
+  IndexStmt balanced = stmt.fuse(i, j, f)
+                           .pos(f, fpos, access)
+                           .split(fpos, chunk, fpos1, nonzerosPerChunk);
+  return Parallelize(chunk, ParallelUnit::CPUThread,
+                     OutputRaceStrategy::Atomics).apply(balanced, &reason);
+}
+
+IndexStmt autoschedule(IndexStmt stmt,
+                       const map<TensorVar,OperandStatistics>& statistics,
+                       bool allowAtomics) {
+  if (should_use_CUDA_codegen()) {
+    return parallelizeOuterLoop(stmt);
+  }
+
+  // get outer ForAll
+  Forall forall;
+  bool matched = false;
+  match(stmt,
+        function<void(const ForallNode*,Matcher*)>([&forall, &matched](
+                const ForallNode* node, Matcher* ctx) {
+          if (!matched) forall = node;
+          matched = true;
+        })
+  );
+  if (!matched) return stmt;
+  IndexVar i = forall.getIndexVar();
+
+  // The outer loop iterates over the largest operand whose first stored
+  // level it iterates over
+  const vector<Access> arguments = getArgumentAccesses(stmt);
+  const Access* access = nullptr;
+  const OperandStatistics* accessStatistics = nullptr;
+  for (auto& argument : arguments) {
+    const TensorVar& tensor = argument.getTensorVar();
+    if (tensor.getOrder() == 0 || !util::contains(statistics, tensor) ||
+        argument.getIndexVars()[tensor.getFormat().getModeOrdering()[0]] != i) {
+      continue;
+    }
+    if (!accessStatistics || statistics.at(tensor).nnz > accessStatistics->nnz) {
+      access = &argument;
+      accessStatistics = &statistics.at(tensor);
+    }
+  }
+  if (!accessStatistics) {
+    return parallelizeOuterLoop(stmt);
+  }
+
+  if (accessStatistics->nnz < minParallelWork) {
+    return stmt;
+  }
+
+  if (allowAtomics &&
+      accessStatistics->segmentLengthVariation > maxSegmentLengthVariation) {
+    IndexStmt balanced = parallelizeNonzeros(stmt, forall, *access);
+    if (balanced.defined()) {
+      return balanced;
+    }
+  }
+
+  IndexStmt parallelized = parallelizeRows(stmt, i, *accessStatistics,
+                                           allowAtomics);
+  return parallelized.defined() ? parallelized : stmt;
+}
+
 // Takes in a set of pairs of IndexVar and level for a given tensor and orders
 // the IndexVars by tensor level
 static vector<pair<IndexVar, bool>> 
@@ -1052,8 +1237,13 @@ static bool compare(std::vector<IndexVar> vars1, std::vector<IndexVar> vars2) {
   return vars1 == vars2;
 }
 
-// TODO Temporary function to insert workspaces into SpMM kernels
-static IndexStmt optimizeSpMM(IndexStmt stmt) {
+/// Rewrites forall(i, forall(k, forall(j, A(i,j) += expr))), where k is a
+/// reduction variable and A is {dense, compressed}, to scatter the
+/// components of each row of A into a dense workspace, since the compressed
+/// mode of A can only be appended to in order. The workspace reduces with the
+/// operator of the assignment. This covers SpGEMM and SDDMM with their loops
+/// in the order that reorderLoopsTopologically gives them.
+static IndexStmt insertRowWorkspace(IndexStmt stmt) {
   if (!isa<Forall>(stmt)) {
     return stmt;
   }
@@ -1077,32 +1267,11 @@ static IndexStmt optimizeSpMM(IndexStmt stmt) {
   }
   Assignment assignment = to<Assignment>(forallj.getStmt());
 
-  if (!isa<Mul>(assignment.getRhs())) {
-    return stmt;
-  }
-  Mul mul = to<Mul>(assignment.getRhs());
-
   taco_iassert(isa<Access>(assignment.getLhs()));
-  if (!isa<Access>(mul.getA())) {
-    return stmt;
-  }
-  if (!isa<Access>(mul.getB())) {
-    return stmt;
-  }
-
   Access Aaccess = to<Access>(assignment.getLhs());
-  Access Baccess = to<Access>(mul.getA());
-  Access Caccess = to<Access>(mul.getB());
-
-  if (Aaccess.getIndexVars().size() != 2 ||
-      Baccess.getIndexVars().size() != 2 ||
-      Caccess.getIndexVars().size() != 2) {
-    return stmt;
-  }
-
   if (!compare(Aaccess.getIndexVars(), {i,j}) ||
-      !compare(Baccess.getIndexVars(), {i,k}) ||
-      !compare(Caccess.getIndexVars(), {k,j})) {
+      !assignment.getOperator().defined() ||
+      !util::contains(assignment.getReductionVars(), k)) {
     return stmt;
   }
 
@@ -1114,23 +1283,6 @@ static IndexStmt optimizeSpMM(IndexStmt stmt) {
     return stmt;
   }
 
-  TensorVar B = Baccess.getTensorVar();
-  if (B.getFormat().getModeFormats()[0].getName() != "dense" ||
-      B.getFormat().getModeFormats()[1].getName() != "compressed" ||
-      B.getFormat().getModeOrdering()[0] != 0 ||
-      B.getFormat().getModeOrdering()[1] != 1) {
-    return stmt;
-  }
-
-  TensorVar C = Caccess.getTensorVar();
-  if (C.getFormat().getModeFormats()[0].getName() != "dense" ||
-      C.getFormat().getModeFormats()[1].getName() != "compressed" ||
-      C.getFormat().getModeOrdering()[0] != 0 ||
-      C.getFormat().getModeOrdering()[1] != 1) {
-    return stmt;
-  }
-
-  // It's an SpMM statement so return an optimized SpMM statement
   TensorVar w("w",
               Type(A.getType().getDataType(), 
               {A.getType().getShape().getDimension(1)}),
@@ -1140,16 +1292,12 @@ static IndexStmt optimizeSpMM(IndexStmt stmt) {
                              A(i,j) = w(j)),
                       forall(k,
                              forall(j,
-                                    w(j) += B(i,k) * C(k,j)))));
+                                    Assignment(w(j), assignment.getRhs(),
+                                               assignment.getOperator())))));
 }
 
 IndexStmt insertTemporaries(IndexStmt stmt)
 {
-  IndexStmt spmm = optimizeSpMM(stmt);
-  if (spmm != stmt) {
-    return spmm;
-  }
-
   // TODO Implement general workspacing when scattering into sparse result modes
 
   // Result dimensions that are indexed by free variables dominated by a
@@ -1157,11 +1305,7 @@ IndexStmt insertTemporaries(IndexStmt stmt)
   // then we introduce a dense workspace to scatter into instead.  The where
   // statement must push the reduction loop into the producer side, leaving
   // only the free variable loops on the consumer side.
-
-  //vector<IndexVar> reductionVars = getReductionVars(stmt);
-  //...
-
-  return stmt;
+  return insertRowWorkspace(stmt);
 }
 
 }
@@ -817,6 +817,19 @@ Expr GetProperty::make(Expr tensor, TensorProperty property, int mode,
   return gp;
 }
 
+Expr GetProperty::make(Expr tensor, TensorProperty property, int mode,
+                       int index, std::string name, Datatype type) {
+  taco_iassert(property == TensorProperty::Indices);
+  GetProperty* gp = new GetProperty;
+  gp->tensor = tensor;
+  gp->property = property;
+  gp->mode = mode;
+  gp->name = name;
+  gp->index = index;
+  gp->type = type;
+  return gp;
+}
+
 
 // GetProperty
 Expr GetProperty::make(Expr tensor, TensorProperty property, int mode) {
@@ -37,7 +37,7 @@ Stmt doubleSizeIfFull(Expr a, Expr size, Expr needed) {
 }
 
 Stmt atLeastDoubleSizeIfFull(Expr a, Expr size, Expr needed) {
-  Expr newSizeVar = Var::make(util::toString(a) + "_new_size", Int());
+  Expr newSizeVar = Var::make(util::toString(a) + "_new_size", size.type());
   Expr newSize = Max::make(Mul::make(size, 2), Add::make(needed, 1));
   Stmt computeNewSize = VarDecl::make(newSizeVar, newSize);
   Stmt realloc = Allocate::make(a, newSizeVar, true, size);
@@ -46,4 +46,57 @@ Stmt atLeastDoubleSizeIfFull(Expr a, Expr size, Expr needed) {
   return IfThenElse::make(Lte::make(size, needed), ifBody);
 }
 
+Stmt parallelPrefixSum(Expr a, Expr begin, Expr end) {
+  const int blockSize = 2048;
+  const std::string name = util::toString(a);
+  const Datatype type = a.type();
+
+  Expr numBlocks = Var::make(name + "_blocks", type);
+  Expr blockSums = Var::make(name + "_block_sums", type, true, false);
+  Stmt declNumBlocks = VarDecl::make(numBlocks, 
+      Div::make(Add::make(Sub::make(end, begin), blockSize - 1), blockSize));
+  Stmt allocBlockSums = Block::make({VarDecl::make(blockSums, 0), 
+      Allocate::make(blockSums, Add::make(numBlocks, 1))});
+
+  // Generate the bounds of block `b` of `a[begin:end]`
+  auto blockBounds = [&](Expr b, Expr lo, Expr hi) {
+    Expr blockBegin = Add::make(begin, Mul::make(b, blockSize));
+    return Block::make({VarDecl::make(lo, blockBegin),
+        VarDecl::make(hi, Min::make(Add::make(lo, blockSize), end))});
+  };
+
+  // Scan each block and record its sum
+  Expr b = Var::make(name + "_block", type);
+  Expr lo = Var::make(name + "_lo", type);
+  Expr hi = Var::make(name + "_hi", type);
+  Expr sum = Var::make(name + "_sum", type);
+  Expr p = Var::make("p" + name, type);
+  Stmt scanElement = Block::make({compoundAssign(sum, Load::make(a, p)), 
+                                  Store::make(a, p, sum)});
+  Stmt scanBlock = Block::make({blockBounds(b, lo, hi), VarDecl::make(sum, 0),
+      For::make(p, lo, hi, 1, scanElement),
+      Store::make(blockSums, Add::make(b, 1), sum)});
+  Stmt scanBlocks = For::make(b, 0, numBlocks, 1, scanBlock, LoopKind::Static, 
+                              ParallelUnit::CPUThread);
+
+  // Scan the block sums to get the offset of each block
+  Expr s = Var::make(name + "_block", type);
+  Stmt scanSums = Block::make({Store::make(blockSums, 0, 0), 
+      For::make(s, 0, numBlocks, 1, 
+                compoundStore(blockSums, Add::make(s, 1), Load::make(blockSums, s)))});
+
+  // Offset each block by the sum of the blocks before it
+  Expr o = Var::make(name + "_block", type);
+  Expr olo = Var::make(name + "_lo", type);
+  Expr ohi = Var::make(name + "_hi", type);
+  Expr op = Var::make("p" + name, type);
+  Stmt offsetBlock = Block::make({blockBounds(o, olo, ohi), 
+      For::make(op, olo, ohi, 1, compoundStore(a, op, Load::make(blockSums, o)))});
+  Stmt offsetBlocks = For::make(o, 1, numBlocks, 1, offsetBlock, 
+                                LoopKind::Static, ParallelUnit::CPUThread);
+
+  return Block::make({declNumBlocks, allocBlockSums, scanBlocks, scanSums, 
+                      offsetBlocks, Free::make(blockSums)});
+}
+
 }}
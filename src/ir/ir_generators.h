@@ -27,5 +27,10 @@ Stmt doubleSizeIfFull(Expr a, Expr size, Expr loc);
 /// least equal to `loc` if it is full (loc cannot be written to).
 Stmt atLeastDoubleSizeIfFull(Expr a, Expr size, Expr loc);
 
+/// Generate a statement that replaces `a[begin:end]` with its inclusive prefix 
+/// sum, scanning fixed-size blocks of `a` in parallel and then offsetting each 
+/// block by the sum of the blocks before it.
+Stmt parallelPrefixSum(Expr a, Expr begin, Expr end);
+
 }}
 #endif
@@ -418,7 +418,20 @@ void IRPrinter::visit(const While* op) {
 }
 
 void IRPrinter::visit(const Block* op) {
-  acceptJoin(this, stream, op->contents, "");
+  for (auto& stmt : op->contents) {
+    // Scopes that are not the body of a loop or conditional are printed as
+    // compound statements
+    if (isa<Scope>(stmt)) {
+      doIndent();
+      stream << "{" << endl;
+      stmt.accept(this);
+      doIndent();
+      stream << "}" << endl;
+    }
+    else {
+      stmt.accept(this);
+    }
+  }
 }
 
 void IRPrinter::visit(const Scope* op) {
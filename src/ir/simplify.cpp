@@ -404,7 +404,7 @@ ir::Stmt simplify(const ir::Stmt& stmt) {
     void visit(const Scope* scope) {
       declarations.scope();
       varsToReplace.scope();
-      stmt = rewrite(scope->scopedStmt);
+      stmt = Scope::make(rewrite(scope->scopedStmt));
       varsToReplace.unscope();
       declarations.unscope();
     }
@@ -0,0 +1,198 @@
+#include "taco/kernel_bundle.h"
+
+#include <cctype>
+#include <dlfcn.h>
+#include <map>
+#include <mutex>
+#include <shared_mutex>
+#include <sstream>
+#include <unordered_map>
+
+#include "taco/error.h"
+#include "taco/index_notation/transformations.h"
+#include "taco/lower/lower.h"
+#include "taco/lower/lowerer_impl.h"
+#include "taco/util/strings.h"
+
+using namespace std;
+using namespace taco::ir;
+
+namespace taco {
+
+// This *must* be kept in sync with taco_kernel_t.h
+static const string kernelTypeDecl =
+  "#ifndef TACO_KERNEL_T_DEFINED\n"
+  "#define TACO_KERNEL_T_DEFINED\n"
+  "typedef struct taco_kernel_t {\n"
+  "  uint64_t hash;\n"
+  "  const char* key;\n"
+  "  int32_t  assemble_while_compute;\n"
+  "  int32_t  symbolic_assembly;\n"
+  "  int    (*assemble)(void**);\n"
+  "  int    (*compute)(void**);\n"
+  "} taco_kernel_t;\n"
+  "#endif\n";
+
+static IndexStmt makeKernelStmt(IndexStmt stmt) {
+  return scalarPromote(stmt.concretize());
+}
+
+/// The isomorphic key of a statement as hex digits, so that registries can
+/// store it as a C string.
+static string getHexKey(IndexStmt stmt) {
+  static const char digits[] = "0123456789abcdef";
+  const string key = isomorphicKey(stmt);
+  string hexKey;
+  hexKey.reserve(2 * key.size());
+  for (unsigned char c : key) {
+    hexKey += digits[c >> 4];
+    hexKey += digits[c & 0xf];
+  }
+  return hexKey;
+}
+
+KernelBundle::KernelBundle() {
+}
+
+void KernelBundle::add(const TensorBase& tensor) {
+  add(tensor.makeCompileStmt(), tensor.content->assembleWhileCompute,
+      tensor.content->symbolicAssembly);
+}
+
+void KernelBundle::add(IndexStmt stmt, bool assembleWhileCompute,
+                       bool symbolicAssembly) {
+  stmt = makeKernelStmt(stmt);
+  for (auto& kernel : kernels) {
+    if (kernel.assembleWhileCompute == assembleWhileCompute &&
+        kernel.symbolicAssembly == symbolicAssembly &&
+        isomorphic(kernel.stmt, stmt)) {
+      return;
+    }
+  }
+  kernels.push_back({stmt, assembleWhileCompute, symbolicAssembly});
+}
+
+size_t KernelBundle::getNumKernels() const {
+  return kernels.size();
+}
+
+shared_ptr<Module> KernelBundle::makeModule(string prefix) const {
+  taco_uassert(!prefix.empty() && !isdigit(prefix[0])) <<
+      "The prefix of a kernel bundle must be a C identifier";
+  for (char c : prefix) {
+    taco_uassert(isalnum(c) || c == '_') <<
+        "The prefix of a kernel bundle must be a C identifier";
+  }
+
+  auto module = make_shared<Module>();
+  stringstream registry;
+  registry << kernelTypeDecl;
+  registry << "const taco_kernel_t " << prefix << "_kernels[] = {\n";
+  for (size_t i = 0; i < kernels.size(); ++i) {
+    const Kernel& kernel = kernels[i];
+    const string assembleName = prefix + "_assemble_" + util::toString(i);
+    const string computeName = prefix + "_compute_" + util::toString(i);
+    Lowerer assembleLowerer, computeLowerer;
+    assembleLowerer.getLowererImpl()->setSymbolicAssembly(
+        kernel.symbolicAssembly);
+    computeLowerer.getLowererImpl()->setSymbolicAssembly(
+        kernel.symbolicAssembly);
+    module->addFunction(lower(kernel.stmt, assembleName, true, false, false,
+                              false, assembleLowerer));
+    module->addFunction(lower(kernel.stmt, computeName,
+                              kernel.assembleWhileCompute, true, false, false,
+                              computeLowerer));
+    registry << "  {" << isomorphicHash(kernel.stmt) << "ull, "
+             << "\"" << getHexKey(kernel.stmt) << "\", "
+             << kernel.assembleWhileCompute << ", "
+             << kernel.symbolicAssembly << ", "
+             << "_shim_" << assembleName << ", "
+             << "_shim_" << computeName << "},\n";
+  }
+  registry << "};\n";
+  registry << "const int32_t " << prefix << "_num_kernels = "
+           << kernels.size() << ";\n";
+
+  stringstream declarations;
+  declarations << kernelTypeDecl;
+  declarations << "extern const taco_kernel_t " << prefix << "_kernels[];\n";
+  declarations << "extern const int32_t " << prefix << "_num_kernels;\n";
+  module->addSource(registry.str(), declarations.str());
+  return module;
+}
+
+void KernelBundle::compileToStaticLibrary(string path, string prefix) {
+  makeModule(prefix)->compileToStaticLibrary(path, prefix);
+}
+
+void KernelBundle::compileToSharedLibrary(string path, string prefix) {
+  makeModule(prefix)->compileToSharedLibrary(path, prefix);
+}
+
+// The registered kernels, hashed by the isomorphic hash of their index
+// statements, and the modules that call them.
+struct RegisteredKernel {
+  const taco_kernel_t* kernel;
+  shared_ptr<Module> module;
+};
+typedef unordered_map<uint64_t, vector<RegisteredKernel>> KernelRegistry;
+static KernelRegistry registeredKernels;
+static shared_timed_mutex registeredKernelsMutex;
+
+void registerKernels(const taco_kernel_t* kernels, int numKernels) {
+  unique_lock<shared_timed_mutex> lock(registeredKernelsMutex);
+  for (int i = 0; i < numKernels; ++i) {
+    auto& bucket = registeredKernels[kernels[i].hash];
+    bucket.insert(bucket.begin(), {&kernels[i], nullptr});
+  }
+}
+
+void loadKernelBundle(string path, string prefix) {
+  // Bundles are never unloaded, since tensors may call their kernels at any
+  // time.
+  void* handle = dlopen(path.c_str(), RTLD_NOW | RTLD_LOCAL);
+  taco_uassert(handle) << "Failed to load kernel bundle " << path << ": "
+                       << dlerror();
+  auto kernels = (const taco_kernel_t*)dlsym(handle,
+                                             (prefix + "_kernels").c_str());
+  auto numKernels = (const int32_t*)dlsym(handle,
+                                          (prefix + "_num_kernels").c_str());
+  taco_uassert(kernels && numKernels) << path << " is not a kernel bundle "
+                                      << "with prefix " << prefix;
+  registerKernels(kernels, *numKernels);
+}
+
+shared_ptr<Module> getBundledKernel(IndexStmt stmt, bool assembleWhileCompute,
+                                    bool symbolicAssembly) {
+  const uint64_t hash = isomorphicHash(stmt);
+  {
+    shared_lock<shared_timed_mutex> lock(registeredKernelsMutex);
+    if (registeredKernels.find(hash) == registeredKernels.end()) {
+      return nullptr;
+    }
+  }
+
+  // Hashes may collide, so the key confirms that the statements are
+  // isomorphic.
+  const string hexKey = getHexKey(stmt);
+  unique_lock<shared_timed_mutex> lock(registeredKernelsMutex);
+  for (auto& registered : registeredKernels.at(hash)) {
+    if ((bool)registered.kernel->assemble_while_compute !=
+            assembleWhileCompute ||
+        (bool)registered.kernel->symbolic_assembly != symbolicAssembly ||
+        hexKey != registered.kernel->key) {
+      continue;
+    }
+    if (!registered.module) {
+      registered.module = make_shared<Module>();
+      registered.module->setPrecompiledFunctions({
+        {"_shim_assemble", (void*)registered.kernel->assemble},
+        {"_shim_compute", (void*)registered.kernel->compute}
+      });
+    }
+    return registered.module;
+  }
+  return nullptr;
+}
+
+}
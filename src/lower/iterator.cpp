@@ -69,12 +69,13 @@ Iterator::Iterator(IndexVar indexVar, Expr tensor, Mode mode, Iterator parent,
   if (useNameForPos) {
     posNamePrefix = name;
   }
-  content->posVar   = Var::make(name,            Int());
-  content->endVar   = Var::make("p" + modeName + "_end",   Int());
-  content->beginVar = Var::make("p" + modeName + "_begin", Int());
+  const Datatype posType = mode.getPositionType();
+  content->posVar   = Var::make(name,            posType);
+  content->endVar   = Var::make("p" + modeName + "_end",   posType);
+  content->beginVar = Var::make("p" + modeName + "_begin", posType);
 
   content->coordVar = Var::make(name, Int());
-  content->segendVar = Var::make(modeName + "_segend", Int());
+  content->segendVar = Var::make(modeName + "_segend", posType);
   content->validVar = Var::make("v" + modeName, Bool);
 }
 
@@ -319,6 +320,19 @@ Stmt Iterator::getAppendFinalizeLevel(const Expr& szPrev, const Expr& sz) const{
                                                               getMode());
 }
 
+Stmt Iterator::getAppendResizeLevel(const Expr& szPrev, const Expr& sz) const{
+  taco_iassert(defined() && content->mode.defined());
+  return getMode().getModeFormat().impl->getAppendResizeLevel(szPrev, sz,
+                                                            getMode());
+}
+
+Stmt Iterator::getParallelAppendFinalizeLevel(const Expr& szPrev, 
+                                              const Expr& sz) const {
+  taco_iassert(defined() && content->mode.defined());
+  return getMode().getModeFormat().impl->getParallelAppendFinalizeLevel(
+      szPrev, sz, getMode());
+}
+
 bool Iterator::defined() const {
   return content != nullptr;
 }
@@ -452,7 +466,9 @@ Iterators::createAccessIterators(Access access, Format format, Expr tensorIR, Pr
     int modeNumber = format.getModeOrdering()[level-1];
     ModePack modePack(modeTypePack.getModeFormats().size(),
                       modeTypePack.getModeFormats()[0], tensorIR,
-                      modeNumber, level);
+                      modeNumber, level,
+                      {format.getCoordinateTypePos(level-1),
+                       format.getCoordinateTypeIdx(level-1)});
 
     int pos = 0;
     for (auto& modeType : modeTypePack.getModeFormats()) {
@@ -468,7 +484,7 @@ Iterators::createAccessIterators(Access access, Format format, Expr tensorIR, Pr
         iteratorIndexVar = indexVar;
       }
       Mode mode(tensorIR, dim, level, modeType, modePack, pos,
-                parentModeType);
+                parentModeType, format.getPositionType(level-1));
 
       string name = iteratorIndexVar.getName() + tensorConcrete.getName();
       Iterator iterator(iteratorIndexVar, tensorIR, mode, parent, name, true);
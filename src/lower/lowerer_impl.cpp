@@ -65,11 +65,21 @@ LowererImpl::LowererImpl() : visitor(new Visitor(this)) {
 }
 
 
+/// The binary search routines that generated code calls search int arrays.
+static void checkSearchedArray(Expr array) {
+  taco_uassert(array.type() == Int32) <<
+      "Index arrays must be Int32 to be searched by this schedule, not " <<
+      array.type();
+}
+
 static void createCapacityVars(const map<TensorVar, Expr>& tensorVars,
                                map<Expr, Expr>* capacityVars) {
   for (auto& tensorVar : tensorVars) {
     Expr tensor = tensorVar.second;
-    Expr capacityVar = Var::make(util::toString(tensor) + "_capacity", Int());
+    const Format format = tensorVar.first.getFormat();
+    Datatype type = (format.getOrder() > 0)
+                    ? format.getPositionType(format.getOrder() - 1) : Int();
+    Expr capacityVar = Var::make(util::toString(tensor) + "_capacity", type);
     capacityVars->insert({tensor, capacityVar});
   }
 }
@@ -104,6 +114,32 @@ static bool hasStores(Stmt stmt) {
   return stmt.defined() && FindStores().hasStores(stmt);
 }
 
+/// Returns true iff `stmt` assigns to one of `vars`
+static bool hasAssigns(Stmt stmt, const set<Expr>& vars) {
+  struct FindAssigns : IRVisitor {
+    const set<Expr>& vars;
+    bool hasAssign = false;
+
+    FindAssigns(const set<Expr>& vars) : vars(vars) {}
+
+    using IRVisitor::visit;
+
+    void visit(const Assign* stmt) {
+      hasAssign = hasAssign || util::contains(vars, stmt->lhs);
+    }
+  };
+  if (!stmt.defined()) {
+    return false;
+  }
+  FindAssigns findAssigns(vars);
+  stmt.accept(&findAssigns);
+  return findAssigns.hasAssign;
+}
+
+void LowererImpl::setSymbolicAssembly(bool symbolicAssembly) {
+  this->symbolicAssembly = symbolicAssembly;
+}
+
 Stmt
 LowererImpl::lower(IndexStmt stmt, string name, 
                    bool assemble, bool compute, bool pack, bool unpack)
@@ -231,6 +267,27 @@ LowererImpl::lower(IndexStmt stmt, string name,
   Stmt initializeResults = initResultArrays(resultAccesses, inputAccesses, 
                                             reducedAccesses);
 
+  // Count the result components before the numeric phase if assembling in two
+  // phases, which parallel assembly requires
+  parallelAssembly = false;
+  match(stmt,
+    function<void(const ForallNode*)>([&](const ForallNode* op) {
+      if (op->output_race_strategy == OutputRaceStrategy::ParallelAssembly) {
+        parallelAssembly = true;
+      }
+    })
+  );
+  Stmt symbolicAssembly;
+  if (generateAssembleCode() && (this->symbolicAssembly || parallelAssembly)) {
+    if (canAssembleSymbolically(resultAccesses)) {
+      symbolicAssembly = lowerSymbolicAssembly(stmt, resultAccesses);
+    } else {
+      taco_uassert(!parallelAssembly) << "Parallel assembly requires results "
+          << "whose last mode supports append and whose other modes support "
+          << "insert";
+    }
+  }
+
   // Lower the index statement to compute and/or assemble
   Stmt body = lower(stmt);
 
@@ -255,6 +312,7 @@ LowererImpl::lower(IndexStmt stmt, string name,
   return Function::make(name, resultsIR, argumentsIR,
                         Block::blanks(Block::make(header),
                                       initializeResults,
+                                      symbolicAssembly,
                                       body,
                                       finalizeResults,
                                       Block::make(footer)));
@@ -357,6 +415,9 @@ Stmt LowererImpl::lowerForall(Forall forall)
   if (forall.getParallelUnit() != ParallelUnit::NotParallel) {
     inParallelLoopDepth++;
   }
+  if (forall.getOutputRaceStrategy() == OutputRaceStrategy::ParallelAssembly) {
+    inParallelAssemblyDepth++;
+  }
 
   // Recover any available parents that were not recoverable previously
   vector<Stmt> recoverySteps;
@@ -408,6 +469,11 @@ Stmt LowererImpl::lowerForall(Forall forall)
   set<Access> reducedAccesses;
   std::tie(resultAccesses, reducedAccesses) = getResultAccesses(forall);
 
+  // Iterations of a parallel assembly loop append to their own segments of 
+  // the results, so declare private positions at the start of the segments
+  Stmt declSegmentPositions = (inParallelAssemblyDepth > 0)
+      ? declSegmentPosVars(forall.getIndexVar(), resultAccesses) : Stmt();
+
   // Pre-allocate/initialize memory of value arrays that are full below this
   // loops index variable
   Stmt preInitValues = initResultArrays(forall.getIndexVar(), resultAccesses,
@@ -476,9 +542,10 @@ Stmt LowererImpl::lowerForall(Forall forall)
   }
 //  taco_iassert(loops.defined());
 
-  if (!generateComputeCode() && !hasStores(loops)) {
-    // If assembly loop does not modify output arrays, then it can be safely 
-    // omitted.
+  if (!generateComputeCode() && !hasStores(loops) &&
+      !(symbolicPhase && hasAssigns(loops, symbolicPosVars))) {
+    // If assembly loop does not modify output arrays or count their 
+    // components, then it can be safely omitted.
     loops = Stmt();
   }
   definedIndexVars.erase(forall.getIndexVar());
@@ -490,7 +557,11 @@ Stmt LowererImpl::lowerForall(Forall forall)
     parallelUnitIndexVars.erase(forall.getParallelUnit());
     parallelUnitSizes.erase(forall.getParallelUnit());
   }
-  return Block::blanks(preInitValues,
+  if (forall.getOutputRaceStrategy() == OutputRaceStrategy::ParallelAssembly) {
+    inParallelAssemblyDepth--;
+  }
+  return Block::blanks(declSegmentPositions,
+                       preInitValues,
                        loops);
 }
 
@@ -684,6 +755,7 @@ Stmt LowererImpl::searchForFusedPositionStart(Forall forall, Iterator posIterato
       }
       taco_iassert(blockSize.defined());
 
+      checkSearchedArray(posIteratorLevel.getMode().getModePack().getArray(0));
       if (i == (int) underivedAncestors.size() - 2) {
         std::vector<Expr> args = {
                 posIteratorLevel.getMode().getModePack().getArray(0), // array
@@ -759,6 +831,7 @@ Stmt LowererImpl::searchForFusedPositionStart(Forall forall, Iterator posIterato
       underivedStartTarget = this->iterators.modeIterator(underivedAncestors[i+1]).getPosVar();
     }
 
+    checkSearchedArray(posIteratorLevel.getMode().getModePack().getArray(0));
     vector<Expr> binarySearchArgs = {
             posIteratorLevel.getMode().getModePack().getArray(0), // array
             posIteratorLevel.getBeginVar(), // arrayStart
@@ -843,11 +916,11 @@ Stmt LowererImpl::lowerForallPosition(Forall forall, Iterator iterator,
                                       ir::Stmt recoveryStmt)
 {
   Expr coordinate = getCoordinateVar(forall.getIndexVar());
+  ModeFunction posAccess = iterator.posAccess(iterator.getPosVar(),
+                                              coordinates(iterator));
   Stmt declareCoordinate = Stmt();
   if (provGraph.isCoordVariable(forall.getIndexVar())) {
-    Expr coordinateArray = iterator.posAccess(iterator.getPosVar(),
-                                              coordinates(iterator)).getResults()[0];
-    declareCoordinate = VarDecl::make(coordinate, coordinateArray);
+    declareCoordinate = VarDecl::make(coordinate, posAccess.getResults()[0]);
   }
   if (forall.getParallelUnit() != ParallelUnit::NotParallel && forall.getOutputRaceStrategy() == OutputRaceStrategy::Atomics) {
     markAssignsAtomicDepth++;
@@ -860,6 +933,11 @@ Stmt LowererImpl::lowerForallPosition(Forall forall, Iterator iterator,
     markAssignsAtomicDepth--;
   }
 
+  // Skip positions that do not store a coordinate (e.g. empty hash slots)
+  if (!isValue(posAccess.getResults()[1], true)) {
+    body = IfThenElse::make(posAccess.getResults()[1], body);
+  }
+
   body = Block::make(recoveryStmt, body);
 
   // Code to append positions
@@ -1263,13 +1341,15 @@ Stmt LowererImpl::lowerForallBody(Expr coordinate, IndexStmt stmt,
   // Code to append coordinates
   Stmt appendCoords = appendCoordinate(appenders, coordinate);
 
-  // TODO: Emit code to insert coordinates
+  // Code to insert coordinates
+  Stmt insertCoords = insertCoordinates(inserters);
 
   return Block::make(initVals,
                      declInserterPosVars,
                      declLocatorPosVars,
                      body,
-                     appendCoords);
+                     appendCoords,
+                     insertCoords);
 }
 
 
@@ -1592,12 +1672,16 @@ vector<Expr> LowererImpl::coordinates(vector<Iterator> iterators)
 
 
 /// Returns true iff a result mode is assembled by inserting a sparse set of 
-/// result coordinates (e.g., compressed to dense).
+/// result coordinates (e.g., compressed to dense), or is an insert mode that
+/// does not store every coordinate (e.g., hashed).
 static 
 bool hasSparseInserts(const std::vector<Iterator>& resultIterators,
                       const std::multimap<IndexVar, Iterator>& inputIterators) {
   for (const auto& resultIterator : resultIterators) {
     if (resultIterator.hasInsert()) {
+      if (!resultIterator.isFull()) {
+        return true;
+      }
       const auto indexVar = resultIterator.getIndexVar();
       const auto accessedInputs = inputIterators.equal_range(indexVar);
       for (auto inputIterator = accessedInputs.first; 
@@ -1633,6 +1717,18 @@ Stmt LowererImpl::initResultArrays(vector<Access> writes,
     const auto iterators = getIterators(write);
     taco_iassert(!iterators.empty());
 
+    // Insert levels that do not store every coordinate are initialized when
+    // the result is allocated, which levels below append levels cannot be
+    bool isBelowAppend = false;
+    for (const auto& iterator : iterators) {
+      taco_uassert(!isBelowAppend || !iterator.hasInsert() ||
+                   iterator.isFull())
+          << "The " << iterator.getMode().getModeFormat().getName()
+          << " levels of result " << write.getTensorVar().getName()
+          << " must not be below compressed or singleton levels";
+      isBelowAppend = isBelowAppend || iterator.hasAppend();
+    }
+
     Expr tensor = getTensorVar(write.getTensorVar());
     Expr valuesArr = GetProperty::make(tensor, TensorProperty::Values);
 
@@ -1736,7 +1832,10 @@ ir::Stmt LowererImpl::finalizeResultArrays(std::vector<Access> writes) {
       // Post-process data structures for storing levels
       if (iterator.hasAppend()) {
         size = iterator.getPosVar();
-        finalize = iterator.getAppendFinalizeLevel(parentSize, size);
+        // The symbolic phase already finalized levels that it sized
+        if (!exactResultSizes) {
+          finalize = iterator.getAppendFinalizeLevel(parentSize, size);
+        }
       } else if (iterator.hasInsert()) {
         size = simplify(ir::Mul::make(parentSize, iterator.getWidth()));
         finalize = iterator.getInsertFinalizeLevel(parentSize, size);
@@ -1757,6 +1856,87 @@ ir::Stmt LowererImpl::finalizeResultArrays(std::vector<Access> writes) {
   return result.empty() ? Stmt() : Block::blanks(result);
 }
 
+bool LowererImpl::canAssembleSymbolically(vector<Access> writes) const {
+  if (should_use_CUDA_codegen()) {
+    return false;
+  }
+
+  // The symbolic phase counts the components of the last mode, so the modes
+  // above it must be sized by their parents
+  bool hasAppend = false;
+  for (auto& write : writes) {
+    for (const auto& iterator : getIterators(write)) {
+      if (iterator.hasAppend()) {
+        if (!iterator.isLeaf() || iterator.isBranchless()) {
+          return false;
+        }
+        hasAppend = true;
+      } else if (!iterator.hasInsert()) {
+        return false;
+      }
+    }
+  }
+  return hasAppend;
+}
+
+Stmt LowererImpl::lowerSymbolicAssembly(IndexStmt stmt, vector<Access> writes) {
+  vector<pair<Iterator,Expr>> appenders;
+  for (auto& write : writes) {
+    Expr parentSize = 1;
+    for (const auto& iterator : getIterators(write)) {
+      if (iterator.hasAppend()) {
+        appenders.push_back({iterator, parentSize});
+        symbolicPosVars.insert(iterator.getPosVar());
+      } else {
+        parentSize = simplify(ir::Mul::make(parentSize, iterator.getWidth()));
+      }
+    }
+  }
+
+  // Lower the statement to count result components without storing their 
+  // coordinates or computing their values
+  bool compute = this->compute;
+  this->compute = false;
+  symbolicPhase = true;
+  Stmt count = lower(stmt);
+  symbolicPhase = false;
+  this->compute = compute;
+
+  // Turn the counts into positions, resize the result arrays to the counts 
+  // and rewind the position variables for the numeric phase
+  vector<Stmt> resize;
+  for (auto& appender : appenders) {
+    Iterator iterator = appender.first;
+    Expr parentSize = appender.second;
+    Expr size = iterator.getPosVar();
+    if (parallelAssembly) {
+      // Parallel iterations counted in private position variables
+      resize.push_back(iterator.getParallelAppendFinalizeLevel(parentSize, 
+                                                               size));
+      resize.push_back(Assign::make(size, iterator.getSize(parentSize)));
+    } else {
+      resize.push_back(iterator.getAppendFinalizeLevel(parentSize, size));
+    }
+    resize.push_back(iterator.getAppendResizeLevel(parentSize, size));
+    if (generateComputeCode()) {
+      Expr tensor = iterator.getTensor();
+      Expr values = GetProperty::make(tensor, TensorProperty::Values);
+      Expr capacity = getCapacityVar(tensor);
+      Expr newCapacity = ir::Max::make(size, 1);
+      resize.push_back(Allocate::make(values, newCapacity, true, capacity));
+      resize.push_back(Assign::make(capacity, newCapacity));
+    }
+    if (!parallelAssembly) {
+      resize.push_back(Assign::make(size, 0));
+    }
+  }
+  exactResultSizes = true;
+
+  // The numeric phase lowers the statement again, so the symbolic phase is 
+  // scoped to keep their declarations apart
+  return Block::make(Scope::make(count), Block::make(resize));
+}
+
 Stmt LowererImpl::defineScalarVariable(TensorVar var, bool zero) {
   Datatype type = var.getType().getDataType();
   Expr varValueIR = Var::make(var.getName() + "_val", type, false, false);
@@ -1782,6 +1962,27 @@ vector<Iterator> getIteratorsFrom(IndexVar var,
 }
 
 
+Stmt LowererImpl::declSegmentPosVars(IndexVar var, vector<Access> writes) {
+  vector<Stmt> result;
+  for (auto& write : writes) {
+    vector<Iterator> iterators = getIteratorsFrom(var, getIterators(write));
+    if (iterators.empty() || !iterators.front().hasAppend()) {
+      continue;
+    }
+
+    // The symbolic phase counts the components of each segment from zero, 
+    // while the numeric phase fills the segment that the counts located
+    Iterator appender = iterators.front();
+    taco_iassert(!appender.getParent().isRoot())
+        << "Parallel assembly requires append modes below insert modes";
+    Expr segmentBegin = symbolicPhase ? Expr(0)
+        : appender.posBounds(appender.getParent().getPosVar())[0];
+    result.push_back(VarDecl::make(appender.getPosVar(), segmentBegin));
+  }
+  return result.empty() ? Stmt() : Block::make(result);
+}
+
+
 Stmt LowererImpl::initResultArrays(IndexVar var, vector<Access> writes, 
                                    vector<Access> reads,
                                    set<Access> reducedAccesses) {
@@ -1892,7 +2093,7 @@ Stmt LowererImpl::resizeAndInitValues(const std::vector<Iterator>& appenders,
     Expr capacity = getCapacityVar(appender.getTensor());
     Expr pos = appender.getIteratorVar();
 
-    if (generateAssembleCode()) {
+    if (generateAssembleCode() && !exactResultSizes) {
       result.push_back(doubleSizeIfFull(values, capacity, pos));
     }
 
@@ -1909,7 +2110,7 @@ Stmt LowererImpl::resizeAndInitValues(const std::vector<Iterator>& appenders,
 Stmt LowererImpl::zeroInitValues(Expr tensor, Expr begin, Expr size) {
   Expr lower = simplify(ir::Mul::make(begin, size));
   Expr upper = simplify(ir::Mul::make(ir::Add::make(begin, 1), size));
-  Expr p = Var::make("p" + util::toString(tensor), Int());
+  Expr p = Var::make("p" + util::toString(tensor), upper.type());
   Expr values = GetProperty::make(tensor, TensorProperty::Values);
   Stmt zeroInit = Store::make(values, p, ir::Literal::zero(tensor.type()));
   LoopKind parallel = (isa<ir::Literal>(size) && 
@@ -1939,15 +2140,18 @@ Stmt LowererImpl::declLocatePosVars(vector<Iterator> locators) {
 
     if (doLocate) {
       Iterator locateIterator = locator;
-      if (locateIterator.hasPosIter()) {
-        taco_iassert(!provGraph.isUnderived(locateIterator.getIndexVar()));
+      if (locateIterator.hasPosIter() &&
+          !provGraph.isUnderived(locateIterator.getIndexVar())) {
         continue; // these will be recovered with separate procedure
       }
       do {
+        // Coordinates that are not stored (e.g. in a hashed level) are located
+        // at positions whose components are zero, so the located position is
+        // used whether or not the coordinate was found
         ModeFunction locate = locateIterator.locate(coordinates(locateIterator));
-        taco_iassert(isValue(locate.getResults()[1], true));
         Stmt declarePosVar = VarDecl::make(locateIterator.getPosVar(),
                                            locate.getResults()[0]);
+        result.push_back(locate.compute());
         result.push_back(declarePosVar);
 
         if (locateIterator.isLeaf()) {
@@ -2041,6 +2245,7 @@ Stmt LowererImpl::codeToInitializeIteratorVar(Iterator iterator, vector<Iterator
         if (binarySearchTarget != underivedBounds[coordinateVar][0]) {
           result.push_back(VarDecl::make(iterator.getBeginVar(), binarySearchTarget));
 
+          checkSearchedArray(iterator.getMode().getModePack().getArray(1));
           vector<Expr> binarySearchArgs = {
                   iterator.getMode().getModePack().getArray(1), // array
                   bounds[0], // arrayStart
@@ -2259,7 +2464,7 @@ Stmt LowererImpl::appendCoordinate(vector<Iterator> appenders, Expr coord) {
 
     vector<Stmt> appendStmts;
 
-    if (generateAssembleCode()) {
+    if (generateAssembleCode() && !symbolicPhase) {
       appendStmts.push_back(appender.getAppendCoord(pos, coord));
       while (!appender.isRoot() && appender.isBranchless()) {
         // Need to append result coordinate to parent level as well if child 
@@ -2295,9 +2500,27 @@ Stmt LowererImpl::appendCoordinate(vector<Iterator> appenders, Expr coord) {
 }
 
 
+Stmt LowererImpl::insertCoordinates(vector<Iterator> inserters) {
+  if (!generateAssembleCode() || symbolicPhase) {
+    return Stmt();
+  }
+
+  vector<Stmt> result;
+  for (auto& inserter : inserters) {
+    Stmt insertCoord = inserter.getInsertCoord(inserter.getPosVar(),
+                                               coordinates(inserter));
+    if (insertCoord.defined()) {
+      result.push_back(insertCoord);
+    }
+  }
+  return result.empty() ? Stmt() : Block::make(result);
+}
+
+
 Stmt LowererImpl::generateAppendPositions(vector<Iterator> appenders) {
   vector<Stmt> result;
-  if (generateAssembleCode()) {
+  // Positions are stored by the symbolic phase if there is one
+  if (generateAssembleCode() && !exactResultSizes) {
     for (Iterator appender : appenders) {
       if (!appender.isBranchless()) {
         Expr pos = [](Iterator appender) {
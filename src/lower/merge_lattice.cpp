@@ -358,7 +358,7 @@ private:
    * The union of two lattices is an intersection followed by the lattice
    * points of the first lattice followed by the merge points of the second.
    */
-  static MergeLattice unionLattices(MergeLattice left, MergeLattice right)
+  MergeLattice unionLattices(MergeLattice left, MergeLattice right)
   {
     vector<MergePoint> points;
 
@@ -479,17 +479,19 @@ private:
     return (leftNumLocates > rightNumLocates);
   }
 
-  static vector<MergePoint>
+  vector<MergePoint>
   insertDimensionIteratorIfNotOrdered(vector<MergePoint> points)
   {
     vector<MergePoint> results;
     for (auto& point : points) {
-      vector<Iterator> iterators = point.iterators();
-      if (any(iterators, [](Iterator it){ return !it.isOrdered(); }) &&
-          !any(iterators, [](Iterator it){ return it.isDimensionIterator(); })) {
+      vector<Iterator> pointIterators = point.iterators();
+      if (any(pointIterators, [](Iterator it){ return !it.isOrdered(); }) &&
+          !any(pointIterators,
+               [](Iterator it){ return it.isDimensionIterator(); })) {
         taco_iassert(point.iterators().size() > 0);
-        Iterator dimension(iterators[0].getIndexVar());
-        results.push_back(MergePoint(combine(iterators, {dimension}),
+        Iterator dimension =
+            iterators.modeIterator(pointIterators[0].getIndexVar());
+        results.push_back(MergePoint(combine(pointIterators, {dimension}),
                                      point.locators(),
                                      point.results()));
       }
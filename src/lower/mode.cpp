@@ -21,6 +21,7 @@ struct Mode::Content {
   size_t     packLoc;           /// position within pack containing mode
 
   ModeFormat parentModeFormat;  /// type of previous mode in the tensor
+  Datatype   positionType;      /// type of the positions of the mode
 
   std::map<std::string, ir::Expr> vars;
 };
@@ -29,7 +30,8 @@ Mode::Mode() : content(nullptr) {
 }
 
 Mode::Mode(ir::Expr tensor, Dimension size, int mode, ModeFormat modeFormat,
-     ModePack modePack, size_t packLoc, ModeFormat parentModeFormat)
+     ModePack modePack, size_t packLoc, ModeFormat parentModeFormat,
+     Datatype positionType)
     : content(new Content) {
   taco_iassert(modeFormat.defined());
   content->tensor = tensor;
@@ -39,6 +41,7 @@ Mode::Mode(ir::Expr tensor, Dimension size, int mode, ModeFormat modeFormat,
   content->modePack = modePack;
   content->packLoc = packLoc;
   content->parentModeFormat = parentModeFormat;
+  content->positionType = positionType;
 }
 
 std::string Mode::getName() const {
@@ -73,6 +76,10 @@ ModeFormat Mode::getParentModeType() const {
   return content->parentModeFormat;
 }
 
+Datatype Mode::getPositionType() const {
+  return content->positionType;
+}
+
 ir::Expr Mode::getVar(std::string varName) const {
   taco_iassert(hasVar(varName));
   return content->vars.at(varName);
@@ -106,9 +113,21 @@ ModePack::ModePack() : content(new Content) {
 }
 
 ModePack::ModePack(size_t numModes, ModeFormat modeType, ir::Expr tensor,
-                   int mode, int level) : ModePack() {
+                   int mode, int level, vector<Datatype> arrayTypes)
+    : ModePack() {
   content->numModes = numModes;
   content->arrays = modeType.impl->getArrays(tensor, mode, level);
+
+  // Give the index arrays the element types of the tensor format
+  for (size_t i = 0; i < content->arrays.size() && i < arrayTypes.size(); ++i) {
+    const ir::GetProperty* array = content->arrays[i].as<ir::GetProperty>();
+    if (array != nullptr && array->property == ir::TensorProperty::Indices) {
+      content->arrays[i] = ir::GetProperty::make(array->tensor,
+                                                 array->property, array->mode,
+                                                 array->index, array->name,
+                                                 arrayTypes[i]);
+    }
+  }
 }
 
 size_t ModePack::getNumModes() const {
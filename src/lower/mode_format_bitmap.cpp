@@ -0,0 +1,80 @@
+#include "taco/lower/mode_format_bitmap.h"
+
+#include "taco/util/strings.h"
+
+using namespace std;
+using namespace taco::ir;
+
+namespace taco {
+
+BitmapModeFormat::BitmapModeFormat() :
+    ModeFormatImpl("bitmap", false, true, true, false, false, false, true,
+                   true, true, false) {
+}
+
+ModeFormat BitmapModeFormat::copy(
+    vector<ModeFormat::Property> properties) const {
+  // The dense positions of the level fix its properties
+  return ModeFormat(std::make_shared<BitmapModeFormat>());
+}
+
+ModeFunction BitmapModeFormat::posIterBounds(Expr parentPos,
+                                             Mode mode) const {
+  Expr width = getWidth(mode);
+  Expr pbegin = Mul::make(parentPos, width);
+  Expr pend = Mul::make(Add::make(parentPos, 1), width);
+  return ModeFunction(Stmt(), {pbegin, pend});
+}
+
+ModeFunction BitmapModeFormat::posIterAccess(Expr pos, vector<Expr> coords,
+                                             Mode mode) const {
+  Expr idx = Rem::make(pos, getWidth(mode));
+  Expr bit = Load::make(getBitmapArray(mode.getModePack()), pos);
+  return ModeFunction(Stmt(), {idx, Neq::make(bit, 0)});
+}
+
+ModeFunction BitmapModeFormat::locate(Expr parentPos, vector<Expr> coords,
+                                      Mode mode) const {
+  Expr pos = Add::make(Mul::make(parentPos, getWidth(mode)), coords.back());
+  Expr bit = Load::make(getBitmapArray(mode.getModePack()), pos);
+  return ModeFunction(Stmt(), {pos, Neq::make(bit, 0)});
+}
+
+Stmt BitmapModeFormat::getInsertCoord(Expr p, const vector<Expr>& i,
+                                      Mode mode) const {
+  Expr bitmapArray = getBitmapArray(mode.getModePack());
+  return Store::make(bitmapArray, p, Cast::make(1, bitmapArray.type()));
+}
+
+Expr BitmapModeFormat::getWidth(Mode mode) const {
+  return (mode.getSize().isFixed() && mode.getSize().getSize() < 16) ?
+         (int)mode.getSize().getSize() :
+         getSizeArray(mode.getModePack());
+}
+
+Stmt BitmapModeFormat::getInsertInitLevel(Expr szPrev, Expr sz,
+                                          Mode mode) const {
+  Expr bitmapArray = getBitmapArray(mode.getModePack());
+  Expr pVar = Var::make("p" + mode.getName(), Int());
+  Expr zero = Literal::zero(bitmapArray.type());
+  Stmt initBits = For::make(pVar, 0, sz, 1, Store::make(bitmapArray, pVar, zero));
+  return Block::make(Allocate::make(bitmapArray, sz), initBits);
+}
+
+vector<Expr> BitmapModeFormat::getArrays(Expr tensor, int mode,
+                                         int level) const {
+  std::string arraysName = util::toString(tensor) + std::to_string(level);
+  return {GetProperty::make(tensor, TensorProperty::Dimension, mode),
+          GetProperty::make(tensor, TensorProperty::Indices,
+                            level - 1, 1, arraysName + "_bitmap")};
+}
+
+Expr BitmapModeFormat::getSizeArray(ModePack pack) const {
+  return pack.getArray(0);
+}
+
+Expr BitmapModeFormat::getBitmapArray(ModePack pack) const {
+  return pack.getArray(1);
+}
+
+}
@@ -123,7 +123,7 @@ Stmt CompressedModeFormat::getAppendInitEdges(Expr pPrevBegin,
     return doubleSizeIfFull(posArray, posCapacity, pPrevEnd);
   }
 
-  Expr pVar = Var::make("p" + mode.getName(), Int());
+  Expr pVar = Var::make("p" + mode.getName(), mode.getPositionType());
   Expr lb = Add::make(pPrevBegin, 1);
   Expr ub = Add::make(pPrevEnd, 1);
   Stmt initPos = For::make(pVar, lb, ub, 1, Store::make(posArray, pVar, 0));
@@ -151,7 +151,7 @@ Stmt CompressedModeFormat::getAppendInitLevel(Expr szPrev, Expr sz,
 
   if (mode.getParentModeType().defined() &&
       !mode.getParentModeType().hasAppend() && !szPrevIsZero) {
-    Expr pVar = Var::make("p" + mode.getName(), Int());
+    Expr pVar = Var::make("p" + mode.getName(), mode.getPositionType());
     Stmt storePos = Store::make(posArray, pVar, 0);
     initStmts.push_back(For::make(pVar, 1, initCapacity, 1, storePos));
   }
@@ -174,10 +174,10 @@ Stmt CompressedModeFormat::getAppendFinalizeLevel(Expr szPrev,
     return Stmt();
   }
 
-  Expr csVar = Var::make("cs" + mode.getName(), Int());
+  Expr csVar = Var::make("cs" + mode.getName(), mode.getPositionType());
   Stmt initCs = VarDecl::make(csVar, 0);
   
-  Expr pVar = Var::make("p" + mode.getName(), Int());
+  Expr pVar = Var::make("p" + mode.getName(), mode.getPositionType());
   Expr loadPos = Load::make(getPosArray(mode.getModePack()), pVar);
   Stmt incCs = Assign::make(csVar, Add::make(csVar, loadPos));
   Stmt updatePos = Store::make(getPosArray(mode.getModePack()), pVar, csVar);
@@ -187,6 +187,32 @@ Stmt CompressedModeFormat::getAppendFinalizeLevel(Expr szPrev,
   return Block::make({initCs, finalizeLoop});
 }
 
+Stmt CompressedModeFormat::getParallelAppendFinalizeLevel(Expr szPrev, 
+    Expr sz, Mode mode) const {
+  ModeFormat parentModeType = mode.getParentModeType();
+  if ((isa<Literal>(szPrev) && to<Literal>(szPrev)->equalsScalar(1)) || 
+      !parentModeType.defined() || parentModeType.hasAppend()) {
+    return Stmt();
+  }
+
+  return parallelPrefixSum(getPosArray(mode.getModePack()), 1, 
+                           Add::make(szPrev, 1));
+}
+
+Stmt CompressedModeFormat::getAppendResizeLevel(Expr szPrev, 
+    Expr sz, Mode mode) const {
+  if (mode.getPackLocation() != (mode.getModePack().getNumModes() - 1)) {
+    return Stmt();
+  }
+
+  // Keep at least one element, since realloc to zero bytes may free the array
+  Expr crdCapacity = getCoordCapacity(mode);
+  Expr crdArray = getCoordArray(mode.getModePack());
+  Expr newCapacity = Max::make(sz, 1);
+  return Block::make({Allocate::make(crdArray, newCapacity, true, crdCapacity),
+                      Assign::make(crdCapacity, newCapacity)});
+}
+
 vector<Expr> CompressedModeFormat::getArrays(Expr tensor, int mode, 
                                              int level) const {
   std::string arraysName = util::toString(tensor) + std::to_string(level);
@@ -208,7 +234,7 @@ Expr CompressedModeFormat::getPosCapacity(Mode mode) const {
   const std::string varName = mode.getName() + "_pos_size";
  
   if (!mode.hasVar(varName)) {
-    Expr posCapacity = Var::make(varName, Int());
+    Expr posCapacity = Var::make(varName, mode.getPositionType());
     mode.addVar(varName, posCapacity);
     return posCapacity;
   }
@@ -220,7 +246,7 @@ Expr CompressedModeFormat::getCoordCapacity(Mode mode) const {
   const std::string varName = mode.getName() + "_crd_size";
   
   if (!mode.hasVar(varName)) {
-    Expr idxCapacity = Var::make(varName, Int());
+    Expr idxCapacity = Var::make(varName, mode.getPositionType());
     mode.addVar(varName, idxCapacity);
     return idxCapacity;
   }
@@ -0,0 +1,106 @@
+#include "taco/lower/mode_format_hashed.h"
+
+#include "taco/util/strings.h"
+
+using namespace std;
+using namespace taco::ir;
+
+namespace taco {
+
+HashedModeFormat::HashedModeFormat() :
+    ModeFormatImpl("hashed", false, false, true, false, false, false, true,
+                   true, true, false) {
+}
+
+ModeFormat HashedModeFormat::copy(
+    vector<ModeFormat::Property> properties) const {
+  // The hash table layout fixes the properties of the level
+  return ModeFormat(std::make_shared<HashedModeFormat>());
+}
+
+ModeFunction HashedModeFormat::posIterBounds(Expr parentPos,
+                                             Mode mode) const {
+  Expr width = getWidth(mode);
+  Expr pbegin = Mul::make(parentPos, width);
+  Expr pend = Mul::make(Add::make(parentPos, 1), width);
+  return ModeFunction(Stmt(), {pbegin, pend});
+}
+
+ModeFunction HashedModeFormat::posIterAccess(Expr pos, vector<Expr> coords,
+                                             Mode mode) const {
+  Expr idx = Load::make(getCoordArray(mode.getModePack()), pos);
+  return ModeFunction(Stmt(), {idx, Gte::make(idx, 0)});
+}
+
+ModeFunction HashedModeFormat::locate(Expr parentPos, vector<Expr> coords,
+                                      Mode mode) const {
+  // Probe from the hashed slot of the coordinate until reaching the slot
+  // that stores it or an empty slot. A full segment stops the probe after
+  // every slot is visited, which the runtime detects and grows the level.
+  Expr crdArray = getCoordArray(mode.getModePack());
+  Expr width = getWidth(mode);
+  Expr mask = Sub::make(width, 1);
+  Expr coord = coords.back();
+
+  Expr slot = Var::make(mode.getName() + "_slot", Int());
+  Expr probes = Var::make(mode.getName() + "_probes", Int());
+  Expr pos = Add::make(Mul::make(parentPos, width), slot);
+  Expr idx = Load::make(crdArray, pos);
+  Stmt initSlot = VarDecl::make(slot, getHashedSlot(coord, width));
+  Stmt initProbes = VarDecl::make(probes, 1);
+  Expr isProbing = And::make(And::make(Neq::make(idx, coord), Gte::make(idx, 0)),
+                             Lt::make(probes, width));
+  Stmt probe = While::make(isProbing, Block::make(
+      Assign::make(slot, BitAnd::make(Add::make(slot, 1), mask)),
+      Assign::make(probes, Add::make(probes, 1))));
+  return ModeFunction(Block::make(initSlot, initProbes, probe),
+                      {pos, Eq::make(idx, coord)});
+}
+
+Expr HashedModeFormat::getHashedSlot(Expr coord, Expr width) const {
+  // Fibonacci hashing: the low 32 bits of the coordinate times 2^32/phi are
+  // scaled to [0, W), which keeps the high bits of the product. Unlike the
+  // low bits of the coordinate, these spread strided coordinates out.
+  Expr hash = BitAnd::make(Mul::make(Cast::make(coord, UInt64),
+                                     Literal::make((uint64_t)2654435769u)),
+                           Literal::make((uint64_t)0xffffffffu));
+  Expr scaled = Div::make(Mul::make(hash, Cast::make(width, UInt64)),
+                          Literal::make((uint64_t)1 << 32));
+  return Cast::make(scaled, Int());
+}
+
+Stmt HashedModeFormat::getInsertCoord(Expr p, const vector<Expr>& i,
+                                      Mode mode) const {
+  return Store::make(getCoordArray(mode.getModePack()), p, i.back());
+}
+
+Expr HashedModeFormat::getWidth(Mode mode) const {
+  return Load::make(getWidthArray(mode.getModePack()), 0);
+}
+
+Stmt HashedModeFormat::getInsertInitLevel(Expr szPrev, Expr sz,
+                                          Mode mode) const {
+  Expr crdArray = getCoordArray(mode.getModePack());
+  Expr pVar = Var::make("p" + mode.getName(), Int());
+  Stmt initCoords = For::make(pVar, 0, sz, 1, Store::make(crdArray, pVar, -1));
+  return Block::make(Allocate::make(crdArray, sz), initCoords);
+}
+
+vector<Expr> HashedModeFormat::getArrays(Expr tensor, int mode,
+                                         int level) const {
+  std::string arraysName = util::toString(tensor) + std::to_string(level);
+  return {GetProperty::make(tensor, TensorProperty::Indices,
+                            level - 1, 0, arraysName + "_width"),
+          GetProperty::make(tensor, TensorProperty::Indices,
+                            level - 1, 1, arraysName + "_crd")};
+}
+
+Expr HashedModeFormat::getWidthArray(ModePack pack) const {
+  return pack.getArray(0);
+}
+
+Expr HashedModeFormat::getCoordArray(ModePack pack) const {
+  return pack.getArray(1);
+}
+
+}
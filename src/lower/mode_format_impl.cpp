@@ -154,6 +154,16 @@ Stmt ModeFormatImpl::getAppendFinalizeLevel(Expr szPrev,
   return Stmt();
 }
 
+Stmt ModeFormatImpl::getAppendResizeLevel(Expr szPrev,
+    Expr sz, Mode mode) const {
+  return Stmt();
+}
+
+Stmt ModeFormatImpl::getParallelAppendFinalizeLevel(Expr szPrev,
+    Expr sz, Mode mode) const {
+  return getAppendFinalizeLevel(szPrev, sz, mode);
+}
+
 bool ModeFormatImpl::equals(const ModeFormatImpl& other) const {
   return (isFull == other.isFull &&
           isOrdered == other.isOrdered &&
@@ -18,6 +18,8 @@ struct Array::Content : util::Uncopyable {
   void*  data;
   size_t size;
   Policy policy = Array::UserOwns;
+  std::shared_ptr<void> owner;
+  taco_allocator_t* allocator = nullptr;
 
   ~Content() {
     switch (policy) {
@@ -84,6 +86,9 @@ struct Array::Content : util::Uncopyable {
             break;
         }
         break;
+      case Allocator:
+        allocator->deallocate(allocator->state, data);
+        break;
     }
   }
 };
@@ -98,6 +103,25 @@ Array::Array(Datatype type, void* data, size_t size, Policy policy) : Array() {
   content->policy = policy;
 }
 
+Array::Array(Datatype type, void* data, size_t size,
+             std::shared_ptr<void> owner) : Array() {
+  content->type = type;
+  content->data = data;
+  content->size = size;
+  content->policy = UserOwns;
+  content->owner = owner;
+}
+
+Array::Array(Datatype type, void* data, size_t size,
+             taco_allocator_t* allocator) : Array() {
+  taco_iassert(allocator != nullptr);
+  content->type = type;
+  content->data = data;
+  content->size = size;
+  content->policy = Allocator;
+  content->allocator = allocator;
+}
+
 const Datatype& Array::getType() const {
   return content->type;
 }
@@ -205,6 +229,9 @@ std::ostream& operator<<(std::ostream& os, Array::Policy policy) {
     case Array::Delete:
       os << "delete";
       break;
+    case Array::Allocator:
+      os << "allocator";
+      break;
   }
   return os;
 }
@@ -0,0 +1,206 @@
+#include "storage/convert.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+#include "taco/format.h"
+#include "taco/error.h"
+#include "taco/storage/index.h"
+#include "taco/storage/array.h"
+
+using namespace std;
+
+namespace taco {
+
+namespace {
+
+/// Matrices with fewer components than this are transposed on one thread.
+const size_t minComponentsPerChunk = 1 << 16;
+
+enum LevelKind {DenseLevel, CompressedLevel, SingletonLevel};
+
+/// Reads an element of an index array.
+typedef size_t (*IndexReader)(const void* array, size_t i);
+
+template <typename T>
+size_t readIndex(const void* array, size_t i) {
+  return (size_t)((const T*)array)[i];
+}
+
+IndexReader getIndexReader(const Array& array) {
+  switch (array.getType().getKind()) {
+    case Datatype::UInt8:  return readIndex<uint8_t>;
+    case Datatype::UInt16: return readIndex<uint16_t>;
+    case Datatype::UInt32: return readIndex<uint32_t>;
+    case Datatype::UInt64: return readIndex<uint64_t>;
+    case Datatype::Int8:   return readIndex<int8_t>;
+    case Datatype::Int16:  return readIndex<int16_t>;
+    case Datatype::Int32:  return readIndex<int32_t>;
+    case Datatype::Int64:  return readIndex<int64_t>;
+    default:
+      taco_ierror << "Index arrays of type " << array.getType() <<
+                     " are not supported";
+      return nullptr;
+  }
+}
+
+struct Level {
+  LevelKind   kind;
+  int         mode;
+  int         dimension;
+  const void* pos;
+  const void* crd;
+  IndexReader readPos;
+  IndexReader readCrd;
+};
+
+/// Walks the levels of an index depth-first, which visits the components in
+/// storage order.
+struct ComponentWalker {
+  vector<Level> levels;
+  vector<int> outputModes;
+  vector<int> coordinate;
+  vector<int>* coordinates;
+  vector<size_t>* positions;
+
+  void walk(size_t level, size_t parentPosition) {
+    if (level == levels.size()) {
+      for (int mode : outputModes) {
+        coordinates->push_back(coordinate[mode]);
+      }
+      positions->push_back(parentPosition);
+      return;
+    }
+
+    const Level& l = levels[level];
+    switch (l.kind) {
+      case DenseLevel:
+        for (int i = 0; i < l.dimension; ++i) {
+          coordinate[l.mode] = i;
+          walk(level + 1, parentPosition * l.dimension + i);
+        }
+        break;
+      case CompressedLevel: {
+        const size_t end = l.readPos(l.pos, parentPosition + 1);
+        for (size_t p = l.readPos(l.pos, parentPosition); p < end; ++p) {
+          coordinate[l.mode] = (int)l.readCrd(l.crd, p);
+          walk(level + 1, p);
+        }
+        break;
+      }
+      case SingletonLevel:
+        coordinate[l.mode] = (int)l.readCrd(l.crd, parentPosition);
+        walk(level + 1, parentPosition);
+        break;
+    }
+  }
+};
+
+}
+
+void extractComponents(const Index& index, const vector<int>& dimensions,
+                       const vector<int>& outputModes,
+                       vector<int>& coordinates, vector<size_t>& positions) {
+  const Format& format = index.getFormat();
+  const int order = format.getOrder();
+
+  ComponentWalker walker;
+  for (int i = 0; i < order; ++i) {
+    const ModeFormat modeFormat = format.getModeFormats()[i];
+    const ModeIndex& modeIndex = index.getModeIndex(i);
+    Level level;
+    level.mode = format.getModeOrdering()[i];
+    level.dimension = dimensions[level.mode];
+    level.pos = nullptr;
+    level.crd = nullptr;
+    level.readPos = nullptr;
+    level.readCrd = nullptr;
+    if (modeFormat.getName() == Dense.getName()) {
+      level.kind = DenseLevel;
+    } else if (modeFormat.getName() == Sparse.getName()) {
+      level.kind = CompressedLevel;
+      level.pos = modeIndex.getIndexArray(0).getData();
+      level.crd = modeIndex.getIndexArray(1).getData();
+      level.readPos = getIndexReader(modeIndex.getIndexArray(0));
+      level.readCrd = getIndexReader(modeIndex.getIndexArray(1));
+    } else if (modeFormat.getName() == Singleton.getName()) {
+      level.kind = SingletonLevel;
+      level.crd = modeIndex.getIndexArray(1).getData();
+      level.readCrd = getIndexReader(modeIndex.getIndexArray(1));
+    } else {
+      taco_not_supported_yet;
+    }
+    walker.levels.push_back(level);
+  }
+  walker.outputModes = outputModes;
+  walker.coordinate.resize(order);
+  walker.coordinates = &coordinates;
+  walker.positions = &positions;
+
+  const size_t size = index.getSize();
+  coordinates.reserve(coordinates.size() + size * outputModes.size());
+  positions.reserve(positions.size() + size);
+  walker.walk(0, 0);
+}
+
+void transposeCompressed(int numRows, int numColumns, const int* pos,
+                         const int* crd, const char* values,
+                         size_t componentSize, int* newPos, int* newCrd,
+                         char* newValues, int numThreads) {
+  const size_t size = pos[numRows];
+  const int numChunks = (int)max(min((size_t)max(numThreads, 1),
+                                     size / minComponentsPerChunk),
+                                 (size_t)1);
+
+  // Give each chunk about the same number of components
+  vector<int> chunkRows(numChunks + 1, numRows);
+  chunkRows[0] = 0;
+  for (int chunk = 1; chunk < numChunks; ++chunk) {
+    const int target = (int)(size * chunk / numChunks);
+    chunkRows[chunk] = (int)(upper_bound(pos, pos + numRows + 1, target) - pos)
+                       - 1;
+    chunkRows[chunk] = max(chunkRows[chunk], chunkRows[chunk-1]);
+  }
+
+  vector<int> offsets((size_t)numChunks * numColumns, 0);
+#if USE_OPENMP
+  #pragma omp parallel for schedule(static, 1) num_threads(numThreads)
+#endif
+  for (int chunk = 0; chunk < numChunks; ++chunk) {
+    int* counts = &offsets[(size_t)chunk * numColumns];
+    for (int p = pos[chunkRows[chunk]]; p < pos[chunkRows[chunk+1]]; ++p) {
+      counts[crd[p]]++;
+    }
+  }
+
+  // Rows are scattered in order, so chunk c's components of a column come
+  // after those of chunks before c and every new column stays sorted.
+  int offset = 0;
+  for (int column = 0; column < numColumns; ++column) {
+    newPos[column] = offset;
+    for (int chunk = 0; chunk < numChunks; ++chunk) {
+      const int count = offsets[(size_t)chunk * numColumns + column];
+      offsets[(size_t)chunk * numColumns + column] = offset;
+      offset += count;
+    }
+  }
+  newPos[numColumns] = offset;
+
+#if USE_OPENMP
+  #pragma omp parallel for schedule(static, 1) num_threads(numThreads)
+#endif
+  for (int chunk = 0; chunk < numChunks; ++chunk) {
+    int* next = &offsets[(size_t)chunk * numColumns];
+    for (int row = chunkRows[chunk]; row < chunkRows[chunk+1]; ++row) {
+      for (int p = pos[row]; p < pos[row+1]; ++p) {
+        const int q = next[crd[p]]++;
+        newCrd[q] = row;
+        memcpy(&newValues[q * componentSize], &values[p * componentSize],
+               componentSize);
+      }
+    }
+  }
+}
+
+}
@@ -0,0 +1,33 @@
+#ifndef TACO_STORAGE_CONVERT_H
+#define TACO_STORAGE_CONVERT_H
+
+#include <cstddef>
+#include <vector>
+
+namespace taco {
+class Index;
+
+/// Collect the components stored in a packed index of dense, compressed and
+/// singleton levels, in storage order. For every component, the coordinates of
+/// modes `outputModes[0]`, `outputModes[1]`, ... are appended to `coordinates`
+/// and the position of its value in the values array to `positions`.
+void extractComponents(const Index& index, const std::vector<int>& dimensions,
+                       const std::vector<int>& outputModes,
+                       std::vector<int>& coordinates,
+                       std::vector<size_t>& positions);
+
+/// Transpose a matrix stored as a dense level of size `numRows` followed by a
+/// compressed level of size `numColumns`, such as CSR, into the same kind of
+/// storage with the levels swapped, such as CSC. This is a counting sort over
+/// `crd`: every row chunk histograms its column coordinates, a prefix sum over
+/// the histograms gives every chunk its output positions, and the chunks then
+/// scatter their components, on up to `numThreads` threads when taco is built
+/// with OpenMP. `newPos` must hold `numColumns+1` elements, and `newCrd` and
+/// `newValues` as many components as the input.
+void transposeCompressed(int numRows, int numColumns, const int* pos,
+                         const int* crd, const char* values,
+                         size_t componentSize, int* newPos, int* newCrd,
+                         char* newValues, int numThreads=1);
+
+}
+#endif
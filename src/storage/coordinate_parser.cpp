@@ -0,0 +1,235 @@
+#include "storage/coordinate_parser.h"
+
+#include <algorithm>
+#include <climits>
+#include <cstdint>
+#include <cstdlib>
+#include <string>
+
+#include "taco/error.h"
+
+using namespace std;
+
+namespace taco {
+
+namespace {
+
+/// Chunks are at least this many bytes, so that small files are parsed on one
+/// thread.
+const size_t minChunkSize = 1 << 20;
+
+/// Powers of ten that are exactly representable as doubles.
+const double exactPowersOfTen[] = {
+  1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+  1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+const int maxExactPowerOfTen = 22;
+const uint64_t maxExactMantissa = (uint64_t)1 << 53;
+
+bool isBlank(char c) {
+  return c == ' ' || c == '\t';
+}
+
+bool isDigit(char c) {
+  return c >= '0' && c <= '9';
+}
+
+bool isEndOfLine(char c) {
+  return c == '\n' || c == '\r';
+}
+
+const char* skipBlanks(const char* ptr, const char* end) {
+  while (ptr < end && isBlank(*ptr)) {
+    ptr++;
+  }
+  return ptr;
+}
+
+const char* skipLine(const char* ptr, const char* end) {
+  while (ptr < end && *ptr != '\n') {
+    ptr++;
+  }
+  return (ptr < end) ? ptr + 1 : end;
+}
+
+bool isExponentMarker(char c) {
+  return c == 'e' || c == 'E' || c == 'd' || c == 'D';
+}
+
+/// Parse a number that the fast path cannot convert exactly with strtod.
+bool parseDoubleSlow(const char*& ptr, const char* end, double* value) {
+  const char* tokenEnd = ptr;
+  while (tokenEnd < end && !isBlank(*tokenEnd) && !isEndOfLine(*tokenEnd)) {
+    tokenEnd++;
+  }
+  // The file contents are not null-terminated, so strtod gets a copy, in
+  // which Fortran exponents (e.g. 1.0D+00) are turned into C exponents
+  string token(ptr, tokenEnd);
+  if (token.find_first_of("xX") == string::npos) {
+    replace(token.begin(), token.end(), 'd', 'e');
+    replace(token.begin(), token.end(), 'D', 'e');
+  }
+  char* parsedEnd;
+  const double result = strtod(token.c_str(), &parsedEnd);
+  if (parsedEnd == token.c_str()) {
+    return false;
+  }
+  *value = result;
+  ptr += parsedEnd - token.c_str();
+  return true;
+}
+
+void parseChunk(const char* ptr, const char* end, int order,
+                CoordinateChunk* chunk, bool* overflow) {
+  chunk->dimensions.assign(order, 0);
+  while (ptr < end) {
+    ptr = skipBlanks(ptr, end);
+    if (ptr == end) {
+      break;
+    }
+    if (isEndOfLine(*ptr)) {
+      ptr++;
+      continue;
+    }
+
+    for (int mode = 0; mode < order; ++mode) {
+      long index = 0;
+      parseInt(ptr, end, &index);
+      if (index > INT_MAX) {
+        *overflow = true;
+        index = INT_MAX;
+      }
+      chunk->coordinates.push_back((int)index - 1);
+      chunk->dimensions[mode] = max(chunk->dimensions[mode], (int)index);
+    }
+    double value = 0.0;
+    parseDouble(ptr, end, &value);
+    chunk->values.push_back(value);
+    ptr = skipLine(ptr, end);
+  }
+}
+
+}
+
+bool parseInt(const char*& ptr, const char* end, long* value) {
+  const char* p = skipBlanks(ptr, end);
+  bool negative = false;
+  if (p < end && (*p == '-' || *p == '+')) {
+    negative = (*p == '-');
+    p++;
+  }
+  if (p == end || !isDigit(*p)) {
+    return false;
+  }
+  long result = 0;
+  while (p < end && isDigit(*p)) {
+    if (result <= (LONG_MAX - 9) / 10) {
+      result = result * 10 + (*p - '0');
+    }
+    p++;
+  }
+  *value = negative ? -result : result;
+  ptr = p;
+  return true;
+}
+
+bool parseDouble(const char*& ptr, const char* end, double* value) {
+  const char* p = skipBlanks(ptr, end);
+  const char* start = p;
+  bool negative = false;
+  if (p < end && (*p == '-' || *p == '+')) {
+    negative = (*p == '-');
+    p++;
+  }
+
+  // Accumulate the significant digits into an integer mantissa, and track
+  // whether any digits were dropped
+  uint64_t mantissa = 0;
+  int exponent = 0;
+  bool hasDigits = false;
+  bool exact = true;
+  while (p < end && isDigit(*p)) {
+    if (mantissa < maxExactMantissa) {
+      mantissa = mantissa * 10 + (*p - '0');
+    } else {
+      exponent++;
+      exact = exact && (*p == '0');
+    }
+    hasDigits = true;
+    p++;
+  }
+  if (p < end && *p == '.') {
+    p++;
+    while (p < end && isDigit(*p)) {
+      if (mantissa < maxExactMantissa) {
+        mantissa = mantissa * 10 + (*p - '0');
+        exponent--;
+      } else {
+        exact = exact && (*p == '0');
+      }
+      hasDigits = true;
+      p++;
+    }
+  }
+  if (!hasDigits) {
+    // Also handles inf and nan
+    ptr = start;
+    return parseDoubleSlow(ptr, end, value);
+  }
+  if (p < end && isExponentMarker(*p)) {
+    const char* exponentPtr = p + 1;
+    long fileExponent;
+    if (exponentPtr < end && !isBlank(*exponentPtr) &&
+        parseInt(exponentPtr, end, &fileExponent)) {
+      exponent += (int)max(min(fileExponent, (long)INT_MAX / 2),
+                           (long)INT_MIN / 2);
+      p = exponentPtr;
+    }
+  }
+
+  // A mantissa and a power of ten that are both exact doubles give a
+  // correctly rounded result with a single multiplication or division
+  if (!exact || mantissa > maxExactMantissa ||
+      exponent < -maxExactPowerOfTen || exponent > maxExactPowerOfTen) {
+    ptr = start;
+    return parseDoubleSlow(ptr, end, value);
+  }
+  double result = (double)mantissa;
+  result = (exponent < 0) ? result / exactPowersOfTen[-exponent]
+                          : result * exactPowersOfTen[exponent];
+  *value = negative ? -result : result;
+  ptr = p;
+  return true;
+}
+
+vector<CoordinateChunk> parseCoordinates(const char* begin, const char* end,
+                                         int order, int numThreads) {
+  const size_t size = end - begin;
+  const int numChunks = (int)max(min((size_t)max(numThreads, 1),
+                                     size / minChunkSize), (size_t)1);
+
+  // Move the chunk boundaries to the starts of lines
+  vector<const char*> boundaries(numChunks + 1, end);
+  boundaries[0] = begin;
+  for (int chunk = 1; chunk < numChunks; ++chunk) {
+    const char* boundary = begin + size * chunk / numChunks;
+    boundaries[chunk] = skipLine(max(boundary - 1, boundaries[chunk-1]), end);
+  }
+
+  vector<CoordinateChunk> chunks(numChunks);
+  vector<char> overflows(numChunks, false);
+#if USE_OPENMP
+  #pragma omp parallel for schedule(static, 1) num_threads(numThreads)
+#endif
+  for (int chunk = 0; chunk < numChunks; ++chunk) {
+    bool overflow = false;
+    parseChunk(boundaries[chunk], boundaries[chunk+1], order, &chunks[chunk],
+               &overflow);
+    overflows[chunk] = overflow;
+  }
+  taco_uassert(find(overflows.begin(), overflows.end(), true) ==
+               overflows.end()) << "Coordinate in file is larger than INT_MAX";
+  return chunks;
+}
+
+}
@@ -0,0 +1,43 @@
+#ifndef TACO_STORAGE_COORDINATE_PARSER_H
+#define TACO_STORAGE_COORDINATE_PARSER_H
+
+#include <cstddef>
+#include <vector>
+
+namespace taco {
+
+/// Parse a decimal integer at `ptr`, skipping leading spaces and tabs. On
+/// success `ptr` is moved past the integer. Returns false if there is no
+/// integer before the end of the line.
+bool parseInt(const char*& ptr, const char* end, long* value);
+
+/// Parse a floating-point number at `ptr`, skipping leading spaces and tabs.
+/// Numbers with at most 15 significant digits and small exponents, which
+/// covers most data files, are converted exactly without going through the C
+/// locale; other numbers fall back to strtod. Fortran exponents, such as
+/// 1.0D+00, are accepted too. On success `ptr` is moved past the number and
+/// `value` is set. Returns false, leaving `value` unchanged, if there is no
+/// number before the end of the line.
+bool parseDouble(const char*& ptr, const char* end, double* value);
+
+/// The components parsed from one chunk of a coordinate file.
+struct CoordinateChunk {
+  /// The zero-based coordinates of the components, `order` per component.
+  std::vector<int> coordinates;
+  std::vector<double> values;
+
+  /// The largest one-based coordinate of each mode.
+  std::vector<int> dimensions;
+};
+
+/// Parse the lines in [begin, end) of a coordinate file, where each line holds
+/// `order` one-based integer coordinates followed by a value, and blank lines
+/// are skipped. The text is split into newline-aligned chunks that are parsed
+/// on up to `numThreads` threads when taco is built with OpenMP. The chunks
+/// are returned in file order.
+std::vector<CoordinateChunk> parseCoordinates(const char* begin,
+                                              const char* end, int order,
+                                              int numThreads=1);
+
+}
+#endif
@@ -0,0 +1,222 @@
+#include "storage/coordinate_sort.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+#include "taco/error.h"
+
+using namespace std;
+
+namespace taco {
+
+namespace {
+
+/// The number of bits sorted by each radix sort pass.
+const int radixBits = 11;
+const size_t numBuckets = (size_t)1 << radixBits;
+
+/// Buffers with fewer components than this are sorted on one thread.
+const size_t minComponentsPerChunk = 1 << 16;
+
+/// Run `body` for every chunk in [0, numChunks), in parallel if taco is built
+/// with OpenMP.
+template <typename Body>
+void parallelFor(int numChunks, int numThreads, Body body) {
+#if USE_OPENMP
+  #pragma omp parallel for schedule(static, 1) num_threads(numThreads)
+#endif
+  for (int chunk = 0; chunk < numChunks; ++chunk) {
+    body(chunk);
+  }
+}
+
+size_t chunkBegin(size_t size, int numChunks, int chunk) {
+  return size * chunk / numChunks;
+}
+
+int numBitsUsed(unsigned maxValue) {
+  int bits = 0;
+  while (bits < 32 && (maxValue >> bits) != 0) {
+    bits++;
+  }
+  return bits;
+}
+
+/// Stably sort the indices in `permutation` by the `radixBits` bits of their
+/// keys that start at `shift`, writing the result to `sorted`. Returns false
+/// without writing anything if all the keys have the same digit.
+template <typename Index>
+bool radixSortPass(const unsigned* keys, int shift, const Index* permutation,
+                   Index* sorted, size_t size, int numChunks, int numThreads) {
+  const unsigned mask = numBuckets - 1;
+  vector<size_t> offsets(numChunks * numBuckets, 0);
+  parallelFor(numChunks, numThreads, [&](int chunk) {
+    size_t* counts = &offsets[chunk * numBuckets];
+    const size_t end = chunkBegin(size, numChunks, chunk+1);
+    for (size_t i = chunkBegin(size, numChunks, chunk); i < end; ++i) {
+      counts[(keys[permutation[i]] >> shift) & mask]++;
+    }
+  });
+
+  // Each chunk scatters its components of a bucket after the components of
+  // the previous chunks, which keeps the sort stable.
+  size_t offset = 0;
+  for (size_t bucket = 0; bucket < numBuckets; ++bucket) {
+    size_t bucketSize = 0;
+    for (int chunk = 0; chunk < numChunks; ++chunk) {
+      size_t count = offsets[chunk * numBuckets + bucket];
+      offsets[chunk * numBuckets + bucket] = offset + bucketSize;
+      bucketSize += count;
+    }
+    if (bucketSize == size) {
+      return false;
+    }
+    offset += bucketSize;
+  }
+
+  parallelFor(numChunks, numThreads, [&](int chunk) {
+    size_t* next = &offsets[chunk * numBuckets];
+    const size_t end = chunkBegin(size, numChunks, chunk+1);
+    for (size_t i = chunkBegin(size, numChunks, chunk); i < end; ++i) {
+      const Index index = permutation[i];
+      sorted[next[(keys[index] >> shift) & mask]++] = index;
+    }
+  });
+  return true;
+}
+
+template <typename Index>
+void radixSort(const char* buffer, size_t size, size_t componentSize,
+               size_t valueSize, const vector<unsigned>& maxCoordinates,
+               vector<vector<int>>& coordinates, char* values,
+               int numChunks, int numThreads) {
+  const int order = coordinates.size();
+  vector<Index> permutation(size);
+  vector<Index> sorted(size);
+  parallelFor(numChunks, numThreads, [&](int chunk) {
+    const size_t end = chunkBegin(size, numChunks, chunk+1);
+    for (size_t i = chunkBegin(size, numChunks, chunk); i < end; ++i) {
+      permutation[i] = i;
+    }
+  });
+
+  // Sort by the least significant mode first
+  for (int mode = order - 1; mode >= 0; --mode) {
+    const unsigned* keys = (const unsigned*)coordinates[mode].data();
+    const int bits = numBitsUsed(maxCoordinates[mode]);
+    for (int shift = 0; shift < bits; shift += radixBits) {
+      if (radixSortPass(keys, shift, permutation.data(), sorted.data(), size,
+                        numChunks, numThreads)) {
+        permutation.swap(sorted);
+      }
+    }
+  }
+  sorted.clear();
+  sorted.shrink_to_fit();
+
+  vector<int> gathered(size);
+  for (int mode = 0; mode < order; ++mode) {
+    const int* unsorted = coordinates[mode].data();
+    parallelFor(numChunks, numThreads, [&](int chunk) {
+      const size_t end = chunkBegin(size, numChunks, chunk+1);
+      for (size_t i = chunkBegin(size, numChunks, chunk); i < end; ++i) {
+        gathered[i] = unsorted[permutation[i]];
+      }
+    });
+    coordinates[mode].swap(gathered);
+  }
+
+  const size_t valueOffset = order * sizeof(int);
+  parallelFor(numChunks, numThreads, [&](int chunk) {
+    const size_t end = chunkBegin(size, numChunks, chunk+1);
+    for (size_t i = chunkBegin(size, numChunks, chunk); i < end; ++i) {
+      memcpy(&values[i * valueSize],
+             &buffer[permutation[i] * componentSize + valueOffset], valueSize);
+    }
+  });
+}
+
+}
+
+void sortCoordinates(const char* buffer, size_t numComponents,
+                     size_t componentSize, size_t valueSize,
+                     const vector<int>& permutation,
+                     vector<vector<int>>& coordinates, char* values,
+                     int numThreads, bool sorted) {
+  const int order = permutation.size();
+  taco_iassert(componentSize >= order * sizeof(int) + valueSize);
+
+  numThreads = max(numThreads, 1);
+  const int numChunks = (int)min((size_t)numThreads,
+                                 max(numComponents / minComponentsPerChunk,
+                                     (size_t)1));
+
+  // Permute the coordinates into per-mode arrays, while finding the largest
+  // coordinate of each mode and checking whether the buffer is sorted unless
+  // the caller already knows.
+  coordinates.assign(order, vector<int>(numComponents));
+  vector<unsigned> chunkMaxCoordinates(numChunks * order, 0);
+  vector<char> chunkSorted(numChunks, true);
+  parallelFor(numChunks, numThreads, [&](int chunk) {
+    unsigned* maxCoordinates = &chunkMaxCoordinates[chunk * order];
+    const size_t begin = chunkBegin(numComponents, numChunks, chunk);
+    const size_t end = chunkBegin(numComponents, numChunks, chunk+1);
+    bool chunkIsSorted = true;
+    for (size_t i = begin; i < end; ++i) {
+      const int* coordinate = (const int*)&buffer[i * componentSize];
+      for (int mode = 0; mode < order; ++mode) {
+        const int value = coordinate[permutation[mode]];
+        coordinates[mode][i] = value;
+        maxCoordinates[mode] = max(maxCoordinates[mode], (unsigned)value);
+      }
+      if (!sorted && chunkIsSorted && i > 0) {
+        const int* previous = (const int*)&buffer[(i-1) * componentSize];
+        for (int mode = 0; mode < order; ++mode) {
+          const int a = previous[permutation[mode]];
+          const int b = coordinate[permutation[mode]];
+          if (a != b) {
+            chunkIsSorted = (a < b);
+            break;
+          }
+        }
+      }
+    }
+    chunkSorted[chunk] = chunkIsSorted;
+  });
+
+  if (sorted || all_of(chunkSorted.begin(), chunkSorted.end(),
+                       [](char chunkIsSorted) { return chunkIsSorted; })) {
+    const size_t valueOffset = order * sizeof(int);
+    parallelFor(numChunks, numThreads, [&](int chunk) {
+      const size_t end = chunkBegin(numComponents, numChunks, chunk+1);
+      for (size_t i = chunkBegin(numComponents, numChunks, chunk);
+           i < end; ++i) {
+        memcpy(&values[i * valueSize],
+               &buffer[i * componentSize + valueOffset], valueSize);
+      }
+    });
+    return;
+  }
+
+  vector<unsigned> maxCoordinates(order, 0);
+  for (int chunk = 0; chunk < numChunks; ++chunk) {
+    for (int mode = 0; mode < order; ++mode) {
+      maxCoordinates[mode] = max(maxCoordinates[mode],
+                                 chunkMaxCoordinates[chunk * order + mode]);
+    }
+  }
+
+  // Sort 32-bit component indices when possible, to halve the memory traffic
+  if (numComponents <= UINT32_MAX) {
+    radixSort<uint32_t>(buffer, numComponents, componentSize, valueSize,
+                        maxCoordinates, coordinates, values, numChunks,
+                        numThreads);
+  } else {
+    radixSort<size_t>(buffer, numComponents, componentSize, valueSize,
+                      maxCoordinates, coordinates, values, numChunks,
+                      numThreads);
+  }
+}
+
+}
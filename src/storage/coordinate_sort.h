@@ -0,0 +1,31 @@
+#ifndef TACO_STORAGE_COORDINATE_SORT_H
+#define TACO_STORAGE_COORDINATE_SORT_H
+
+#include <cstddef>
+#include <vector>
+
+namespace taco {
+
+/// Sort a buffer of components by their coordinates and split it into
+/// coordinate and value arrays, as expected by the generated pack code.
+/// Each component in the buffer is `order` int coordinates followed by
+/// `valueSize` bytes of value, and components are `componentSize` bytes
+/// apart. The coordinates are first permuted so that mode `i` of the result
+/// is mode `permutation[i]` of the buffer, and are then sorted
+/// lexicographically. Components with equal coordinates keep their order in
+/// the buffer.
+///
+/// The result coordinates of mode `i` are stored in `coordinates[i]`, and the
+/// values in `values`, which must hold `numComponents * valueSize` bytes. The
+/// sort is an LSD radix sort over the bits that the coordinates actually use,
+/// and is skipped for buffers that are already sorted. Callers that know the
+/// buffer is sorted can pass `sorted` to also skip checking it. It runs on up
+/// to `numThreads` threads when taco is built with OpenMP.
+void sortCoordinates(const char* buffer, size_t numComponents,
+                     size_t componentSize, size_t valueSize,
+                     const std::vector<int>& permutation,
+                     std::vector<std::vector<int>>& coordinates, char* values,
+                     int numThreads=1, bool sorted=false);
+
+}
+#endif
@@ -5,6 +5,8 @@
 #include <sstream>
 #include <cstdlib>
 #include <climits>
+#include <algorithm>
+#include <iterator>
 
 #include "taco/tensor.h"
 #include "taco/format.h"
@@ -12,37 +14,137 @@
 #include "taco/util/strings.h"
 #include "taco/util/timers.h"
 #include "taco/util/files.h"
+#include "storage/coordinate_parser.h"
 
 using namespace std;
 
 namespace taco {
 
+/// Returns the line that starts at `ptr` and moves `ptr` to the next line.
+static string getLine(const char*& ptr, const char* end) {
+  const char* lineEnd = std::find(ptr, end, '\n');
+  string line(ptr, lineEnd);
+  ptr = (lineEnd < end) ? lineEnd + 1 : end;
+  return line;
+}
+
+/// Skips the comments at the top of the file and returns the dimensions on the
+/// first non-comment line.
+static vector<int> readDimensions(const char*& ptr, const char* end) {
+  string line;
+  string token;
+  while (ptr < end) {
+    line = getLine(ptr, end);
+    std::stringstream lineStream(line);
+    if ((lineStream >> token) && token[0] != '%') {
+      break;
+    }
+  }
+
+  vector<int> dimensions;
+  const char* linePtr = line.data();
+  long dimension;
+  while (parseInt(linePtr, line.data() + line.size(), &dimension) &&
+         dimension != 0) {
+    taco_uassert(dimension <= INT_MAX) << "Dimension exceeds INT_MAX";
+    dimensions.push_back(static_cast<int>(dimension));
+  }
+  return dimensions;
+}
+
 template <typename T>
-TensorBase dispatchReadMTX(std::string filename, const T& format, bool pack) {
-  std::fstream file;
-  util::openStream(file, filename, fstream::in);
-  TensorBase tensor = readMTX(file, format, pack);
-  file.close();
+static TensorBase dispatchReadSparse(const char* begin, const char* end,
+                                     const T& format, bool symm) {
+  // The first non-comment line is the header with dimensions
+  const char* ptr = begin;
+  vector<int> dimensions = readDimensions(ptr, end);
+  dimensions.pop_back();
+  if (symm)
+    taco_uassert(dimensions.size()==2) << "Symmetry only available for matrix";
+
+  vector<CoordinateChunk> chunks = parseCoordinates(ptr, end,
+                                                    dimensions.size(),
+                                                    taco_get_num_threads());
+
+  // Create matrix
+  TensorBase tensor(type<double>(), dimensions, format);
+  for (auto& chunk : chunks) {
+    const size_t nnz = chunk.values.size();
+    if (symm) {
+      for (size_t i = 0; i < nnz; i++) {
+        const int row = chunk.coordinates[2*i];
+        const int col = chunk.coordinates[2*i + 1];
+        if (row != col) {
+          chunk.coordinates.push_back(col);
+          chunk.coordinates.push_back(row);
+          chunk.values.push_back(chunk.values[i]);
+        }
+      }
+    }
+    tensor.insertBatch(chunk.coordinates.data(), chunk.values.data(),
+                       chunk.values.size());
+  }
+
   return tensor;
 }
 
-TensorBase readMTX(std::string filename, const ModeFormat& modetype, bool pack) {
-  return dispatchReadMTX(filename, modetype, pack);
-}
+template <typename T>
+static TensorBase dispatchReadDense(const char* begin, const char* end,
+                                    const T& format, bool symm) {
+  // The first non-comment line is the header with dimension sizes
+  const char* ptr = begin;
+  vector<int> dimensions = readDimensions(ptr, end);
+  if (symm)
+    taco_uassert(dimensions.size()==2) << "Symmetry only available for matrix";
 
-TensorBase readMTX(std::string filename, const Format& format, bool pack) {
-  return dispatchReadMTX(filename, format, pack);
+  vector<CoordinateChunk> chunks = parseCoordinates(ptr, end, 0,
+                                                    taco_get_num_threads());
+  vector<double> values;
+  for (auto& chunk : chunks) {
+    values.insert(values.end(), chunk.values.begin(), chunk.values.end());
+  }
+
+  // Values are stored in column-major order
+  const size_t order = dimensions.size();
+  const size_t size = values.size();
+  vector<int> coordinates(order * size);
+  for (size_t n = 0; n < size; n++) {
+    size_t index = n;
+    for (size_t mode = 0; mode < order-1; mode++) {
+      coordinates[n*order + mode] = index % dimensions[mode];
+      index = index / dimensions[mode];
+    }
+    coordinates[n*order + order-1] = index;
+  }
+  if (symm) {
+    for (size_t n = 0; n < size; n++) {
+      const int row = coordinates[2*n];
+      const int col = coordinates[2*n + 1];
+      if (row != col) {
+        coordinates.push_back(col);
+        coordinates.push_back(row);
+        values.push_back(values[n]);
+      }
+    }
+  }
+
+  // Create matrix
+  TensorBase tensor(type<double>(), dimensions, format);
+  tensor.insertBatch(coordinates.data(), values.data(), values.size());
+
+  return tensor;
 }
 
 template <typename T>
-TensorBase dispatchReadMTX(std::istream& stream, const T& format, bool pack) {
-  string line;
-  if (!std::getline(stream, line)) {
+static TensorBase dispatchReadMTX(const char* begin, const char* end,
+                                  const T& format, bool pack) {
+  const char* ptr = begin;
+  if (ptr == end) {
     return TensorBase();
   }
 
   // Read Header
-  std::stringstream lineStream(line);
+  std::stringstream lineStream(getLine(ptr, end));
   string head, type, formats, field, symmetry;
   lineStream >> head >> type >> formats >> field >> symmetry;
   taco_uassert(head=="%%MatrixMarket") << "Unknown header of MatrixMarket";
@@ -60,9 +162,9 @@ TensorBase dispatchReadMTX(std::istream& stream, const T& format, bool pack) {
 
   TensorBase tensor;
   if (formats=="coordinate")
-    tensor = readSparse(stream,format,symm);
+    tensor = dispatchReadSparse(ptr, end, format, symm);
   else if (formats=="array")
-    tensor = readDense(stream,format,symm);
+    tensor = dispatchReadDense(ptr, end, format, symm);
   else
     taco_uerror << "MatrixMarket format not available";
 
@@ -73,161 +175,65 @@ TensorBase dispatchReadMTX(std::istream& stream, const T& format, bool pack) {
   return tensor;
 }
 
-TensorBase readMTX(std::istream& stream, const ModeFormat& modetype, bool pack) {
-  return dispatchReadMTX(stream, modetype, pack);
+template <typename T>
+TensorBase dispatchReadMTX(std::string filename, const T& format, bool pack) {
+  util::MappedFile file(filename);
+  return dispatchReadMTX(file.data(), file.data() + file.size(), format, pack);
 }
 
-TensorBase readMTX(std::istream& stream, const Format& format, bool pack) {
-  return dispatchReadMTX(stream, format, pack);
+TensorBase readMTX(std::string filename, const ModeFormat& modetype, bool pack) {
+  return dispatchReadMTX(filename, modetype, pack);
 }
 
-template <typename T>
-TensorBase dispatchReadSparse(std::istream& stream, const T& format, 
-                              bool symm) {
-  string line;
-  std::getline(stream,line);
-
-  // Skip comments at the top of the file
-  string token;
-  do {
-    std::stringstream lineStream(line);
-    lineStream >> token;
-    if (token[0] != '%') {
-      break;
-    }
-  } while (std::getline(stream, line));
+TensorBase readMTX(std::string filename, const Format& format, bool pack) {
+  return dispatchReadMTX(filename, format, pack);
+}
 
-  // The first non-comment line is the header with dimensions
-  vector<int> dimensions;
-  char* linePtr = (char*)line.data();
-  while (size_t dimension = strtoul(linePtr, &linePtr, 10)) {
-    taco_uassert(dimension <= INT_MAX) << "Dimension exceeds INT_MAX";
-    dimensions.push_back(static_cast<int>(dimension));
-  }
-  size_t nnz = dimensions[dimensions.size()-1];
-  dimensions.pop_back();
-  if (symm)
-    taco_uassert(dimensions.size()==2) << "Symmetry only available for matrix";
+/// Returns the remaining contents of the stream.
+static string readStream(std::istream& stream) {
+  return string((std::istreambuf_iterator<char>(stream)),
+                std::istreambuf_iterator<char>());
+}
 
-  vector<int> coordinates;
-  vector<double> values;
-  coordinates.reserve(nnz*dimensions.size());
-  values.reserve(nnz);
-
-  while (std::getline(stream, line)) {
-    linePtr = (char*)line.data();
-    for (size_t i=0; i < dimensions.size(); i++) {
-      long index = strtol(linePtr, &linePtr, 10);
-      taco_uassert(index <= INT_MAX) << "Index exceeds INT_MAX";
-      coordinates.push_back(static_cast<int>(index));
-    }
-    double val = strtod(linePtr, &linePtr);
-    values.push_back(val);
-  }
+template <typename T>
+TensorBase dispatchReadMTX(std::istream& stream, const T& format, bool pack) {
+  string contents = readStream(stream);
+  return dispatchReadMTX(contents.data(), contents.data() + contents.size(),
+                         format, pack);
+}
 
-  // Create matrix
-  TensorBase tensor(type<double>(), dimensions, format);
-  if (symm)
-    tensor.reserve(2*nnz);
-  else
-    tensor.reserve(nnz);
-
-  // Insert coordinates
-  std::vector<int> coord;
-  for (size_t i = 0; i < nnz; i++) {
-    coord.clear();
-    for (size_t mode = 0; mode < dimensions.size(); mode++) {
-      coord.push_back(coordinates[i*dimensions.size() + mode] -1);
-    }
-    tensor.insert(coord, values[i]);
-    if (symm && coord.front() != coord.back()) {
-      std::reverse(coord.begin(), coord.end());
-      tensor.insert(coord, values[i]);
-    }
-  }
+TensorBase readMTX(std::istream& stream, const ModeFormat& modetype, bool pack) {
+  return dispatchReadMTX(stream, modetype, pack);
+}
 
-  return tensor;
+TensorBase readMTX(std::istream& stream, const Format& format, bool pack) {
+  return dispatchReadMTX(stream, format, pack);
 }
 
 TensorBase readSparse(std::istream& stream, const ModeFormat& modetype, 
                       bool symm) {
-  return dispatchReadSparse(stream, modetype, symm);
+  string contents = readStream(stream);
+  return dispatchReadSparse(contents.data(), contents.data() + contents.size(),
+                            modetype, symm);
 }
 
 TensorBase readSparse(std::istream& stream, const Format& format, bool symm) {
-  return dispatchReadSparse(stream, format, symm);
-}
-
-template <typename T>
-TensorBase dispatchReadDense(std::istream& stream, const T& format, bool symm) {
-  string line;
-  std::getline(stream,line);
-
-  // Skip comments at the top of the file
-  string token;
-  do {
-    std::stringstream lineStream(line);
-    lineStream >> token;
-    if (token[0] != '%') {
-      break;
-    }
-  } while (std::getline(stream, line));
-
-  // The first non-comment line is the header with dimension sizes
-  vector<int> dimensions;
-  char* linePtr = (char*)line.data();
-  while (size_t dimension = strtoul(linePtr, &linePtr, 10)) {
-    taco_uassert(dimension <= INT_MAX) << "Dimension exceeds INT_MAX";
-    dimensions.push_back(static_cast<int>(dimension));
-  }
-  if (symm)
-    taco_uassert(dimensions.size()==2) << "Symmetry only available for matrix";
-
-  vector<double> values;
-  auto size = std::accumulate(begin(dimensions), end(dimensions),
-                              1, std::multiplies<double>());
-  values.reserve(size);
-
-  while (std::getline(stream, line)) {
-    linePtr = (char*)line.data();
-    double val = strtod(linePtr, &linePtr);
-    values.push_back(val);
-  }
-
-  // Create matrix
-  TensorBase tensor(type<double>(), dimensions, format);
-  if (symm)
-    tensor.reserve(2*size);
-  else
-    tensor.reserve(size);
-
-  // Insert coordinates
-  std::vector<int> coord;
-  for (auto n = 0; n<size; n++) {
-    coord.clear();
-    auto index=n;
-    for (size_t mode = 0; mode < dimensions.size()-1; mode++) {
-      coord.push_back(index%dimensions[mode]);
-      index=index/dimensions[mode];
-    }
-    coord.push_back(index);
-    tensor.insert(coord, values[n]);
-    if (symm && coord.front() != coord.back()) {
-      std::reverse(coord.begin(), coord.end());
-      tensor.insert(coord, values[n]);
-    }
-  }
-
-  return tensor;
+  string contents = readStream(stream);
+  return dispatchReadSparse(contents.data(), contents.data() + contents.size(),
+                            format, symm);
 }
 
 TensorBase readDense(std::istream& stream, const ModeFormat& modetype, 
                      bool symm) {
-  return dispatchReadDense(stream, modetype, symm);
+  string contents = readStream(stream);
+  return dispatchReadDense(contents.data(), contents.data() + contents.size(),
+                           modetype, symm);
 }
 
 TensorBase readDense(std::istream& stream, const Format& format, bool symm) {
-  return dispatchReadDense(stream, format, symm);
+  string contents = readStream(stream);
+  return dispatchReadDense(contents.data(), contents.data() + contents.size(),
+                           format, symm);
 }
 
 void writeMTX(std::string filename, const TensorBase& tensor) {
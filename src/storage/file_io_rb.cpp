@@ -14,6 +14,7 @@
 #include "taco/util/files.h"
 #include "taco/util/collections.h"
 #include "taco/cuda.h"
+#include "storage/coordinate_parser.h"
 
 using namespace std;
 
@@ -245,13 +246,14 @@ void writeHeader(std::ostream &hbfile,
 
 void readIndices(std::istream &hbfile, int linesize, int indices[]){
   std::string line;
-  std::string ptr;
+  long index;
   int ptr_ind=0;
   for (auto i = 0; i < linesize; i++) {
     std::getline(hbfile,line);
-    std::istringstream iss(line);
-    while(iss >> ptr) {
-      indices[ptr_ind] = std::stoi(ptr) -1;
+    const char* ptr = line.data();
+    while (parseInt(ptr, line.data() + line.size(), &index)) {
+      taco_uassert(index <= INT_MAX) << "Index exceeds INT_MAX";
+      indices[ptr_ind] = (int)index -1;
       ptr_ind++;
     }
   }
@@ -270,13 +272,13 @@ void writeIndices(std::ostream &hbfile, int indsize,
 
 void readValues(std::istream &hbfile, int linesize, double values[]){
   std::string line;
-  std::string ptr;
   int ptr_ind=0;
   for (auto i = 0; i < linesize; i++) {
     std::getline(hbfile,line);
-    std::istringstream iss(line);
-    while(iss >> ptr) {
-      values[ptr_ind] = std::stod(ptr);
+    const char* ptr = line.data();
+    double value;
+    while (parseDouble(ptr, line.data() + line.size(), &value)) {
+      values[ptr_ind] = value;
       ptr_ind++;
     }
   }
@@ -341,6 +343,9 @@ TensorBase readRB(std::istream& stream, const Format& format, bool pack) {
 
   storage.setIndex(index);
   storage.setValues(values);
+  // The components are already packed, so packing must not replace them with
+  // the empty insert buffer
+  tensor.setStorage(storage);
 
   if (pack) {
     tensor.pack();
@@ -7,76 +7,53 @@
 #include <vector>
 #include <cmath>
 #include <climits>
+#include <cctype>
+#include <iterator>
 
 #include "taco/tensor.h"
 #include "taco/format.h"
 #include "taco/error.h"
 #include "taco/util/strings.h"
 #include "taco/util/files.h"
+#include "storage/coordinate_parser.h"
 
 using namespace std;
 
 namespace taco {
 
 template <typename T>
-TensorBase dispatchReadTNS(std::string filename, const T& format, bool pack) {
-  std::fstream file;
-  util::openStream(file, filename, fstream::in);
-  TensorBase tensor = readTNS(file, format, pack);
-  file.close();
-  return tensor;
-}
-
-TensorBase readTNS(std::string filename, const ModeFormat& modetype, bool pack) {
-  return dispatchReadTNS(filename, modetype, pack);
-}
-
-TensorBase readTNS(std::string filename, const Format& format, bool pack) {
-  return dispatchReadTNS(filename, format, pack);
-}
-
-template <typename T>
-TensorBase dispatchReadTNS(std::istream& stream, const T& format, bool pack) {
-  std::vector<int>    coordinates;
-  std::vector<double> values;
-
-  std::string line;
-  if (!std::getline(stream, line)) {
+static TensorBase dispatchReadTNS(const char* begin, const char* end,
+                                  const T& format, bool pack) {
+  // Infer tensor order from the first coordinate
+  const char* ptr = begin;
+  while (ptr < end && isspace(*ptr)) {
+    ptr++;
+  }
+  if (ptr == end) {
     return TensorBase();
   }
-
-  // Infer tensor order from the first coordinate
-  vector<string> toks = util::split(line, " ");
-  size_t order = toks.size()-1;
-  std::vector<int> dimensions(order);
-  std::vector<int> coordinate(order);
+  int numTokens = 0;
+  double token;
+  while (parseDouble(ptr, end, &token)) {
+    numTokens++;
+  }
+  const int order = numTokens - 1;
 
   // Load data
-  do {
-    char* linePtr = (char*)line.data();
-    for (size_t i = 0; i < order; i++) {
-      long idx = strtol(linePtr, &linePtr, 10);
-      taco_uassert(idx <= INT_MAX)<<"Coordinate in file is larger than INT_MAX";
-      coordinate[i] = (int)idx - 1;
-      dimensions[i] = std::max(dimensions[i], (int)idx);
+  vector<CoordinateChunk> chunks = parseCoordinates(begin, end, order,
+                                                    taco_get_num_threads());
+  std::vector<int> dimensions(order, 0);
+  for (auto& chunk : chunks) {
+    for (int i = 0; i < order; i++) {
+      dimensions[i] = std::max(dimensions[i], chunk.dimensions[i]);
     }
-    coordinates.insert(coordinates.end(), coordinate.begin(), coordinate.end());
-    double val = strtod(linePtr, &linePtr);
-    values.push_back(val);
-
-  } while (std::getline(stream, line));
+  }
 
   // Create tensor
-  const size_t nnz = values.size();
   TensorBase tensor(type<double>(), dimensions, format);
-  tensor.reserve(nnz);
-
-  // Insert coordinates (TODO add and use bulk insertion)
-  for (size_t i = 0; i < nnz; i++) {
-    for (size_t j = 0; j < order; j++) {
-      coordinate[j] = coordinates[i*order + j];
-    }
-    tensor.insert(coordinate, values[i]);
+  for (auto& chunk : chunks) {
+    tensor.insertBatch(chunk.coordinates.data(), chunk.values.data(),
+                       chunk.values.size());
   }
 
   if (pack) {
@@ -86,6 +63,28 @@ TensorBase dispatchReadTNS(std::istream& stream, const T& format, bool pack) {
   return tensor;
 }
 
+template <typename T>
+TensorBase dispatchReadTNS(std::string filename, const T& format, bool pack) {
+  util::MappedFile file(filename);
+  return dispatchReadTNS(file.data(), file.data() + file.size(), format, pack);
+}
+
+TensorBase readTNS(std::string filename, const ModeFormat& modetype, bool pack) {
+  return dispatchReadTNS(filename, modetype, pack);
+}
+
+TensorBase readTNS(std::string filename, const Format& format, bool pack) {
+  return dispatchReadTNS(filename, format, pack);
+}
+
+template <typename T>
+TensorBase dispatchReadTNS(std::istream& stream, const T& format, bool pack) {
+  std::string contents((std::istreambuf_iterator<char>(stream)),
+                       std::istreambuf_iterator<char>());
+  return dispatchReadTNS(contents.data(), contents.data() + contents.size(),
+                         format, pack);
+}
+
 TensorBase readTNS(std::istream& stream, const ModeFormat& modetype, bool pack) {
   return dispatchReadTNS(stream, modetype, pack);
 }
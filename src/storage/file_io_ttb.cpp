@@ -0,0 +1,305 @@
+#include "taco/storage/file_io_ttb.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <vector>
+
+#include "taco/tensor.h"
+#include "taco/format.h"
+#include "taco/error.h"
+#include "taco/storage/index.h"
+#include "taco/storage/array.h"
+#include "taco/util/files.h"
+
+using namespace std;
+
+namespace taco {
+
+/// A ttb file starts with a header, followed by one level header per level.
+/// The pos, crd and vals arrays follow in storage order, each starting at a
+/// multiple of `alignment` bytes from the start of the file so that they can
+/// be used in place when the file is memory-mapped. All integers are stored in
+/// the byte order of the machine that wrote the file.
+namespace {
+
+const char magic[8] = {'T', 'A', 'C', 'O', 'T', 'T', 'B', '\0'};
+const uint32_t version = 1;
+const size_t alignment = 64;
+
+enum LevelFormat : uint32_t {DenseLevel, CompressedLevel, SingletonLevel};
+
+struct Header {
+  char     magic[8];
+  uint32_t version;
+  uint32_t order;
+  uint32_t componentType;
+  uint32_t reserved;
+  uint64_t valsOffset;
+  uint64_t valsSize;
+};
+
+struct LevelHeader {
+  int32_t  mode;
+  int32_t  dimension;
+  uint32_t format;
+  uint32_t isOrdered;
+  uint32_t isUnique;
+  uint32_t reserved;
+  uint64_t posOffset;
+  uint64_t posSize;
+  uint64_t crdOffset;
+  uint64_t crdSize;
+};
+
+size_t align(size_t offset) {
+  return (offset + alignment - 1) / alignment * alignment;
+}
+
+LevelFormat getLevelFormat(const ModeFormat& modeFormat) {
+  if (modeFormat.getName() == Dense.getName()) {
+    return DenseLevel;
+  } else if (modeFormat.getName() == Sparse.getName()) {
+    return CompressedLevel;
+  } else if (modeFormat.getName() == Singleton.getName()) {
+    return SingletonLevel;
+  }
+  taco_not_supported_yet;
+  return DenseLevel;
+}
+
+/// Wraps the arrays of a ttb file in `data`, which `owner` keeps alive, in a
+/// tensor of the given format. The tensor is already packed.
+TensorBase readTTB(const char* data, size_t size, shared_ptr<void> owner,
+                   const Format& format) {
+  taco_uassert(size >= sizeof(Header)) << "The file is not a ttb file";
+  const Header& header = *(const Header*)data;
+  taco_uassert(memcmp(header.magic, magic, sizeof(magic)) == 0) <<
+      "The file is not a ttb file";
+  taco_uassert(header.version == version) <<
+      "Unsupported ttb version " << header.version;
+  taco_uassert(header.order <= (size - sizeof(Header)) / sizeof(LevelHeader)) <<
+      "The ttb file is truncated";
+  taco_uassert((int64_t)header.order == format.getOrder()) <<
+      "The ttb file stores a tensor of order " << header.order <<
+      " that cannot be read as order " << format.getOrder();
+  taco_uassert(header.componentType < (uint32_t)Datatype::Undefined) <<
+      "The ttb file has an invalid component type";
+  const LevelHeader* levels = (const LevelHeader*)(data + sizeof(Header));
+
+  // The array must lie in the file, which is checked without overflowing, and
+  // be aligned to its elements
+  auto arrayData = [&](uint64_t offset, uint64_t count, size_t elementSize) {
+    taco_uassert(offset <= size && count <= (size - offset) / elementSize) <<
+        "The ttb file is truncated";
+    taco_uassert(offset % elementSize == 0) <<
+        "The ttb file has a misaligned array";
+    return (void*)(data + offset);
+  };
+
+  // Coordinates must lie in the dimension of their level, since kernels use
+  // them to index dense operands and results
+  auto inDimension = [](const int* crd, uint64_t count, int dimension) {
+    return std::all_of(crd, crd + count, [dimension](int coord) {
+      return coord >= 0 && coord < dimension;
+    });
+  };
+
+  // The number of positions of the previous level, which bounds the arrays of
+  // the next level
+  uint64_t numPositions = 1;
+  vector<int> dimensions(header.order);
+  vector<ModeIndex> modeIndices;
+  for (int i = 0; i < (int)header.order; i++) {
+    const LevelHeader& level = levels[i];
+    const ModeFormat modeFormat = format.getModeFormats()[i];
+    taco_uassert(level.mode == format.getModeOrdering()[i] &&
+                 level.format == getLevelFormat(modeFormat) &&
+                 (bool)level.isOrdered == modeFormat.isOrdered() &&
+                 (bool)level.isUnique == modeFormat.isUnique()) <<
+        "The ttb file must be read in the format it was written in";
+    taco_uassert(format.getCoordinateTypePos(i) == type<int>() &&
+                 format.getCoordinateTypeIdx(i) == type<int>()) <<
+        "ttb files store Int32 index arrays";
+    taco_uassert(level.dimension >= 0) <<
+        "The ttb file has a negative dimension";
+    dimensions[level.mode] = level.dimension;
+
+    switch (level.format) {
+      case DenseLevel:
+        taco_uassert(level.dimension == 0 ||
+                     numPositions <= UINT64_MAX / level.dimension) <<
+            "The ttb file has too many components";
+        numPositions *= level.dimension;
+        modeIndices.push_back(ModeIndex({makeArray({level.dimension})}));
+        break;
+      case CompressedLevel: {
+        const int* pos = (const int*)arrayData(level.posOffset, level.posSize,
+                                               sizeof(int));
+        const int* crd = (const int*)arrayData(level.crdOffset, level.crdSize,
+                                               sizeof(int));
+        taco_uassert(level.posSize == numPositions + 1 && pos[0] == 0 &&
+                     std::is_sorted(pos, pos + level.posSize) &&
+                     (uint64_t)pos[numPositions] <= level.crdSize) <<
+            "The ttb file has inconsistent positions";
+        numPositions = pos[numPositions];
+        taco_uassert(inDimension(crd, numPositions, level.dimension)) <<
+            "The ttb file has coordinates outside their dimension";
+        modeIndices.push_back(ModeIndex({
+          Array(type<int>(), (void*)pos, level.posSize, owner),
+          Array(type<int>(), (void*)crd, level.crdSize, owner)}));
+        break;
+      }
+      case SingletonLevel: {
+        const int* crd = (const int*)arrayData(level.crdOffset, level.crdSize,
+                                               sizeof(int));
+        taco_uassert(level.crdSize >= numPositions) <<
+            "The ttb file has inconsistent positions";
+        taco_uassert(inDimension(crd, numPositions, level.dimension)) <<
+            "The ttb file has coordinates outside their dimension";
+        modeIndices.push_back(ModeIndex({
+          makeArray(type<int>(), 0),
+          Array(type<int>(), (void*)crd, level.crdSize, owner)}));
+        break;
+      }
+    }
+  }
+
+  const Datatype componentType((Datatype::Kind)header.componentType);
+  void* vals = arrayData(header.valsOffset, header.valsSize,
+                         componentType.getNumBytes());
+  taco_uassert(header.valsSize >= numPositions) <<
+      "The ttb file has fewer values than components";
+  TensorBase tensor(componentType, dimensions, format);
+  auto storage = tensor.getStorage();
+  storage.setIndex(Index(format, modeIndices));
+  storage.setValues(Array(componentType, vals, header.valsSize, owner));
+  tensor.setStorage(storage);
+  return tensor;
+}
+
+Format getFormat(int order, const ModeFormat& modetype) {
+  return Format(vector<ModeFormatPack>(order, modetype));
+}
+
+/// Returns the order of the tensor in a ttb file, so that a mode format can be
+/// expanded to a tensor format.
+int getOrder(const char* data, size_t size) {
+  taco_uassert(size >= sizeof(Header)) << "The file is not a ttb file";
+  return ((const Header*)data)->order;
+}
+
+/// Reads a stream into a buffer that is aligned like a memory-mapped file.
+shared_ptr<void> readStream(std::istream& stream, size_t* size) {
+  string contents((std::istreambuf_iterator<char>(stream)),
+                  std::istreambuf_iterator<char>());
+  *size = contents.size();
+  void* buffer = nullptr;
+  taco_uassert(posix_memalign(&buffer, alignment,
+                              std::max(*size, (size_t)1)) == 0) <<
+      "Out of memory";
+  memcpy(buffer, contents.data(), *size);
+  return shared_ptr<void>(buffer, free);
+}
+
+}
+
+TensorBase readTTB(std::string filename, const ModeFormat& modetype,
+                   bool pack) {
+  auto file = make_shared<util::MappedFile>(filename, true);
+  return readTTB(file->data(), file->size(), file,
+                 getFormat(getOrder(file->data(), file->size()), modetype));
+}
+
+TensorBase readTTB(std::string filename, const Format& format, bool pack) {
+  auto file = make_shared<util::MappedFile>(filename, true);
+  return readTTB(file->data(), file->size(), file, format);
+}
+
+TensorBase readTTB(std::istream& stream, const ModeFormat& modetype,
+                   bool pack) {
+  size_t size;
+  shared_ptr<void> buffer = readStream(stream, &size);
+  const char* data = (const char*)buffer.get();
+  return readTTB(data, size, buffer, getFormat(getOrder(data, size), modetype));
+}
+
+TensorBase readTTB(std::istream& stream, const Format& format, bool pack) {
+  size_t size;
+  shared_ptr<void> buffer = readStream(stream, &size);
+  return readTTB((const char*)buffer.get(), size, buffer, format);
+}
+
+void writeTTB(std::string filename, const TensorBase& tensor) {
+  std::fstream file;
+  util::openStream(file, filename, fstream::out | fstream::binary);
+  writeTTB(file, tensor);
+  file.close();
+}
+
+void writeTTB(std::ostream& stream, const TensorBase& tensor) {
+  TensorBase packed = tensor;
+  packed.pack();
+  const Format& format = packed.getFormat();
+  const Index index = packed.getStorage().getIndex();
+  const int order = packed.getOrder();
+
+  Header header = {};
+  memcpy(header.magic, magic, sizeof(magic));
+  header.version = version;
+  header.order = order;
+  header.componentType = packed.getComponentType().getKind();
+
+  // Lay out the arrays after the headers
+  vector<LevelHeader> levels(order);
+  vector<const Array*> arrays;
+  size_t offset = sizeof(Header) + order * sizeof(LevelHeader);
+  auto place = [&](const Array& array, uint64_t* arrayOffset,
+                   uint64_t* arraySize) {
+    taco_uassert(array.getType() == type<int>()) << error::type_mismatch;
+    offset = align(offset);
+    *arrayOffset = offset;
+    *arraySize = array.getSize();
+    offset += array.getSize() * sizeof(int);
+    arrays.push_back(&array);
+  };
+  for (int i = 0; i < order; i++) {
+    const ModeFormat modeFormat = format.getModeFormats()[i];
+    const ModeIndex& modeIndex = index.getModeIndex(i);
+    LevelHeader& level = levels[i];
+    level.mode = format.getModeOrdering()[i];
+    level.dimension = packed.getDimension(level.mode);
+    level.format = getLevelFormat(modeFormat);
+    level.isOrdered = modeFormat.isOrdered();
+    level.isUnique = modeFormat.isUnique();
+    if (level.format == CompressedLevel) {
+      place(modeIndex.getIndexArray(0), &level.posOffset, &level.posSize);
+    }
+    if (level.format != DenseLevel) {
+      place(modeIndex.getIndexArray(1), &level.crdOffset, &level.crdSize);
+    }
+  }
+  const size_t csize = packed.getComponentType().getNumBytes();
+  header.valsOffset = align(offset);
+  header.valsSize = index.getSize();
+
+  stream.write((const char*)&header, sizeof(Header));
+  stream.write((const char*)levels.data(), order * sizeof(LevelHeader));
+  offset = sizeof(Header) + order * sizeof(LevelHeader);
+  const char padding[alignment] = {};
+  for (const Array* array : arrays) {
+    stream.write(padding, align(offset) - offset);
+    offset = align(offset);
+    stream.write((const char*)array->getData(), array->getSize() * sizeof(int));
+    offset += array->getSize() * sizeof(int);
+  }
+  stream.write(padding, header.valsOffset - offset);
+  stream.write((const char*)packed.getStorage().getValues().getData(),
+               header.valsSize * csize);
+}
+
+}
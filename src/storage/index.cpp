@@ -5,6 +5,7 @@
 
 #include "taco/format.h"
 #include "taco/error.h"
+#include "taco/error/error_messages.h"
 #include "taco/storage/array.h"
 
 using namespace std;
@@ -59,6 +60,11 @@ size_t Index::getSize() const {
       size *= modeIndex.getIndexArray(0).get(0).getAsIndex();
     } else if (modeType.getName() == Sparse.getName()) {
       size = modeIndex.getIndexArray(0).get(size).getAsIndex();
+    } else if (modeType.getName() == Singleton.getName()) {
+      continue;
+    } else if (modeType.getName() == Hashed.getName() ||
+               modeType.getName() == Bitmap.getName()) {
+      size *= modeIndex.getIndexArray(0).get(0).getAsIndex();
     } else {
       taco_not_supported_yet;
     }
@@ -106,6 +112,84 @@ Array ModeIndex::getIndexArray(int i) {
 }
 
 // Factory functions
+static void validateCoordinates(const int* crd, size_t begin, size_t end,
+                                int dimension, int level, bool ordered,
+                                bool unique) {
+  for (size_t i = begin; i < end; ++i) {
+    taco_uassert(crd[i] >= 0 && crd[i] < dimension) <<
+        "Coordinate " << crd[i] << " at position " << i << " of level " <<
+        level << " is out of bounds for dimension " << dimension;
+    if (ordered && i > begin) {
+      taco_uassert(unique ? crd[i-1] < crd[i] : crd[i-1] <= crd[i]) <<
+          "Coordinates at positions " << i-1 << " and " << i <<
+          " of level " << level << " are not " <<
+          (unique ? "strictly increasing" : "ordered");
+    }
+  }
+}
+
+Index makeIndex(const Format& format, const vector<int>& dimensions,
+                const vector<vector<int*>>& indices, Array::Policy policy,
+                bool validate) {
+  const int order = format.getOrder();
+  taco_uassert((size_t)order == dimensions.size()) <<
+      "The format has " << order << " modes but " << dimensions.size() <<
+      " dimensions were given";
+  taco_uassert((size_t)order == indices.size()) <<
+      "The format has " << order << " levels but " << indices.size() <<
+      " levels of index arrays were given";
+
+  vector<ModeIndex> modeIndices;
+  size_t size = 1;
+  for (int i = 0; i < order; i++) {
+    const ModeFormat modeFormat = format.getModeFormats()[i];
+    const int dimension = dimensions[format.getModeOrdering()[i]];
+    const vector<int*>& arrays = indices[i];
+    if (modeFormat.getName() == Dense.getName()) {
+      taco_uassert(arrays.empty()) <<
+          "Dense level " << i << " takes no index arrays";
+      modeIndices.push_back(ModeIndex({makeArray({dimension})}));
+      size *= dimension;
+    } else if (modeFormat.getName() == Sparse.getName()) {
+      taco_uassert(arrays.size() == 2) <<
+          "Compressed level " << i << " takes a pos and a crd array";
+      taco_uassert(format.getCoordinateTypePos(i) == type<int>() &&
+                   format.getCoordinateTypeIdx(i) == type<int>()) <<
+          error::type_mismatch;
+      const int* pos = arrays[0];
+      const int* crd = arrays[1];
+      if (validate) {
+        taco_uassert(pos[0] == 0) <<
+            "The pos array of level " << i << " must start at 0";
+        for (size_t j = 0; j < size; ++j) {
+          taco_uassert(pos[j] <= pos[j+1]) <<
+              "The pos array of level " << i << " decreases at position " << j;
+          validateCoordinates(crd, pos[j], pos[j+1], dimension, i,
+                              modeFormat.isOrdered(), modeFormat.isUnique());
+        }
+      }
+      const size_t numCoordinates = pos[size];
+      modeIndices.push_back(ModeIndex({makeArray(arrays[0], size+1, policy),
+                                       makeArray(arrays[1], numCoordinates,
+                                                 policy)}));
+      size = numCoordinates;
+    } else if (modeFormat.getName() == Singleton.getName()) {
+      taco_uassert(arrays.size() == 1) <<
+          "Singleton level " << i << " takes a crd array";
+      taco_uassert(format.getCoordinateTypeIdx(i) == type<int>()) <<
+          error::type_mismatch;
+      if (validate) {
+        validateCoordinates(arrays[0], 0, size, dimension, i, false, false);
+      }
+      modeIndices.push_back(ModeIndex({makeArray(type<int>(), 0),
+                                       makeArray(arrays[0], size, policy)}));
+    } else {
+      taco_not_supported_yet;
+    }
+  }
+  return Index(format, modeIndices);
+}
+
 Index makeCSRIndex(size_t numrows, int* rowptr, int* colidx) {
   return Index(CSR, {ModeIndex({makeArray({(int)numrows})}),
                      ModeIndex({makeArray(rowptr, numrows+1),
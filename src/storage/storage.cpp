@@ -45,6 +45,9 @@ struct TensorStorage::Content {
         modeTypes[i] = taco_mode_sparse;
       } else if (modeType.getName() == Singleton.getName()) {
         modeTypes[i] = taco_mode_sparse;
+      } else if (modeType.getName() == Hashed.getName() ||
+                 modeType.getName() == Bitmap.getName()) {
+        modeTypes[i] = taco_mode_sparse;
       } else {
         taco_not_supported_yet;
       }
@@ -153,6 +156,17 @@ TensorStorage::operator struct taco_tensor_t*() const {
         tensorData->indices[i][1] = (uint8_t*)idx.getData();
       }
     }
+    // Hashed levels have the width of their hash tables and the coordinates
+    // of the slots, and bitmap levels have their size and the bitmap
+    else if (modeType.getName() == Hashed.getName() ||
+             modeType.getName() == Bitmap.getName()) {
+      const Array& width = modeIndex.getIndexArray(0);
+      tensorData->indices[i][0] = (uint8_t*)width.getData();
+      if (modeIndex.numIndexArrays() > 1) {
+        const Array& idx = modeIndex.getIndexArray(1);
+        tensorData->indices[i][1] = (uint8_t*)idx.getData();
+      }
+    }
     else {
       taco_not_supported_yet;
     }
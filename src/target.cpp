@@ -3,6 +3,7 @@
 #include <vector>
 
 #include "taco/target.h"
+#include "taco/util/env.h"
 
 using namespace std;
 
@@ -25,7 +26,9 @@ bool parseTargetString(Target& target, string target_string) {
   while (current_pos != string::npos) {
     tokens.push_back(rest.substr(0, current_pos));
     rest = rest.substr(current_pos+1);
+    current_pos = rest.find('-');
   }
+  tokens.push_back(rest);
   
   // now parse the tokens
   taco_uassert(tokens.size() >= 2) <<
@@ -76,6 +79,16 @@ bool Target::validateTargetString(const string &s) {
 }
 
 Target getTargetFromEnvironment() {
-  return Target(Target::Arch::C99, Target::OS::MacOS);
+  const string target = util::getFromEnv("TACO_TARGET", "");
+  if (target.empty()) {
+    return Target(Target::Arch::C99, Target::OS::MacOS);
+  }
+  Target result(Target::Arch::C99, Target::OS::MacOS);
+  bool valid = parseTargetString(result, target);
+  taco_uassert(valid) <<
+      "Invalid target string: " << target;
+  taco_uassert(result.arch == Target::C99 || LLVM_BUILT) <<
+      "Target " << target << " requires taco to be built with LLVM";
+  return result;
 }
 } // namespace taco
@@ -1,6 +1,9 @@
 #include "taco/tensor.h"
 
+#include <algorithm>
 #include <set>
+#include <map>
+#include <cmath>
 #include <cstring>
 #include <fstream>
 #include <sstream>
@@ -8,7 +11,10 @@
 #include <climits>
 #include <vector>
 #include <utility>
+#include <tuple>
 #include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
 
 #include "taco/cuda.h"
 #include "taco/format.h"
@@ -21,15 +27,19 @@
 //#include "codegen/codegen_cuda.h"
 //#include "taco/taco_tensor_t.h"
 #include "taco/index_notation/index_notation_visitor.h"
+#include "taco/index_notation/index_notation_rewriter.h"
 #include "taco/index_notation/transformations.h"
+#include "taco/kernel_bundle.h"
 #include "taco/ir/ir.h"
 #include "taco/ir/ir_printer.h"
 #include "taco/lower/lower.h"
+#include "taco/lower/lowerer_impl.h"
 #include "taco/storage/storage.h"
 #include "taco/storage/index.h"
 #include "taco/storage/array.h"
 #include "taco/storage/pack.h"
 #include "taco/storage/file_io_tns.h"
+#include "taco/storage/file_io_ttb.h"
 #include "taco/storage/file_io_mtx.h"
 #include "taco/storage/file_io_rb.h"
 #include "taco/storage/typed_vector.h"
@@ -43,6 +53,8 @@
 #include "error/error_checks.h"
 #include "taco/cuda.h"
 #include "lower/iteration_graph.h"
+#include "storage/coordinate_sort.h"
+#include "storage/convert.h"
 
 using namespace std;
 using namespace taco::ir;
@@ -76,6 +88,134 @@ TensorBase::TensorBase(std::string name, Datatype ctype,
                  std::vector<ModeFormatPack>(dimensions.size(), modeType)) {
 }
 
+/// The fewest slots per segment that hashed result levels start with.
+static const size_t minHashCapacity = 16;
+
+/// Returns the number of slots per segment of a hashed level of the given
+/// dimension, which is a power of two larger than the capacity (or all of the
+/// dimension if the capacity is 0).
+static int getHashedWidth(int dimension, int capacity) {
+  const int size = (capacity > 0) ? std::min(capacity, dimension) : dimension;
+  taco_uassert(size <= (1 << 30)) << "Hashed levels have at most 2^30 slots";
+  int width = 1;
+  while (width < size) {
+    width *= 2;
+  }
+  return width;
+}
+
+/// Set the number of slots per segment of the hashed levels of the tensor,
+/// which are given per level.
+static void setHashedWidths(const TensorBase& tensor,
+                            const std::vector<int>& widths) {
+  TensorStorage storage = tensor.getStorage();
+  const Format& format = storage.getFormat();
+  vector<ModeIndex> modeIndices;
+  for (int i = 0; i < format.getOrder(); ++i) {
+    if (format.getModeFormats()[i].getName() == Hashed.getName()) {
+      modeIndices.push_back(ModeIndex({makeArray({widths[i]})}));
+    } else {
+      modeIndices.push_back(storage.getIndex().getModeIndex(i));
+    }
+  }
+  storage.setIndex(Index(format, modeIndices));
+}
+
+/// Size the hashed levels of a tensor for its sorted coordinates, such that
+/// the hash table of every segment is at most half full.
+static void initHashedLevels(const TensorBase& tensor,
+                             const std::vector<std::vector<int>>& coordinates) {
+  const Format& format = tensor.getFormat();
+  if (!util::contains(format.getModeFormats(), Hashed)) {
+    return;
+  }
+  const size_t numCoordinates = coordinates.empty() ? 0 : coordinates[0].size();
+  vector<int> widths;
+  for (int i = 0; i < format.getOrder(); ++i) {
+    if (format.getModeFormats()[i].getName() != Hashed.getName()) {
+      widths.push_back(0);
+      continue;
+    }
+    // Count the distinct coordinates of each segment
+    int maxSegmentSize = 0;
+    int segmentSize = 0;
+    for (size_t k = 0; k < numCoordinates; ++k) {
+      bool isNewSegment = (k == 0);
+      for (int j = 0; j < i && !isNewSegment; ++j) {
+        isNewSegment = (coordinates[j][k] != coordinates[j][k-1]);
+      }
+      if (isNewSegment) {
+        segmentSize = 1;
+      } else if (coordinates[i][k] != coordinates[i][k-1]) {
+        segmentSize++;
+      }
+      maxSegmentSize = std::max(maxSegmentSize, segmentSize);
+    }
+    const int dimension = tensor.getDimension(format.getModeOrdering()[i]);
+    widths.push_back(getHashedWidth(dimension, 2 * maxSegmentSize));
+  }
+  setHashedWidths(tensor, widths);
+}
+
+/// Size the hashed levels of a result before it is assembled, given the
+/// capacity of the segments of each level.
+static void initHashedResult(const TensorBase& tensor,
+                             const std::vector<int>& capacities) {
+  const Format& format = tensor.getFormat();
+  if (!util::contains(format.getModeFormats(), Hashed)) {
+    return;
+  }
+  vector<int> widths;
+  for (int i = 0; i < format.getOrder(); ++i) {
+    const int dimension = tensor.getDimension(format.getModeOrdering()[i]);
+    widths.push_back(getHashedWidth(dimension, capacities[i]));
+  }
+  setHashedWidths(tensor, widths);
+}
+
+/// Double the slots per segment of the hashed levels of an assembled result
+/// that have a segment without empty slots, unless the segments cover the
+/// dimension of the level. The coordinates of such a segment may not have fit
+/// in it, and lookups of coordinates that it does not store would fail.
+/// Returns true if a level was grown, in which case the result must be
+/// assembled again.
+static bool growFullHashedLevels(const TensorBase& tensor) {
+  const Format& format = tensor.getFormat();
+  if (!util::contains(format.getModeFormats(), Hashed)) {
+    return false;
+  }
+  const Index& index = tensor.getStorage().getIndex();
+  bool grown = false;
+  vector<int> widths;
+  for (int i = 0; i < format.getOrder(); ++i) {
+    if (format.getModeFormats()[i].getName() != Hashed.getName()) {
+      widths.push_back(0);
+      continue;
+    }
+    const ModeIndex modeIndex = index.getModeIndex(i);
+    const int width = (int)modeIndex.getIndexArray(0).get(0).getAsIndex();
+    const int dimension = tensor.getDimension(format.getModeOrdering()[i]);
+    widths.push_back(width);
+    if (width >= dimension) {
+      continue;
+    }
+    const Array crd = modeIndex.getIndexArray(1);
+    const int* slots = (const int*)crd.getData();
+    for (size_t segment = 0; segment < crd.getSize(); segment += width) {
+      if (std::none_of(slots + segment, slots + segment + width,
+                       [](int coord) { return coord < 0; })) {
+        widths.back() = getHashedWidth(dimension, 2 * width);
+        grown = true;
+        break;
+      }
+    }
+  }
+  if (grown) {
+    setHashedWidths(tensor, widths);
+  }
+  return grown;
+}
+
 static Format initFormat(Format format) {
   // Initialize coordinate types for Format if not already set
   if (format.getLevelArrayTypes().size() < (size_t)format.getOrder()) {
@@ -91,6 +231,12 @@ static Format initFormat(Format format) {
       } else if (modeType.getName() == Singleton.getName()) {
         arrayTypes.push_back(Int32);
         arrayTypes.push_back(Int32);
+      } else if (modeType.getName() == Hashed.getName()) {
+        arrayTypes.push_back(Int32);
+        arrayTypes.push_back(Int32);
+      } else if (modeType.getName() == Bitmap.getName()) {
+        arrayTypes.push_back(Int32);
+        arrayTypes.push_back(UInt8);
       } else {
         taco_not_supported_yet;
       }
@@ -107,22 +253,44 @@ TensorBase::TensorBase(string name, Datatype ctype, vector<int> dimensions,
   taco_uassert((size_t)format.getOrder() == dimensions.size()) <<
       "The number of format mode types (" << format.getOrder() << ") " <<
       "must match the tensor order (" << dimensions.size() << ").";
+  for (int i = 0; i < format.getOrder(); ++i) {
+    if (format.getModeFormats()[i].getName() == Dense.getName() ||
+        format.getModeFormats()[i].getName() == Bitmap.getName()) {
+      continue;
+    }
+    // Coordinates range up to the dimension minus one
+    const Datatype crdType = getFormat().getCoordinateTypeIdx(i);
+    const int valueBits = crdType.getNumBits() - (crdType.isInt() ? 1 : 0);
+    const int dimension = content->dimensions[format.getModeOrdering()[i]];
+    taco_uassert(valueBits >= 31 || dimension <= (1 << valueBits)) <<
+        "The coordinates of a mode of size " << dimension <<
+        " do not fit in " << crdType << " coordinate arrays";
+  }
 
   content->allocSize = 1 << 20;
+  content->hashCapacity = 0;
 
   vector<ModeIndex> modeIndices(format.getOrder());
   // Initialize dense storage modes
   // TODO: Get rid of this and make code use dimensions instead of dense indices
   for (int i = 0; i < format.getOrder(); ++i) {
-    if (format.getModeFormats()[i].getName() == Dense.getName()) {
-      const size_t idx = format.getModeOrdering()[i];
+    const size_t idx = format.getModeOrdering()[i];
+    if (format.getModeFormats()[i].getName() == Dense.getName() ||
+        format.getModeFormats()[i].getName() == Bitmap.getName()) {
       modeIndices[i] = ModeIndex({makeArray({content->dimensions[idx]})});
+    } else if (format.getModeFormats()[i].getName() == Hashed.getName()) {
+      const int width = getHashedWidth(content->dimensions[idx], 0);
+      modeIndices[i] = ModeIndex({makeArray({width})});
     }
   }
   content->storage.setIndex(Index(format, modeIndices));
 
   content->assembleWhileCompute = false;
+  content->symbolicAssembly = false;
+  content->fuseProducers = false;
+  content->atomicSchedules = false;
   content->module = make_shared<Module>();
+  content->allocator = nullptr;
 
   content->neverPacked = true;
   content->needsPack = true;
@@ -132,6 +300,7 @@ TensorBase::TensorBase(string name, Datatype ctype, vector<int> dimensions,
 
   content->coordinateBuffer = shared_ptr<vector<char>>(new vector<char>);
   content->coordinateBufferUsed = 0;
+  content->coordinateBufferSorted = true;
   content->coordinateSize = getOrder()*sizeof(int) + ctype.getNumBytes();
 }
 
@@ -157,6 +326,45 @@ void TensorBase::reserve(size_t numCoordinates) {
   content->coordinateBuffer->resize(newSize);
 }
 
+void TensorBase::insertBatchUnchecked(const int* coordinates,
+                                      const char* values, size_t count,
+                                      bool sorted) {
+  if (count == 0) {
+    return;
+  }
+  const int order = getOrder();
+  const size_t coordinatesSize = order * sizeof(int);
+  const size_t csize = getComponentType().getNumBytes();
+  const size_t coordSize = content->coordinateSize;
+
+  // The buffer stays sorted if the batch is sorted and starts after the last
+  // buffered coordinate.
+  if (content->coordinateBufferSorted && sorted &&
+      content->coordinateBufferUsed > 0) {
+    const int* last = (const int*)&content->coordinateBuffer->data()[
+        content->coordinateBufferUsed - coordSize];
+    const std::vector<int>& modeOrdering = getFormat().getModeOrdering();
+    int i = 0;
+    while (i < order && last[modeOrdering[i]] == coordinates[modeOrdering[i]]) {
+      i++;
+    }
+    sorted = (i < order && last[modeOrdering[i]] < coordinates[modeOrdering[i]]);
+  }
+  content->coordinateBufferSorted = content->coordinateBufferSorted && sorted;
+
+  const size_t used = content->coordinateBufferUsed;
+  if (content->coordinateBuffer->size() - used < count * coordSize) {
+    content->coordinateBuffer->resize(used + count * coordSize);
+  }
+  char* coordLoc = &content->coordinateBuffer->data()[used];
+  for (size_t i = 0; i < count; ++i) {
+    memcpy(coordLoc, &coordinates[i * order], coordinatesSize);
+    memcpy(coordLoc + coordinatesSize, &values[i * csize], csize);
+    coordLoc += coordSize;
+  }
+  content->coordinateBufferUsed += count * coordSize;
+}
+
 int TensorBase::getDimension(int mode) const {
   taco_uassert(mode < getOrder()) << "Invalid mode";
   return content->dimensions[mode];
@@ -182,6 +390,14 @@ TensorStorage& TensorBase::getStorage() {
   return content->storage;
 }
 
+void TensorBase::setAllocator(taco_allocator_t* allocator) {
+  content->allocator = allocator;
+}
+
+taco_allocator_t* TensorBase::getAllocator() const {
+  return content->allocator;
+}
+
 void TensorBase::setAllocSize(size_t allocSize) {
   content->allocSize = allocSize;
 }
@@ -190,6 +406,15 @@ size_t TensorBase::getAllocSize() const {
   return content->allocSize;
 }
 
+void TensorBase::setHashCapacity(int capacity) {
+  taco_uassert(capacity >= 0) << "The hash capacity must not be negative";
+  content->hashCapacity = capacity;
+}
+
+int TensorBase::getHashCapacity() const {
+  return content->hashCapacity;
+}
+
 void TensorBase::unsetNeverPacked() {
   content->neverPacked = false;
 }
@@ -234,15 +459,16 @@ void TensorBase::setAssembleWhileCompute(bool assembleWhileCompute) {
   content->assembleWhileCompute = assembleWhileCompute;
 }
 
-static size_t numIntegersToCompare = 0;
-static int lexicographicalCmp(const void* a, const void* b) {
-  for (size_t i = 0; i < numIntegersToCompare; i++) {
-    int diff = ((int*)a)[i] - ((int*)b)[i];
-    if (diff != 0) {
-      return diff;
-    }
-  }
-  return 0;
+void TensorBase::setSymbolicAssembly(bool symbolicAssembly) {
+  content->symbolicAssembly = symbolicAssembly;
+}
+
+void TensorBase::setFuseProducers(bool fuseProducers) {
+  content->fuseProducers = fuseProducers;
+}
+
+void TensorBase::setAtomicSchedules(bool atomicSchedules) {
+  content->atomicSchedules = atomicSchedules;
 }
 
 static size_t unpackTensorData(const taco_tensor_t& tensorData,
@@ -259,20 +485,31 @@ static size_t unpackTensorData(const taco_tensor_t& tensorData,
       modeIndices.push_back(ModeIndex({size}));
       numVals *= ((int*)tensorData.indices[i][0])[0];
     } else if (modeType.getName() == Sparse.getName()) {
-      auto size = ((int*)tensorData.indices[i][0])[numVals];
-      Array pos = Array(type<int>(), tensorData.indices[i][0], numVals+1, Array::UserOwns);
-      Array idx = Array(type<int>(), tensorData.indices[i][1], size, Array::UserOwns);
+      Array pos = Array(format.getCoordinateTypePos(i), tensorData.indices[i][0], numVals+1, Array::UserOwns);
+      auto size = pos.get(numVals).getAsIndex();
+      Array idx = Array(format.getCoordinateTypeIdx(i), tensorData.indices[i][1], size, Array::UserOwns);
       modeIndices.push_back(ModeIndex({pos, idx}));
       numVals = size;
     } else if (modeType.getName() == Singleton.getName()) {
-      Array idx = Array(type<int>(), tensorData.indices[i][1], numVals, Array::UserOwns);
-      modeIndices.push_back(ModeIndex({makeArray(type<int>(), 0), idx}));
+      Array idx = Array(format.getCoordinateTypeIdx(i), tensorData.indices[i][1], numVals, Array::UserOwns);
+      modeIndices.push_back(ModeIndex({makeArray(format.getCoordinateTypePos(i), 0), idx}));
+    } else if (modeType.getName() == Hashed.getName() ||
+               modeType.getName() == Bitmap.getName()) {
+      const int width = *(int*)tensorData.indices[i][0];
+      Array idx = Array(format.getCoordinateTypeIdx(i), tensorData.indices[i][1], numVals*width, Array::UserOwns);
+      modeIndices.push_back(ModeIndex({makeArray({width}), idx}));
+      numVals *= width;
     } else {
       taco_not_supported_yet;
     }
   }
   storage.setIndex(Index(format, modeIndices));
-  storage.setValues(Array(tensor.getComponentType(), tensorData.vals, numVals));
+  if (tensor.getAllocator()) {
+    storage.setValues(Array(tensor.getComponentType(), tensorData.vals, numVals,
+                            tensor.getAllocator()));
+  } else {
+    storage.setValues(Array(tensor.getComponentType(), tensorData.vals, numVals));
+  }
   return numVals;
 }
 
@@ -365,90 +602,201 @@ void TensorBase::pack() {
     bufferStorage->indices[0][1] = (uint8_t*)bufferCoords.data();
     bufferStorage->vals = (uint8_t*)content->coordinateBuffer->data();
 
-    std::vector<void*> arguments = {content->storage, bufferStorage};
+    std::vector<void*> arguments = {content->storage, bufferStorage,
+                                    content->allocator};
     helperFuncs->callFuncPacked("pack", arguments.data());
     content->valuesSize = unpackTensorData(*((taco_tensor_t*)arguments[0]), *this);
+    resetStatistics();
 
     deinit_taco_tensor_t(bufferStorage);
     content->coordinateBuffer->clear();
     return;
   }
 
-  // Permute the coordinates according to the storage mode ordering.
-  // This is a workaround since the current pack code only packs tensors in the
-  // ordering of the modes.
+  // Permute the coordinates according to the storage mode ordering, sort
+  // them, and move them into separate arrays. The permutation is a workaround
+  // since the current pack code only packs tensors in the ordering of the
+  // modes, and the pack code expects the coordinates to be sorted.
   taco_iassert(getFormat().getOrder() == order);
   std::vector<int> permutation = getFormat().getModeOrdering();
-  std::vector<int> permutedDimensions(order);
-  for (int i = 0; i < order; ++i) {
-    permutedDimensions[i] = dimensions[permutation[i]];
-  }
-
-  const size_t coordSize = content->coordinateSize;
-  char* coordinatesPtr = content->coordinateBuffer->data();
-  vector<int> permuteBuffer(order);
-  for (size_t i = 0; i < numCoordinates; ++i) {
-    int* coordinate = (int*)coordinatesPtr;
-    for (int j = 0; j < order; j++) {
-      permuteBuffer[j] = coordinate[permutation[j]];
-    }
-    for (int j = 0; j < order; j++) {
-      coordinate[j] = permuteBuffer[j];
-    }
-    coordinatesPtr += content->coordinateSize;
-  }
-  coordinatesPtr = content->coordinateBuffer->data();
-
-  // The pack code expects the coordinates to be sorted
-  numIntegersToCompare = order;
-  qsort(coordinatesPtr, numCoordinates, coordSize, lexicographicalCmp);
-
-
-  // Move coords into separate arrays
-  std::vector<std::vector<int>> coordinates(order);
-  for (int i = 0; i < order; ++i) {
-    coordinates[i] = std::vector<int>(numCoordinates);
-  }
+  std::vector<std::vector<int>> coordinates;
   char* values = (char*) malloc(numCoordinates * csize);
-  for (size_t i = 0; i < numCoordinates; ++i) {
-    int* coordLoc = (int*)&coordinatesPtr[i * coordSize];
-    for (int d = 0; d < order; ++d) {
-      coordinates[d][i] = *coordLoc;
-      coordLoc++;
-    }
-    memcpy(&values[i * csize], coordLoc, csize);
-  }
-
+  sortCoordinates(content->coordinateBuffer->data(), numCoordinates,
+                  content->coordinateSize, csize, permutation, coordinates,
+                  values, taco_get_num_threads(),
+                  content->coordinateBufferSorted);
 
   content->coordinateBuffer->clear();
   content->coordinateBufferUsed = 0;
+  content->coordinateBufferSorted = true;
 
 
   std::vector<taco_mode_t> bufferModeTypes(order, taco_mode_sparse);
   taco_tensor_t* bufferStorage = init_taco_tensor_t(order, csize,
       (int32_t*)dimensions.data(), (int32_t*)permutation.data(),
       (taco_mode_t*)bufferModeTypes.data());
+  const bool widePositions = (getFormat().getPositionType(order - 1) == Int64);
+  taco_uassert(widePositions || numCoordinates <= INT_MAX) <<
+      "Tensors with more than INT_MAX components need Int64 position arrays";
   std::vector<int> pos = {0, (int)numCoordinates};
-  bufferStorage->indices[0][0] = (uint8_t*)pos.data();
+  std::vector<int64_t> widePos = {0, (int64_t)numCoordinates};
+  bufferStorage->indices[0][0] = widePositions ? (uint8_t*)widePos.data()
+                                               : (uint8_t*)pos.data();
   for (int i = 0; i < order; ++i) {
     bufferStorage->indices[i][1] = (uint8_t*)coordinates[i].data();
   }
   bufferStorage->vals = (uint8_t*)values;
 
+  initHashedLevels(*this, coordinates);
+
   // Pack nonzero components into required format
-  std::vector<void*> arguments = {content->storage, bufferStorage};
+  std::vector<void*> arguments = {content->storage, bufferStorage,
+                                  content->allocator};
   helperFuncs->callFuncPacked("pack", arguments.data());
   content->valuesSize = unpackTensorData(*((taco_tensor_t*)arguments[0]), *this);
+  resetStatistics();
 
   free(values);
   deinit_taco_tensor_t(bufferStorage);
 }
 
+template <typename T>
+static bool isZeroComponent(const char* value) {
+  return *(const T*)value == static_cast<T>(0);
+}
+
+static bool (*getZeroTest(Datatype type))(const char*) {
+  switch (type.getKind()) {
+    case Datatype::Bool: return isZeroComponent<bool>;
+    case Datatype::UInt8: return isZeroComponent<uint8_t>;
+    case Datatype::UInt16: return isZeroComponent<uint16_t>;
+    case Datatype::UInt32: return isZeroComponent<uint32_t>;
+    case Datatype::UInt64: return isZeroComponent<uint64_t>;
+    case Datatype::UInt128: return isZeroComponent<unsigned long long>;
+    case Datatype::Int8: return isZeroComponent<int8_t>;
+    case Datatype::Int16: return isZeroComponent<int16_t>;
+    case Datatype::Int32: return isZeroComponent<int32_t>;
+    case Datatype::Int64: return isZeroComponent<int64_t>;
+    case Datatype::Int128: return isZeroComponent<long long>;
+    case Datatype::Float32: return isZeroComponent<float>;
+    case Datatype::Float64: return isZeroComponent<double>;
+    case Datatype::Complex64: return isZeroComponent<std::complex<float>>;
+    case Datatype::Complex128: return isZeroComponent<std::complex<double>>;
+    default:
+      taco_ierror << "unsupported type";
+      return nullptr;
+  }
+}
+
+static bool isDenseCompressedMatrix(const Format& format) {
+  if (format.getOrder() != 2) {
+    return false;
+  }
+  const ModeFormat compressed = format.getModeFormats()[1];
+  return format.getModeFormats()[0] == Dense &&
+         compressed.getName() == Sparse.getName() &&
+         compressed.isOrdered() && compressed.isUnique() &&
+         format.getCoordinateTypePos(1) == type<int>() &&
+         format.getCoordinateTypeIdx(1) == type<int>();
+}
+
+TensorBase TensorBase::convertTo(std::string name,
+                                 const std::vector<int>& newModeOrdering,
+                                 const Format& format,
+                                 bool removeExplicitZeros) const {
+  TensorBase source = *this;
+  source.pack();
+
+  const int order = getOrder();
+  taco_uassert(newModeOrdering.size() == (size_t)order) <<
+      "The mode ordering must have one mode per tensor mode";
+  std::vector<int> newDimensions;
+  for (int mode : newModeOrdering) {
+    newDimensions.push_back(getDimension(mode));
+  }
+  TensorBase target(name, getComponentType(), newDimensions, format);
+
+  // The modes of this tensor that are stored in each level of the target
+  const Format& sourceFormat = getFormat();
+  std::vector<int> targetLevelModes;
+  for (int mode : format.getModeOrdering()) {
+    targetLevelModes.push_back(newModeOrdering[mode]);
+  }
+  const std::vector<int>& sourceLevelModes = sourceFormat.getModeOrdering();
+
+  // Matrices such as CSR whose levels are swapped by the conversion, such as
+  // to CSC, are transposed with a counting sort over their coordinates
+  const Index& index = source.getStorage().getIndex();
+  const Array& values = source.getStorage().getValues();
+  const size_t csize = getComponentType().getNumBytes();
+  if (!removeExplicitZeros && isDenseCompressedMatrix(sourceFormat) &&
+      isDenseCompressedMatrix(format) &&
+      targetLevelModes[0] == sourceLevelModes[1]) {
+    const int numRows = getDimension(sourceLevelModes[0]);
+    const int numColumns = getDimension(sourceLevelModes[1]);
+    const ModeIndex& modeIndex = index.getModeIndex(1);
+    const int* pos = (const int*)modeIndex.getIndexArray(0).getData();
+    const size_t size = pos[numRows];
+    int* newPos = (int*)malloc((numColumns + 1) * sizeof(int));
+    int* newCrd = (int*)malloc(std::max(size, (size_t)1) * sizeof(int));
+    char* newValues = (char*)malloc(std::max(size, (size_t)1) * csize);
+    transposeCompressed(numRows, numColumns, pos,
+                        (const int*)modeIndex.getIndexArray(1).getData(),
+                        (const char*)values.getData(), csize, newPos, newCrd,
+                        newValues, taco_get_num_threads());
+
+    auto storage = target.getStorage();
+    storage.setIndex(Index(format,
+        {ModeIndex({makeArray({numColumns})}),
+         ModeIndex({makeArray(newPos, numColumns + 1, Array::Free),
+                    makeArray(newCrd, size, Array::Free)})}));
+    storage.setValues(Array(getComponentType(), newValues, size, Array::Free));
+    target.setStorage(storage);
+    target.content->valuesSize = size;
+    return target;
+  }
+
+  // Otherwise the components are read straight out of the storage and packed
+  // in the target format. If the target stores the modes in the same order as
+  // this tensor they are already sorted.
+  std::vector<int> coordinates;
+  std::vector<size_t> positions;
+  extractComponents(index, getDimensions(), newModeOrdering, coordinates,
+                    positions);
+  bool sorted = (targetLevelModes == sourceLevelModes);
+  for (const ModeFormat& modeFormat : sourceFormat.getModeFormats()) {
+    sorted = sorted && modeFormat.isOrdered() && modeFormat.isUnique();
+  }
+
+  const char* valuesData = (const char*)values.getData();
+  std::vector<char> newValues(positions.size() * csize);
+  size_t numComponents = 0;
+  auto isZero = removeExplicitZeros ? getZeroTest(getComponentType()) : nullptr;
+  for (size_t i = 0; i < positions.size(); ++i) {
+    const char* value = &valuesData[positions[i] * csize];
+    if (isZero && isZero(value)) {
+      continue;
+    }
+    if (numComponents != i) {
+      std::copy(&coordinates[i * order], &coordinates[(i + 1) * order],
+                &coordinates[numComponents * order]);
+    }
+    memcpy(&newValues[numComponents * csize], value, csize);
+    numComponents++;
+  }
+  target.insertBatchUnchecked(coordinates.data(), newValues.data(),
+                              numComponents, sorted);
+  target.setNeedsPack(true);
+  target.pack();
+  return target;
+}
+
 void TensorBase::setStorage(TensorStorage storage) {
   // TODO(pnoyola): figure out all possible interactions between
   // setStorage and automatic compilation machinery.
   content->needsPack = false;
   content->storage = storage;
+  resetStatistics();
 }
 
 static inline map<TensorVar, TensorBase> getTensors(const IndexExpr& expr);
@@ -510,32 +858,129 @@ const Access TensorBase::operator()() const {
   return this->operator()(std::vector<IndexVar>());
 }
 
-TensorBase::KernelsCache TensorBase::computeKernels;
-std::mutex TensorBase::computeKernelsMutex;
-
-std::shared_ptr<Module> TensorBase::getComputeKernel(const IndexStmt stmt) {
-  computeKernelsMutex.lock();
+// The kernel caches are hash maps whose buckets are searched linearly for a
+// matching entry. Lookups take the mutexes in shared mode so that threads
+// that look up kernels concurrently do not serialize. Entries also record the
+// variant of the kernels (e.g. whether they assemble while computing), since
+// isomorphic statements may be compiled to incompatible kernels.
+typedef std::unordered_map<uint64_t,
+                           std::vector<std::tuple<IndexStmt, std::string,
+                                                  std::shared_ptr<Module>>>>
+        KernelsCache;
+static KernelsCache computeKernels;
+static std::shared_timed_mutex computeKernelsMutex;
+
+std::shared_ptr<Module> TensorBase::getComputeKernel(const IndexStmt stmt,
+                                                     const string& variant) {
+  const uint64_t hash = isomorphicHash(stmt);
+  std::shared_lock<std::shared_timed_mutex> lock(computeKernelsMutex);
+  const auto bucket = computeKernels.find(hash);
+  if (bucket == computeKernels.end()) {
+    return nullptr;
+  }
   const auto computeKernelsReverse =
-      util::ReverseConstIterable<TensorBase::KernelsCache>(computeKernels);
+      util::ReverseConstIterable<KernelsCache::mapped_type>(bucket->second);
   for (const auto& computeKernel : computeKernelsReverse) {
-    if (isomorphic(stmt, computeKernel.first)) {
-      const auto kernelModule = computeKernel.second;
-      computeKernelsMutex.unlock();
-      return kernelModule;
+    if (std::get<1>(computeKernel) == variant &&
+        isomorphic(stmt, std::get<0>(computeKernel))) {
+      return std::get<2>(computeKernel);
     }
   }
-  computeKernelsMutex.unlock();
   return nullptr;
 }
 
 void TensorBase::cacheComputeKernel(const IndexStmt stmt,
+                                    const string& variant,
                                     const std::shared_ptr<Module> kernel) {
-  computeKernelsMutex.lock();
-  computeKernels.emplace_back(stmt, kernel);
-  computeKernelsMutex.unlock();
+  const uint64_t hash = isomorphicHash(stmt);
+  std::unique_lock<std::shared_timed_mutex> lock(computeKernelsMutex);
+  computeKernels[hash].emplace_back(stmt, variant, kernel);
 }
 
 void TensorBase::compile() {
+  compileAsync().get();
+}
+
+void TensorBase::compile(taco::IndexStmt stmt, bool assembleWhileCompute) {
+  compileAsync(stmt, assembleWhileCompute).get();
+}
+
+std::shared_future<void> TensorBase::compileAsync() {
+  if (content->fuseProducers && needsCompile()) {
+    fuseProducers();
+  }
+  return compileAsync(makeCompileStmt(), content->assembleWhileCompute);
+}
+
+/// Returns the statistics of the operand's components.
+static OperandStatistics computeStatistics(const TensorBase& operand) {
+  OperandStatistics statistics;
+  const Format& format = operand.getFormat();
+  for (auto& modeFormat : format.getModeFormats()) {
+    if (modeFormat.getName() != Dense.getName() &&
+        modeFormat.getName() != Sparse.getName() &&
+        modeFormat.getName() != Singleton.getName()) {
+      return statistics;
+    }
+  }
+  const Index index = operand.getStorage().getIndex();
+  statistics.nnz = index.getSize();
+  if (format.getOrder() == 0) {
+    return statistics;
+  }
+
+  // The number of positions of the first level
+  const ModeIndex first = index.getModeIndex(0);
+  const size_t segments = (format.getModeFormats()[0].getName() == Dense.getName())
+      ? (size_t)first.getIndexArray(0).get(0).getAsIndex()
+      : (size_t)first.getIndexArray(0).get(1).getAsIndex();
+  if (segments == 0) {
+    return statistics;
+  }
+  statistics.meanSegmentLength = (double)statistics.nnz / segments;
+
+  // The segments of a compressed second level have different lengths, which
+  // its positions hold. Lengths are scaled from positions of the second level
+  // to components, which differ if the tensor has more than two levels.
+  if (format.getOrder() >= 2 &&
+      format.getModeFormats()[1].getName() == Sparse.getName()) {
+    const Array pos = index.getModeIndex(1).getIndexArray(0);
+    const size_t positions = pos.get(segments).getAsIndex();
+    if (positions == 0) {
+      return statistics;
+    }
+    const double componentsPerPosition = (double)statistics.nnz / positions;
+    double sumOfSquares = 0.0;
+    for (size_t segment = 0; segment < segments; segment++) {
+      const double length = componentsPerPosition *
+          (pos.get(segment + 1).getAsIndex() - pos.get(segment).getAsIndex());
+      const double deviation = length - statistics.meanSegmentLength;
+      sumOfSquares += deviation * deviation;
+    }
+    statistics.segmentLengthVariation =
+        std::sqrt(sumOfSquares / segments) / statistics.meanSegmentLength;
+  }
+  return statistics;
+}
+
+std::shared_ptr<const OperandStatistics> TensorBase::getStatistics() const {
+  // Computing the statistics reads every position of the second level, so 
+  // they are kept until the index changes
+  auto statistics = std::atomic_load(&content->statistics);
+  if (!statistics) {
+    statistics = std::make_shared<const OperandStatistics>(
+        computeStatistics(*this));
+    std::atomic_store(&content->statistics, statistics);
+  }
+  return statistics;
+}
+
+void TensorBase::resetStatistics() {
+  std::atomic_store(&content->statistics,
+                    std::shared_ptr<const OperandStatistics>());
+}
+
+IndexStmt TensorBase::makeCompileStmt() const {
   Assignment assignment = getAssignment();
   taco_uassert(assignment.defined())
       << error::compile_without_expr;
@@ -570,12 +1015,23 @@ void TensorBase::compile() {
   IndexStmt stmt = makeConcreteNotation(makeReductionNotation(assignment));
   stmt = reorderLoopsTopologically(stmt);
   stmt = insertTemporaries(stmt);
-  stmt = parallelizeOuterLoop(stmt);
-  compile(stmt, content->assembleWhileCompute);
+
+  // Schedule the statement from the statistics of the operands, which are
+  // packed or computed first since their statistics depend on their values
+  map<TensorVar,OperandStatistics> statistics;
+  for (auto& operand : getTensors(assignment.getRhs())) {
+    TensorBase tensor = operand.second;
+    tensor.syncValues();
+    statistics.insert({operand.first, *tensor.getStatistics()});
+  }
+  stmt = autoschedule(stmt, statistics, content->atomicSchedules);
+  return stmt;
 }
-void TensorBase::compile(taco::IndexStmt stmt, bool assembleWhileCompute) {
+
+std::shared_future<void> TensorBase::compileAsync(taco::IndexStmt stmt,
+                                                  bool assembleWhileCompute) {
   if (!needsCompile()) {
-    return;
+    return content->module->getCompileFuture();
   }
   setNeedsCompile(false);
 
@@ -583,23 +1039,50 @@ void TensorBase::compile(taco::IndexStmt stmt, bool assembleWhileCompute) {
   IndexStmt stmtToCompile = stmt.concretize();
   stmtToCompile = scalarPromote(stmtToCompile);
 
+  const string variant = util::toString(assembleWhileCompute) + " " 
+                        + util::toString(content->symbolicAssembly);
   if (!std::getenv("CACHE_KERNELS") ||
       std::string(std::getenv("CACHE_KERNELS")) != "0") {
     concretizedAssign = stmtToCompile;
-    const auto cachedKernel = getComputeKernel(concretizedAssign);
+    const auto cachedKernel = getComputeKernel(concretizedAssign, variant);
     if (cachedKernel) {
       content->module = cachedKernel;
-      return;
+      return content->module->getCompileFuture();
     }
   }
 
-  content->assembleFunc = lower(stmtToCompile, "assemble", true, false);
-  content->computeFunc = lower(stmtToCompile, "compute",  assembleWhileCompute, true);
-  content->module->reset();
+  const auto bundledKernel = getBundledKernel(stmtToCompile,
+                                              assembleWhileCompute,
+                                              content->symbolicAssembly);
+  if (bundledKernel) {
+    content->module = bundledKernel;
+    return content->module->getCompileFuture();
+  }
+
+  const string diskCacheKey = "compute " + variant + " " 
+                             + util::toString(isomorphicHash(stmtToCompile));
+  // The previous module may be shared through the kernel caches or a kernel
+  // bundle, so it must not be reset.
+  content->module = make_shared<Module>(content->module->getTarget());
+  if (content->module->loadFromDiskCache(diskCacheKey)) {
+    cacheComputeKernel(concretizedAssign, variant, content->module);
+    return content->module->getCompileFuture();
+  }
+
+  Lowerer assembleLowerer, computeLowerer;
+  assembleLowerer.getLowererImpl()->setSymbolicAssembly(content->symbolicAssembly);
+  computeLowerer.getLowererImpl()->setSymbolicAssembly(content->symbolicAssembly);
+  content->assembleFunc = lower(stmtToCompile, "assemble", true, false, false,
+                                false, assembleLowerer);
+  content->computeFunc = lower(stmtToCompile, "compute",  assembleWhileCompute,
+                               true, false, false, computeLowerer);
   content->module->addFunction(content->assembleFunc);
   content->module->addFunction(content->computeFunc);
-  content->module->compile();
-  cacheComputeKernel(concretizedAssign, content->module);
+  // Kernels are cached while they are compiling. Tensors that get a cached
+  // kernel wait for the compilation when they first call it.
+  auto compiled = content->module->compileAsync(diskCacheKey);
+  cacheComputeKernel(concretizedAssign, variant, content->module);
+  return compiled;
 }
 
 taco_tensor_t* TensorBase::getTacoTensorT() {
@@ -648,7 +1131,10 @@ vector<TensorBase> TensorBase::getDependentTensors() {
   for(std::weak_ptr<Content> dependentContent : content->dependentTensors) {
     TensorBase current;
     current.content = dependentContent.lock();
-    dependents.push_back(current);
+    // Tensors that were destroyed before they were computed need no syncing
+    if (current.content) {
+      dependents.push_back(current);
+    }
   }
   return dependents;
 }
@@ -690,6 +1176,145 @@ static inline map<TensorVar, TensorBase> getTensors(const IndexExpr& expr) {
   return getOperands.arguments;
 }
 
+/// Rewrites the index variables of accesses and reductions, keeping the
+/// tensors that the accesses refer to.
+struct ReplaceTensorIndexVars : public IndexNotationRewriter {
+  using IndexNotationRewriter::visit;
+
+  ReplaceTensorIndexVars(const map<IndexVar,IndexVar>& substitutions)
+      : substitutions(substitutions) {}
+
+  const map<IndexVar,IndexVar>& substitutions;
+
+  IndexVar substitute(const IndexVar& var) const {
+    return util::contains(substitutions, var) ? substitutions.at(var) : var;
+  }
+
+  void visit(const AccessNode* op) {
+    vector<IndexVar> indexVars;
+    for (auto& var : op->indexVars) {
+      indexVars.push_back(substitute(var));
+    }
+    expr = isa<AccessTensorNode>(op)
+           ? Access(new AccessTensorNode(to<AccessTensorNode>(op)->tensor,
+                                         indexVars))
+           : Access(op->tensorVar, indexVars);
+  }
+
+  void visit(const ReductionNode* op) {
+    expr = new ReductionNode(op->op, substitute(op->var), rewrite(op->a));
+  }
+};
+
+/// Returns the expression of `producer` with its free variables renamed to
+/// the variables of `access` and its reduction variables renamed to fresh
+/// variables, or an undefined expression if the producer can't be inlined.
+static IndexExpr inlineProducer(const TensorBase& producer,
+                                const AccessTensorNode* access) {
+  Assignment assignment = producer.getAssignment();
+  if (!assignment.defined() || assignment.getOperator().defined() ||
+      assignment.getRhs().getDataType() != producer.getComponentType()) {
+    return IndexExpr();
+  }
+
+  map<IndexVar,IndexVar> substitutions;
+  const vector<IndexVar>& freeVars = assignment.getLhs().getIndexVars();
+  for (size_t i = 0; i < freeVars.size(); ++i) {
+    if (util::contains(substitutions, freeVars[i])) {
+      return IndexExpr();
+    }
+    substitutions.insert({freeVars[i], access->indexVars[i]});
+  }
+  for (auto& var : getIndexVars(assignment.getRhs())) {
+    if (!util::contains(substitutions, var)) {
+      substitutions.insert({var, IndexVar()});
+    }
+  }
+  return ReplaceTensorIndexVars(substitutions).rewrite(assignment.getRhs());
+}
+
+void TensorBase::fuseProducers() {
+  Assignment assignment = getAssignment();
+  taco_iassert(assignment.defined());
+
+  // Producers that have been inlined into this tensor's expression. They may
+  // still list this tensor as a dependent through their own operands.
+  set<TensorBase> fused;
+  bool changed = true;
+  while (changed) {
+    changed = false;
+    IndexExpr rhs = assignment.getRhs();
+
+    vector<const AccessTensorNode*> accesses;
+    map<TensorBase,int> numAccesses;
+    match(rhs,
+      function<void(const AccessNode*)>([&](const AccessNode* op) {
+        if (isa<AccessTensorNode>(op)) {
+          accesses.push_back(to<AccessTensorNode>(op));
+          numAccesses[to<AccessTensorNode>(op)->tensor]++;
+        }
+      })
+    );
+
+    // Inlining a reduction into loops the producer does not have would
+    // recompute it in each of their iterations.
+    vector<IndexVar> loopVars = getIndexVars(rhs);
+    util::append(loopVars, assignment.getLhs().getIndexVars());
+
+    for (const AccessTensorNode* access : accesses) {
+      TensorBase producer = access->tensor;
+      if (producer == *this || numAccesses.at(producer) != 1 ||
+          !producer.needsCompute() || producer.needsPack()) {
+        continue;
+      }
+
+      bool onlyConsumer = true;
+      for (auto& consumer : producer.getDependentTensors()) {
+        if (consumer.content != nullptr && consumer != *this &&
+            !util::contains(fused, consumer)) {
+          onlyConsumer = false;
+        }
+      }
+      auto producerOperands = getTensors(producer.getAssignment().getRhs());
+      if (!onlyConsumer || util::contains(producerOperands, getTensorVar())) {
+        continue;
+      }
+
+      IndexExpr inlined = inlineProducer(producer, access);
+      if (!inlined.defined()) {
+        continue;
+      }
+      bool hasReductions = false;
+      match(inlined,
+        function<void(const ReductionNode*)>([&](const ReductionNode* op) {
+          hasReductions = true;
+        })
+      );
+      if (hasReductions) {
+        set<IndexVar> accessVars(access->indexVars.begin(),
+                                 access->indexVars.end());
+        if (!util::all(loopVars, [&](const IndexVar& var) {
+              return util::contains(accessVars, var);
+            })) {
+          continue;
+        }
+      }
+
+      rhs = replace(rhs, {{IndexExpr(access), inlined}});
+      assignment = Assignment(assignment.getLhs(), rhs,
+                              assignment.getOperator());
+      for (auto& operand : producerOperands) {
+        operand.second.addDependentTensor(*this);
+      }
+      producer.removeDependentTensor(*this);
+      fused.insert(producer);
+      changed = true;
+      break;
+    }
+  }
+  setAssignment(assignment);
+}
+
 static inline
 vector<void*> packArguments(const TensorBase& tensor) {
   vector<void*> arguments;
@@ -706,6 +1331,9 @@ vector<void*> packArguments(const TensorBase& tensor) {
     arguments.push_back(tensors.at(operand).getStorage());
   }
 
+  // Pack the allocator that the kernel allocates the result with
+  arguments.push_back(tensor.getAllocator());
+
   return arguments;
 }
 
@@ -720,13 +1348,23 @@ void TensorBase::assemble() {
     operand.second.syncValues();
   }
 
-  auto arguments = packArguments(*this);
-  content->module->callFuncPacked("assemble", arguments.data());
+  initHashedResult(*this, getInitialHashCapacities());
+  while (true) {
+    auto arguments = packArguments(*this);
+    content->module->callFuncPacked("assemble", arguments.data());
+    if (content->assembleWhileCompute) {
+      break;
+    }
 
-  if (!content->assembleWhileCompute) {
     setNeedsAssemble(false);
     taco_tensor_t* tensorData = ((taco_tensor_t*)arguments[0]);
     content->valuesSize = unpackTensorData(*tensorData, *this);
+    resetStatistics();
+
+    // Assemble again if a segment of a hashed level filled up
+    if (!growFullHashedLevels(*this)) {
+      break;
+    }
   }
 }
 
@@ -743,18 +1381,60 @@ void TensorBase::compute() {
     operand.second.removeDependentTensor(*this);
   }
 
-  auto arguments = packArguments(*this);
-  this->content->module->callFuncPacked("compute", arguments.data());
-
   if (content->assembleWhileCompute) {
+    initHashedResult(*this, getInitialHashCapacities());
+  }
+  while (true) {
+    auto arguments = packArguments(*this);
+    this->content->module->callFuncPacked("compute", arguments.data());
+    if (!content->assembleWhileCompute) {
+      break;
+    }
+
     setNeedsAssemble(false);
     taco_tensor_t* tensorData = ((taco_tensor_t*)arguments[0]);
     content->valuesSize = unpackTensorData(*tensorData, *this);
+    resetStatistics();
+
+    // Compute again if a segment of a hashed level filled up
+    if (!growFullHashedLevels(*this)) {
+      break;
+    }
+  }
+}
+
+vector<int> TensorBase::getInitialHashCapacities() const {
+  vector<int> capacities(getOrder(), content->hashCapacity);
+  if (content->hashCapacity > 0 ||
+      !util::contains(getFormat().getModeFormats(), Hashed)) {
+    return capacities;
+  }
+
+  // Segments of the first level start with room for twice the components of
+  // the largest operand, and segments of other levels with room for twice the
+  // components of the longest rows of the operands on average. Segments that
+  // fill up are grown when the result is assembled.
+  size_t maxNnz = 0;
+  double maxSegmentLength = 0.0;
+  for (auto& operand : getTensors(getAssignment().getRhs())) {
+    auto statistics = operand.second.getStatistics();
+    maxNnz = std::max(maxNnz, statistics->nnz);
+    maxSegmentLength = std::max(maxSegmentLength,
+                                statistics->meanSegmentLength);
   }
+  const size_t maxCapacity = 1 << 30;
+  for (int i = 0; i < getOrder(); ++i) {
+    const size_t components = (i == 0) ? maxNnz
+                                       : (size_t)std::ceil(maxSegmentLength);
+    capacities[i] = (int)std::min(std::max(2 * components, minHashCapacity),
+                                  maxCapacity);
+  }
+  return capacities;
 }
 
 void TensorBase::evaluate() {
-  this->compile();
+  // Operands are computed while the kernels compile
+  this->compileAsync();
   if (!getAssignment().getOperator().defined()) {
     this->assemble();
   }
@@ -828,31 +1508,64 @@ void TensorBase::compileSource(std::string source) {
     ss << endl;
     CodeGen_C::generateShim(content->computeFunc, ss);
   }
+  content->module = make_shared<Module>(content->module->getTarget());
   content->module->setSource(source + "\n" + ss.str());
   content->module->compile();
 }
 
-TensorBase::HelperFuncsCache TensorBase::helperFunctions;
-std::mutex TensorBase::helperFunctionsMutex;
+typedef std::unordered_map<uint64_t,
+                           std::vector<std::tuple<Format,
+                                                  Datatype,
+                                                  std::vector<int>,
+                                                  std::shared_ptr<Module>>>>
+        HelperFuncsCache;
+static HelperFuncsCache helperFunctions;
+static std::shared_timed_mutex helperFunctionsMutex;
+
+/// Hash the arguments of getHelperFunctions consistently with how cached
+/// helper functions are matched (i.e. by Format, Datatype and dimensions).
+static uint64_t hashHelperFunctionsKey(const Format& format, Datatype ctype,
+                                       const std::vector<int>& dimensions) {
+  std::hash<std::string> hashString;
+  std::hash<int> hashInt;
+  uint64_t hash = (uint64_t)ctype.getKind();
+  auto combine = [&hash](uint64_t value) {
+    hash ^= value + 0x9e3779b97f4a7c15ull + (hash << 6) + (hash >> 2);
+  };
+  for (int dimension : dimensions) {
+    combine(hashInt(dimension));
+  }
+  for (int mode : format.getModeOrdering()) {
+    combine(hashInt(mode));
+  }
+  for (const ModeFormat& modeFormat : format.getModeFormats()) {
+    combine(hashString(modeFormat.getName()));
+  }
+  return hash;
+}
 
 std::shared_ptr<ir::Module>
 TensorBase::getHelperFunctions(const Format& format, Datatype ctype,
                                const std::vector<int>& dimensions) {
-  helperFunctionsMutex.lock();
-  const auto helperFunctionsReverse =
-      util::ReverseConstIterable<TensorBase::HelperFuncsCache>(helperFunctions);
-  for (const auto& helperFuncs : helperFunctionsReverse) {
-    if (std::get<0>(helperFuncs) == format &&
-        std::get<1>(helperFuncs) == ctype &&
-        std::get<2>(helperFuncs) == dimensions) {
-      // If helper functions had already been generated for specified tensor
-      // format and type, then use cached version.
-      const auto helperFuncsModule = std::get<3>(helperFuncs);
-      helperFunctionsMutex.unlock();
-      return helperFuncsModule;
+  const uint64_t hash = hashHelperFunctionsKey(format, ctype, dimensions);
+  {
+    std::shared_lock<std::shared_timed_mutex> lock(helperFunctionsMutex);
+    const auto bucket = helperFunctions.find(hash);
+    if (bucket != helperFunctions.end()) {
+      const auto helperFunctionsReverse =
+          util::ReverseConstIterable<HelperFuncsCache::mapped_type>(
+              bucket->second);
+      for (const auto& helperFuncs : helperFunctionsReverse) {
+        if (std::get<0>(helperFuncs) == format &&
+            std::get<1>(helperFuncs) == ctype &&
+            std::get<2>(helperFuncs) == dimensions) {
+          // If helper functions had already been generated for specified
+          // tensor format and type, then use cached version.
+          return std::get<3>(helperFuncs);
+        }
+      }
     }
   }
-  helperFunctionsMutex.unlock();
 
   std::shared_ptr<Module> helperModule = std::make_shared<Module>();
 
@@ -861,47 +1574,57 @@ TensorBase::getHelperFunctions(const Format& format, Datatype ctype,
   };
   const auto dims = util::map(dimensions, getDim);
 
+  IndexStmt packStmt;
+  IndexStmt iterateStmt;
   if (format.getOrder() > 0) {
-    const Format bufferFormat = COO(format.getOrder(), false, true, false,
-                                    format.getModeOrdering());
+    Format bufferFormat = COO(format.getOrder(), false, true, false,
+                              format.getModeOrdering());
+    // The buffer positions are as wide as the positions of the packed tensor
+    std::vector<std::vector<Datatype>> bufferArrayTypes(format.getOrder(),
+                                                        {Int32, Int32});
+    bufferArrayTypes[0][0] = format.getPositionType(format.getOrder() - 1);
+    bufferFormat.setLevelArrayTypes(bufferArrayTypes);
     TensorVar bufferTensor(Type(ctype, Shape(dims)), bufferFormat);
     TensorVar packedTensor(Type(ctype, Shape(dims)), format);
 
     // Define packing and iterator routines in index notation.
     std::vector<IndexVar> indexVars(format.getOrder());
-    IndexStmt packStmt = (packedTensor(indexVars) = bufferTensor(indexVars));
-    IndexStmt iterateStmt = Yield(indexVars, packedTensor(indexVars));
+    packStmt = (packedTensor(indexVars) = bufferTensor(indexVars));
+    iterateStmt = Yield(indexVars, packedTensor(indexVars));
     for (int i = format.getOrder() - 1; i >= 0; --i) {
       int mode = format.getModeOrdering()[i];
       packStmt = forall(indexVars[mode], packStmt);
       iterateStmt = forall(indexVars[mode], iterateStmt);
     }
-
-    // Lower packing and iterator code.
-    helperModule->addFunction(lower(packStmt, "pack", true, true));
-    helperModule->addFunction(lower(iterateStmt, "iterate", false, true));
   } else {
     const Format bufferFormat = COO(1, false, true, false);
     TensorVar bufferVector(Type(ctype, Shape({1})), bufferFormat);
     TensorVar packedScalar(Type(ctype, dims), format);
 
-    // Define and lower packing routine.
+    // Define packing routine.
     // TODO: Redefine as reduction into packed scalar once reduction bug
     //       has been fixed in new lowering machinery.
     IndexVar indexVar;
     IndexStmt assignment = (packedScalar() = bufferVector(indexVar));
-    IndexStmt packStmt= makeConcreteNotation(makeReductionNotation(assignment));
-    helperModule->addFunction(lower(packStmt, "pack", true, true));
+    packStmt = makeConcreteNotation(makeReductionNotation(assignment));
 
-    // Define and lower iterator code.
-    IndexStmt iterateStmt = Yield({}, packedScalar());
+    // Define iterator routine.
+    iterateStmt = Yield({}, packedScalar());
+  }
+
+  // Lower packing and iterator code, unless a library with the same routines
+  // has already been compiled into the on-disk kernel cache.
+  const string diskCacheKey = "helpers " +
+                              util::toString(isomorphicHash(packStmt)) + " " +
+                              util::toString(isomorphicHash(iterateStmt));
+  if (!helperModule->loadFromDiskCache(diskCacheKey)) {
+    helperModule->addFunction(lower(packStmt, "pack", true, true));
     helperModule->addFunction(lower(iterateStmt, "iterate", false, true));
+    helperModule->compile(diskCacheKey);
   }
-  helperModule->compile();
 
-  helperFunctionsMutex.lock();
-  helperFunctions.emplace_back(format, ctype, dimensions, helperModule);
-  helperFunctionsMutex.unlock();
+  std::unique_lock<std::shared_timed_mutex> lock(helperFunctionsMutex);
+  helperFunctions[hash].emplace_back(format, ctype, dimensions, helperModule);
 
   return helperModule;
 }
@@ -940,8 +1663,46 @@ bool scalarEquals(std::complex<T> a, std::complex<T> b) {
   return true;
 }
 
+static bool hasUnorderedLevels(const Format& format) {
+  for (auto& modeFormat : format.getModeFormats()) {
+    if (!modeFormat.isOrdered()) {
+      return true;
+    }
+  }
+  return false;
+}
+
+template<typename T>
+static map<vector<int>,T> getNonzeroComponents(const TensorBase& tensor) {
+  map<vector<int>,T> components;
+  for (auto& component : iterate<T>(tensor)) {
+    if (!isZero(component.second)) {
+      components.insert({component.first.toVector(), component.second});
+    }
+  }
+  return components;
+}
+
 template<typename T>
 bool equalsTyped(const TensorBase& a, const TensorBase& b) {
+  // Unordered levels (e.g. hashed) are iterated out of coordinate order, so
+  // compare the sorted nonzero components
+  if (hasUnorderedLevels(a.getFormat()) || hasUnorderedLevels(b.getFormat())) {
+    const auto acomponents = getNonzeroComponents<T>(a);
+    const auto bcomponents = getNonzeroComponents<T>(b);
+    if (acomponents.size() != bcomponents.size()) {
+      return false;
+    }
+    for (auto& acomponent : acomponents) {
+      auto bcomponent = bcomponents.find(acomponent.first);
+      if (bcomponent == bcomponents.end() ||
+          !scalarEquals(acomponent.second, bcomponent->second)) {
+        return false;
+      }
+    }
+    return true;
+  }
+
   auto at = iterate<T>(a);
   auto bt = iterate<T>(b);
   auto ait = at.begin();
@@ -1151,6 +1912,9 @@ TensorBase dispatchRead(T& file, FileType filetype, U format, bool pack) {
     case FileType::rb:
       tensor = readRB(file, format, pack);
       break;
+    case FileType::ttb:
+      tensor = readTTB(file, format, pack);
+      break;
   }
   return tensor;
 }
@@ -1172,6 +1936,9 @@ TensorBase dispatchRead(std::string filename, U format, bool pack) {
   else if (extension == "rb") {
     tensor = dispatchRead(filename, FileType::rb, format, pack);
   }
+  else if (extension == "ttb") {
+    tensor = dispatchRead(filename, FileType::ttb, format, pack);
+  }
   else {
     taco_uerror << "File extension not recognized: " << filename << std::endl;
   }
@@ -1223,6 +1990,9 @@ void dispatchWrite(T& file, const TensorBase& tensor, FileType filetype) {
     case FileType::rb:
       writeRB(file, tensor);
       break;
+    case FileType::ttb:
+      writeTTB(file, tensor);
+      break;
   }
 }
 
@@ -1243,6 +2013,9 @@ void write(string filename, const TensorBase& tensor) {
   else if (extension == "rb") {
     dispatchWrite(filename, tensor, FileType::rb);
   }
+  else if (extension == "ttb") {
+    dispatchWrite(filename, tensor, FileType::ttb);
+  }
   else {
     taco_uerror << "File extension not recognized: " << filename << std::endl;
   }
@@ -1266,6 +2039,18 @@ void packOperands(const TensorBase& tensor) {
   }
 }
 
+vector<TensorBase> getOperands(const TensorBase& tensor) {
+  auto operands = getArguments(makeConcreteNotation(tensor.getAssignment()));
+
+  auto tensors = getTensors(tensor.getAssignment().getRhs());
+  vector<TensorBase> result;
+  for (auto& operand : operands) {
+    taco_iassert(util::contains(tensors, operand)) << operand.getName();
+    result.push_back(tensors.at(operand));
+  }
+  return result;
+}
+
 static ParallelSchedule taco_parallel_sched = ParallelSchedule::Static;
 static int taco_chunk_size = 0;
 static int taco_num_threads = 1;
@@ -5,6 +5,10 @@
 #include <iostream>
 #include <fstream>
 #include <cstdlib>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
 using namespace std;
 
@@ -24,4 +28,46 @@ void openStream(std::fstream& stream, std::string path, fstream::openmode mode)
   taco_uassert(stream.is_open()) << "Error opening file: " << path;
 }
 
+MappedFile::MappedFile(std::string path, bool copyOnWrite)
+    : mapping(nullptr), mappingSize(0) {
+  int fd = open(sanitizePath(path).c_str(), O_RDONLY);
+  taco_uassert(fd != -1) << "Error opening file: " << path;
+
+  // Failed assertions throw in Python builds, so the file is closed on every
+  // path out of the constructor
+  struct FileCloser {
+    int fd;
+    ~FileCloser() { close(fd); }
+  } closer = {fd};
+
+  struct stat fileStat;
+  taco_uassert(fstat(fd, &fileStat) == 0) << "Error reading file: " << path;
+  mappingSize = fileStat.st_size;
+
+  // Empty files cannot be mapped
+  if (mappingSize > 0) {
+    const int protection = copyOnWrite ? (PROT_READ | PROT_WRITE) : PROT_READ;
+    mapping = mmap(nullptr, mappingSize, protection, MAP_PRIVATE, fd, 0);
+    if (mapping == MAP_FAILED) {
+      mapping = nullptr;
+    }
+    taco_uassert(mapping != nullptr) << "Error mapping file: " << path;
+    madvise(mapping, mappingSize, MADV_SEQUENTIAL);
+  }
+}
+
+MappedFile::~MappedFile() {
+  if (mapping != nullptr) {
+    munmap(mapping, mappingSize);
+  }
+}
+
+const char* MappedFile::data() const {
+  return (const char*)mapping;
+}
+
+size_t MappedFile::size() const {
+  return mappingSize;
+}
+
 }}
@@ -76,7 +76,8 @@ void ASSERT_COMPONENTS_EQUALS(vector<vector<vector<int>>> expectedIndices,
       auto size = modeIndex.getIndexArray(0);
       ASSERT_ARRAY_EQ(expectedIndices[i][0],
                       {(int*)size.getData(), size.getSize()});
-    } else if (modeType == ModeFormat::Sparse) {
+    } else if (modeType == ModeFormat::Sparse ||
+               modeType == ModeFormat::Hashed) {
       taco_iassert(expectedIndices[i].size() == 2);
       ASSERT_EQ(2, modeIndex.numIndexArrays());
       auto pos = modeIndex.getIndexArray(0);
@@ -85,6 +86,16 @@ void ASSERT_COMPONENTS_EQUALS(vector<vector<vector<int>>> expectedIndices,
                       {(int*)pos.getData(), pos.getSize()});
       ASSERT_ARRAY_EQ(expectedIndices[i][1],
                       {(int*)idx.getData(), idx.getSize()});
+    } else if (modeType == ModeFormat::Bitmap) {
+      taco_iassert(expectedIndices[i].size() == 2);
+      ASSERT_EQ(2, modeIndex.numIndexArrays());
+      auto size = modeIndex.getIndexArray(0);
+      auto bits = modeIndex.getIndexArray(1);
+      ASSERT_ARRAY_EQ(expectedIndices[i][0],
+                      {(int*)size.getData(), size.getSize()});
+      const uint8_t* bitsData = (const uint8_t*)bits.getData();
+      ASSERT_VECTOR_EQ(expectedIndices[i][1],
+                       vector<int>(bitsData, bitsData + bits.getSize()));
     }
   }
 
@@ -0,0 +1,144 @@
+#include "test.h"
+#include "taco/tensor.h"
+#include "taco/autotuner.h"
+#include "taco/util/strings.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <unistd.h>
+
+using namespace taco;
+
+static const IndexVar i("i"), j("j");
+
+static Tensor<double> getMatrix(std::string name) {
+  // Rows have very different lengths
+  Tensor<double> A(name, {40, 30}, CSR);
+  for (int row = 0; row < 40; row++) {
+    for (int col = 0; col < 30; col += 1 + row % 7) {
+      A.insert({row, col}, (double)(row + 2 * col + 1));
+    }
+  }
+  A.pack();
+  return A;
+}
+
+static Tensor<double> getVector(std::string name, int size) {
+  Tensor<double> x(name, {size}, Format({Dense}));
+  for (int k = 0; k < size; k++) {
+    x.insert({k}, (double)(k % 5) - 1.5);
+  }
+  x.pack();
+  return x;
+}
+
+static AutotuneOptions getTestOptions(std::string databasePath) {
+  AutotuneOptions options;
+  options.timeBudget = 0.1;
+  options.repetitions = 1;
+  options.chunkSizes = {16};
+  options.unrollFactors = {4};
+  options.databasePath = databasePath;
+  return options;
+}
+
+TEST(autotuner, parse_schedule) {
+  TuningSchedule schedule;
+  schedule.loopOrder = {1, 0};
+  schedule.chunkSize = 16;
+  schedule.parallel = true;
+  schedule.outputRaceStrategy = OutputRaceStrategy::Atomics;
+  schedule.unrollFactor = 8;
+  ASSERT_EQ(schedule, parseTuningSchedule(util::toString(schedule)));
+  ASSERT_EQ(TuningSchedule(),
+            parseTuningSchedule(util::toString(TuningSchedule())));
+}
+
+TEST(autotuner, apply_schedule_illegal) {
+  Tensor<double> A = getMatrix("A");
+  Tensor<double> x = getVector("x", 30);
+  Tensor<double> y("y", {40}, Format({Dense}));
+  y(i) = A(i,j) * x(j);
+  IndexStmt stmt = makeConcreteNotation(y.getAssignment());
+
+  TuningSchedule schedule;
+  schedule.loopOrder = {0, 0};
+  std::string reason;
+  ASSERT_FALSE(applySchedule(stmt, schedule, &reason).defined());
+  ASSERT_FALSE(reason.empty());
+
+  // Parallel threads write to the same components of the result
+  Tensor<double> z("z", {30}, Format({Dense}));
+  z(j) = A(i,j) * y(i);
+  schedule = TuningSchedule();
+  schedule.loopOrder = {1, 0};
+  schedule.parallel = true;
+  reason = "";
+  ASSERT_FALSE(applySchedule(makeConcreteNotation(z.getAssignment()),
+                             schedule, &reason).defined());
+  ASSERT_FALSE(reason.empty());
+}
+
+TEST(autotuner, spmv) {
+  char pathTemplate[] = "/tmp/taco_autotune_test_XXXXXX";
+  const int fd = mkstemp(pathTemplate);
+  ASSERT_NE(-1, fd);
+  close(fd);
+  const std::string databasePath = pathTemplate;
+
+  Tensor<double> A = getMatrix("A");
+  Tensor<double> x = getVector("x", 30);
+  Tensor<double> expected("expected", {40}, Format({Dense}));
+  expected(i) = A(i,j) * x(j);
+  expected.evaluate();
+
+  Tensor<double> y("y", {40}, Format({Dense}));
+  y(i) = A(i,j) * x(j);
+  ASSERT_TRUE(autotune(y, getTestOptions(databasePath)).defined());
+  y.assemble();
+  y.compute();
+  ASSERT_TENSOR_EQ(expected, y);
+
+  // The best schedule is stored under one key
+  std::string line;
+  {
+    std::ifstream database(databasePath);
+    ASSERT_TRUE((bool)std::getline(database, line));
+    std::string next;
+    ASSERT_FALSE((bool)std::getline(database, next));
+  }
+  const std::string key = line.substr(0, line.find('\t'));
+
+  // Later calls apply the stored schedule without searching
+  {
+    std::ofstream database(databasePath);
+    database << key << "\torder= chunk=8 parallel=1 races=NoRaces unroll=2\n";
+  }
+  Tensor<double> y2("y", {40}, Format({Dense}));
+  y2(i) = A(i,j) * x(j);
+  IndexStmt stmt = autotune(y2, getTestOptions(databasePath));
+  ASSERT_NE(std::string::npos,
+            util::toString(stmt).find("split(i, i0, i1, 8)"));
+  y2.assemble();
+  y2.compute();
+  ASSERT_TENSOR_EQ(expected, y2);
+
+  ASSERT_EQ(0, remove(databasePath.c_str()));
+}
+
+TEST(autotuner, transposed_spmv) {
+  // Parallelizing the rows needs atomics
+  Tensor<double> A = getMatrix("A");
+  Tensor<double> x = getVector("x", 40);
+  Tensor<double> expected("expected", {30}, Format({Dense}));
+  expected(j) = A(i,j) * x(i);
+  expected.evaluate();
+
+  Tensor<double> y("y", {30}, Format({Dense}));
+  y(j) = A(i,j) * x(i);
+  ASSERT_TRUE(autotune(y, getTestOptions("")).defined());
+  y.assemble();
+  y.compute();
+  ASSERT_TENSOR_EQ(expected, y);
+}
@@ -61,6 +61,33 @@ INSTANTIATE_TEST_CASE_P(tensor3, format, Combine(
         packageInputs(d233b_data())
     ), ValuesIn(modeTypes3), ValuesIn(modeOrderings3)));
 
+INSTANTIATE_TEST_CASE_P(hashed_vector, format, Combine(
+    Values(
+        packageInputs(d1a_data()),
+        packageInputs(d5a_data()),
+        packageInputs(d5c_data())
+    ), Values(std::vector<ModeFormatPack>({Hashed}),
+              std::vector<ModeFormatPack>({Bitmap})),
+    ValuesIn(modeOrderings1)));
+
+INSTANTIATE_TEST_CASE_P(hashed_matrix, format, Combine(
+    Values(
+        packageInputs(d33a_data()),
+        packageInputs(d33b_data())
+    ), Values(std::vector<ModeFormatPack>({Dense, Hashed}),
+              std::vector<ModeFormatPack>({Hashed, Hashed}),
+              std::vector<ModeFormatPack>({Dense, Bitmap}),
+              std::vector<ModeFormatPack>({Bitmap, Hashed})),
+    ValuesIn(modeOrderings2)));
+
+INSTANTIATE_TEST_CASE_P(hashed_tensor3, format, Combine(
+    Values(
+        packageInputs(d233a_data()),
+        packageInputs(d233b_data())
+    ), Values(std::vector<ModeFormatPack>({Dense, Hashed, Hashed}),
+              std::vector<ModeFormatPack>({Dense, Dense, Bitmap})),
+    ValuesIn(modeOrderings3)));
+
 TEST(format, sparse) {
   Tensor<double> A = d33a("A", Sparse);
   A.pack();
@@ -72,3 +99,177 @@ TEST(format, dense) {
   A.pack();
   ASSERT_COMPONENTS_EQUALS({{{3}}, {{3}}}, {0,2,0, 0,0,0, 3,0,4}, A);
 }
+
+TEST(format, hashed) {
+  // Segments have hash tables of twice as many slots as their largest size
+  Tensor<double> A = d33a("A", Format({Dense, Hashed}));
+  A.pack();
+  ASSERT_COMPONENTS_EQUALS({{{3}}, {{4}, {-1,-1,1,-1, -1,-1,-1,-1, 0,2,-1,-1}}},
+                           {0,0,2,0, 0,0,0,0, 3,4,0,0}, A);
+}
+
+TEST(format, bitmap) {
+  Tensor<double> A = d33a("A", Format({Dense, Bitmap}));
+  A.pack();
+  ASSERT_COMPONENTS_EQUALS({{{3}}, {{3}, {0,1,0, 0,0,0, 1,0,1}}},
+                           {0,2,0, 0,0,0, 3,0,4}, A);
+}
+
+static Tensor<double> getRandomMatrix(std::string name, int rows, int columns,
+                                      Format format) {
+  Tensor<double> A(name, {rows, columns}, format);
+  for (int i = 0; i < rows; i++) {
+    for (int j = (i * 7) % 5; j < columns; j += 1 + (i + j) % 6) {
+      A.insert({i, j}, (double)(i + 2 * j + 1));
+    }
+  }
+  A.pack();
+  return A;
+}
+
+TEST(format, hashed_compute) {
+  IndexVar i("i"), j("j"), k("k");
+  for (ModeFormat modeFormat : {Hashed, Bitmap}) {
+    SCOPED_TRACE(util::toString(modeFormat));
+    const Format format({Dense, modeFormat});
+    Tensor<double> B = getRandomMatrix("B", 20, 30, CSR);
+    Tensor<double> H = getRandomMatrix("H", 20, 30, format);
+    Tensor<double> C = getRandomMatrix("C", 30, 25, CSR);
+    Tensor<double> x = getRandomMatrix("x", 30, 1, Format({Dense, Dense}));
+
+    Tensor<double> y("y", {20, 1}, Format({Dense, Dense}));
+    Tensor<double> yExpected("y", {20, 1}, Format({Dense, Dense}));
+    y(i,j) = H(i,k) * x(k,j);
+    yExpected(i,j) = B(i,k) * x(k,j);
+    y.evaluate();
+    yExpected.evaluate();
+    ASSERT_TENSOR_EQ(yExpected, y);
+
+    // The product inserts the coordinates of each row out of order
+    Tensor<double> A("A", {20, 25}, format);
+    Tensor<double> expected("A", {20, 25}, CSR);
+    A(i,j) = B(i,k) * C(k,j);
+    expected(i,j) = B(i,k) * C(k,j);
+    A.evaluate();
+    expected.evaluate();
+    ASSERT_TENSOR_EQ(expected, A);
+
+    // Coiteration locates the hashed operand
+    Tensor<double> M("M", {20, 30}, CSR);
+    Tensor<double> MExpected("M", {20, 30}, CSR);
+    M(i,j) = B(i,j) * H(i,j);
+    MExpected(i,j) = B(i,j) * B(i,j);
+    M.evaluate();
+    MExpected.evaluate();
+    ASSERT_TENSOR_EQ(MExpected, M);
+
+    Tensor<double> S("S", {20, 30}, CSR);
+    Tensor<double> SExpected("S", {20, 30}, CSR);
+    S(i,j) = B(i,j) + H(i,j);
+    SExpected(i,j) = B(i,j) + B(i,j);
+    S.evaluate();
+    SExpected.evaluate();
+    ASSERT_TENSOR_EQ(SExpected, S);
+  }
+}
+
+TEST(format, hashed_capacity) {
+  IndexVar i("i"), j("j"), k("k");
+  Tensor<double> B = getRandomMatrix("B", 20, 30, CSR);
+
+  // Rows of the product have fewer nonzeros than the capacity
+  Tensor<double> C("C", {30, 100}, CSR);
+  for (int k = 0; k < 30; k++) {
+    C.insert({k, (3 * k) % 100}, 1.0 + k);
+    C.insert({k, (3 * k + 50) % 100}, 2.0 + k);
+  }
+  C.pack();
+
+  Tensor<double> A("A", {20, 100}, Format({Dense, Hashed}));
+  A.setHashCapacity(64);
+  A(i,j) = B(i,k) * C(k,j);
+  A.evaluate();
+  ASSERT_EQ(64, ((int*)A.getStorage().getIndex().getModeIndex(1)
+                    .getIndexArray(0).getData())[0]);
+
+  Tensor<double> expected("A", {20, 100}, CSR);
+  expected(i,j) = B(i,k) * C(k,j);
+  expected.evaluate();
+  ASSERT_TENSOR_EQ(expected, A);
+}
+
+TEST(format, hashed_grow) {
+  IndexVar i("i"), j("j");
+  const int columns = 1000;
+
+  // One row has more nonzeros than the capacity
+  Tensor<double> B("B", {4, columns}, CSR);
+  for (int j = 0; j < 8; j++) {
+    B.insert({1, 97 * j}, 1.0 + j);
+  }
+  B.insert({3, 5}, 2.0);
+  B.pack();
+
+  Tensor<double> expected("expected", {4, columns}, CSR);
+  expected(i,j) = B(i,j);
+  expected.evaluate();
+
+  Tensor<double> A("A", {4, columns}, Format({Dense, Hashed}));
+  A.setHashCapacity(2);
+  A(i,j) = B(i,j);
+  A.evaluate();
+  ASSERT_TENSOR_EQ(expected, A);
+
+  // Without a capacity the segments are sized from the operand
+  Tensor<double> D("D", {4, columns}, Format({Dense, Hashed}));
+  D(i,j) = B(i,j);
+  D.evaluate();
+  ASSERT_TENSOR_EQ(expected, D);
+  ASSERT_GT(columns, ((int*)D.getStorage().getIndex().getModeIndex(1)
+                          .getIndexArray(0).getData())[0]);
+}
+
+TEST(format, hashed_strided) {
+  IndexVar i("i"), j("j");
+  const int columns = 4096;
+
+  // Coordinates that are multiples of the width share their low bits
+  Tensor<double> B("B", {2, columns}, CSR);
+  for (int j = 0; j < 32; j++) {
+    B.insert({0, 64 * j}, 1.0 + j);
+  }
+  B.pack();
+
+  Tensor<double> expected("expected", {2, columns}, CSR);
+  expected(i,j) = B(i,j);
+  expected.evaluate();
+
+  Tensor<double> A("A", {2, columns}, Format({Dense, Hashed}));
+  A.setHashCapacity(64);
+  A(i,j) = B(i,j);
+  A.evaluate();
+  ASSERT_TENSOR_EQ(expected, A);
+}
+
+TEST(format, hashed_array_types) {
+  Format format({Dense, Hashed});
+#ifdef PYTHON
+  ASSERT_THROW(format.setLevelArrayTypes({{Int32}, {Int64, Int64}}),
+               taco::TacoException);
+#else
+  ASSERT_DEATH(format.setLevelArrayTypes({{Int32}, {Int64, Int64}}),
+               "Hashed levels must have Int32 index arrays");
+#endif
+}
+
+TEST(format, hashed_below_compressed) {
+  IndexVar i("i"), j("j");
+  Tensor<double> B = getRandomMatrix("B", 20, 30, CSR);
+  Tensor<double> A("A", {20, 30}, Format({Sparse, Hashed}));
+  A(i,j) = B(i,j);
+#ifdef PYTHON
+  ASSERT_THROW(A.compile(), taco::TacoException);
+#else
+  ASSERT_DEATH(A.compile(), "must not be below compressed or singleton levels");
+#endif
+}
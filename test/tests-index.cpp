@@ -32,3 +32,21 @@ TEST(index, makeCSR) {
   auto colidxarray = index.getModeIndex(1).getIndexArray(1);
   ASSERT_ARRAY_EQ(colidx, {(int*)colidxarray.getData(), colidxarray.getSize()});
 }
+
+TEST(index, makeIndex) {
+  vector<int> pos = {0, 4};
+  vector<int> rowidx = {0, 1, 1, 3};
+  vector<int> colidx = {2, 0, 3, 1};
+
+  Index index = makeIndex(COO(2), {4, 5}, {{pos.data(), rowidx.data()},
+                                           {colidx.data()}}, Array::UserOwns,
+                          true);
+  ASSERT_EQ(2, index.numModeIndices());
+  ASSERT_EQ(4u, index.getSize());
+
+  // The index arrays are not copied
+  ASSERT_EQ(pos.data(), index.getModeIndex(0).getIndexArray(0).getData());
+  ASSERT_EQ(rowidx.data(), index.getModeIndex(0).getIndexArray(1).getData());
+  ASSERT_EQ(colidx.data(), index.getModeIndex(1).getIndexArray(1).getData());
+  ASSERT_EQ(4u, index.getModeIndex(1).getIndexArray(1).getSize());
+}
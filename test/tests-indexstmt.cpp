@@ -83,5 +83,18 @@ TEST(indexstmt, spmm) {
                      );
 }
 
+TEST(indexstmt, isomorphicHash) {
+  Type t(type<double>(), {3});
+  TensorVar a("a", t, Sparse), b("b", t, Sparse), c("c", t, Sparse);
+  TensorVar d("d", t, Sparse), e("e", t, Sparse), f("f", t, Sparse);
+  TensorVar g("g", t, Dense);
 
-
+  IndexStmt stmt = forall(i, a(i) = b(i) + c(i));
+  ASSERT_TRUE(isomorphic(stmt, forall(j, d(j) = e(j) + f(j))));
+  ASSERT_EQ(isomorphicHash(stmt), isomorphicHash(forall(j, d(j) = e(j) + f(j))));
+  ASSERT_NE(isomorphicHash(stmt), isomorphicHash(forall(i, a(i) = b(i) * c(i))));
+  ASSERT_NE(isomorphicHash(stmt), isomorphicHash(forall(i, a(i) = b(i) + b(i))));
+  ASSERT_NE(isomorphicHash(stmt), isomorphicHash(forall(i, a(i) = b(i) + g(i))));
+  ASSERT_EQ(isomorphicKey(stmt), isomorphicKey(forall(j, d(j) = e(j) + f(j))));
+  ASSERT_NE(isomorphicKey(stmt), isomorphicKey(forall(i, a(i) = b(i) + b(i))));
+}
@@ -1,6 +1,13 @@
 #include "test.h"
 
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+
 #include "taco/tensor.h"
+#include "taco/storage/file_io_ttb.h"
+#include "taco/util/env.h"
 
 using namespace taco;
 
@@ -127,3 +134,161 @@ TEST(io, mtxsymmetric) {
 
   ASSERT_TRUE(equals(expected, tensor));
 }
+
+TEST(io, tns_number_formats) {
+  std::stringstream stream;
+  stream << "1 2 1.5\n"
+         << "\n"
+         << "2\t1  -2.5e-3\n"
+         << "3 3 0.1234567890123456789\n"
+         << "3 1 1E+30\n"
+         << "1 3 7";
+  Tensor<double> tensor = read(stream, FileType::tns, Sparse);
+
+  Tensor<double> expected({3,3}, Sparse);
+  expected.insert({0, 1}, 1.5);
+  expected.insert({1, 0}, -2.5e-3);
+  expected.insert({2, 2}, 0.1234567890123456789);
+  expected.insert({2, 0}, 1E+30);
+  expected.insert({0, 2}, 7.0);
+  expected.pack();
+
+  ASSERT_TRUE(equals(expected, tensor));
+}
+
+TEST(io, rb_number_formats) {
+  // The last line of values is full, and the values have Fortran exponents
+  std::stringstream stream;
+  stream << "Test matrix                                                             TEST\n"
+         << "             4             1             1             2             0\n"
+         << "RUA                        3             3             6             0\n"
+         << "(4I5)           (6I5)           (3D15.7)                                \n"
+         << "    1    3    5    7\n"
+         << "    1    3    1    2    2    3\n"
+         << "  1.0000000D+00 -2.5000000D-01  3.0000000d0\n"
+         << "  4.5000000E+01  5.0000000D2    6.2500000D+00\n";
+  Tensor<double> tensor = read(stream, FileType::rb, CSC);
+
+  Tensor<double> expected({3,3}, CSC);
+  expected.insert({0, 0}, 1.0);
+  expected.insert({2, 0}, -0.25);
+  expected.insert({0, 1}, 3.0);
+  expected.insert({1, 1}, 45.0);
+  expected.insert({1, 2}, 500.0);
+  expected.insert({2, 2}, 6.25);
+  expected.pack();
+
+  ASSERT_TRUE(equals(expected, tensor));
+}
+
+TEST(io, tns_parallel) {
+  // Large enough to be split into several chunks
+  const int size = 1000;
+  Tensor<double> expected({size, size}, Sparse);
+  std::stringstream stream;
+  for (int k = 0; k < 200000; ++k) {
+    int i = (k * 7919) % size;
+    int j = (k * 13 + k / size) % size;
+    double value = k / 8.0;
+    expected.insert({i, j}, value);
+    stream << i+1 << " " << j+1 << " " << value << "\n";
+  }
+  expected.pack();
+
+  int numThreads = taco_get_num_threads();
+  taco_set_num_threads(4);
+  Tensor<double> tensor = read(stream, FileType::tns, Sparse);
+  taco_set_num_threads(numThreads);
+
+  ASSERT_TRUE(equals(expected, tensor));
+}
+
+TEST(io, ttb) {
+  std::vector<Format> formats = {Format({Dense, Sparse, Sparse}),
+                                 Format({Sparse, Dense, Sparse}, {2, 0, 1}),
+                                 COO(3)};
+  for (auto& format : formats) {
+    Tensor<double> tensor({5, 6, 7}, format);
+    tensor.insert({0, 0, 0}, 1.0);
+    tensor.insert({1, 2, 0}, 2.0);
+    tensor.insert({4, 0, 6}, 3.0);
+    tensor.insert({2, 5, 2}, 4.0);
+    tensor.pack();
+
+    std::string filename = util::getTmpdir() + "io_ttb.ttb";
+    write(filename, tensor);
+    Tensor<double> mapped = read(filename, format);
+    ASSERT_EQ(format, mapped.getFormat());
+    ASSERT_TRUE(equals(tensor, mapped));
+
+    // The values are used in place and aligned for vector loads
+    auto values = mapped.getStorage().getValues().getData();
+    ASSERT_EQ(0u, (uintptr_t)values % 64);
+
+    std::ifstream file(filename, std::ios::binary);
+    Tensor<double> streamed = read(file, FileType::ttb, format);
+    ASSERT_TRUE(equals(tensor, streamed));
+    remove(filename.c_str());
+  }
+}
+
+TEST(io, ttb_malformed) {
+  Format format({Dense, Sparse});
+  Tensor<double> tensor({5, 6}, format);
+  tensor.insert({1, 2}, 2.0);
+  tensor.insert({4, 0}, 3.0);
+  tensor.pack();
+
+  std::stringstream stream;
+  writeTTB(stream, tensor);
+  const std::string contents = stream.str();
+
+  // The values of a truncated file are past its end
+  std::stringstream truncated(contents.substr(0, contents.size() - 8));
+#ifdef PYTHON
+  ASSERT_THROW(read(truncated, FileType::ttb, format), taco::TacoException);
+#else
+  ASSERT_DEATH(read(truncated, FileType::ttb, format), "truncated");
+#endif
+
+  // The component type follows the magic number, version and order
+  std::string corrupt = contents;
+  corrupt[16] = (char)0xff;
+  std::stringstream corrupted(corrupt);
+#ifdef PYTHON
+  ASSERT_THROW(read(corrupted, FileType::ttb, format), taco::TacoException);
+#else
+  ASSERT_DEATH(read(corrupted, FileType::ttb, format), "component type");
+#endif
+
+  // The pos and crd offsets of the compressed level follow the 40 byte
+  // header, the 56 byte header of the dense level, and the mode, dimension,
+  // format and flags of the compressed level
+  uint64_t posOffset, crdOffset;
+  memcpy(&posOffset, contents.data() + 120, sizeof(posOffset));
+  memcpy(&crdOffset, contents.data() + 136, sizeof(crdOffset));
+  const int32_t large = 5;
+
+  std::string unsorted = contents;
+  memcpy(&unsorted[posOffset + 2 * sizeof(int32_t)], &large, sizeof(large));
+  std::stringstream unsortedStream(unsorted);
+#ifdef PYTHON
+  ASSERT_THROW(read(unsortedStream, FileType::ttb, format),
+               taco::TacoException);
+#else
+  ASSERT_DEATH(read(unsortedStream, FileType::ttb, format),
+               "inconsistent positions");
+#endif
+
+  std::string outside = contents;
+  const int32_t column = 6;
+  memcpy(&outside[crdOffset], &column, sizeof(column));
+  std::stringstream outsideStream(outside);
+#ifdef PYTHON
+  ASSERT_THROW(read(outsideStream, FileType::ttb, format),
+               taco::TacoException);
+#else
+  ASSERT_DEATH(read(outsideStream, FileType::ttb, format),
+               "outside their dimension");
+#endif
+}
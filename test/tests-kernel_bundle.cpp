@@ -0,0 +1,82 @@
+#include "test.h"
+#include "taco/tensor.h"
+#include "taco/kernel_bundle.h"
+#include "taco/index_notation/transformations.h"
+#include "test_tensors.h"
+
+#include <cstdlib>
+#include <unistd.h>
+
+using namespace taco;
+
+TEST(kernel_bundle, shared_library) {
+  char dirTemplate[] = "/tmp/taco_bundle_test_XXXXXX";
+  const std::string dir = std::string(mkdtemp(dirTemplate)) + "/";
+
+  // The bundle's kernels are registered for the rest of the tests, so they
+  // use formats that the other tests do not.
+  IndexVar i, j;
+  Tensor<double> B = d33a("B", Format({Sparse, Dense}));
+  Tensor<double> C = d33b("C", Format({Sparse, Dense}));
+  Tensor<double> c = d3a("c", Format({Dense}));
+  B.pack();
+  C.pack();
+  c.pack();
+
+  KernelBundle bundle;
+  Tensor<double> A({3,3}, Format({Sparse, Dense}));
+  A(i,j) = B(i,j) + C(i,j);
+  bundle.add(A);
+  Tensor<double> a({3}, Format({Dense}));
+  a(i) = B(i,j) * c(j);
+  bundle.add(a);
+  Tensor<double> a2({3}, Format({Dense}));
+  a2(i) = C(i,j) * c(j);
+  bundle.add(a2);
+  ASSERT_EQ(2u, bundle.getNumKernels());
+
+  bundle.compileToSharedLibrary(dir, "test_bundle");
+  loadKernelBundle(dir + "test_bundle.so", "test_bundle");
+
+  // Bundled kernels are only used for the variant they were lowered with
+  IndexStmt stmt = scalarPromote(IndexStmt(A.getAssignment()).concretize());
+  ASSERT_NE(nullptr, getBundledKernel(stmt, false, false));
+  ASSERT_EQ(nullptr, getBundledKernel(stmt, false, true));
+  ASSERT_EQ(nullptr, getBundledKernel(stmt, true, false));
+
+  // Bundled kernels are used without invoking the compiler
+  setenv("TACO_CC", "false", 1);
+  setenv("CACHE_KERNELS", "0", 1);
+  Tensor<double> D({3,3}, Format({Sparse, Dense}));
+  D(i,j) = C(i,j) + B(i,j);
+  D.evaluate();
+  Tensor<double> d({3}, Format({Dense}));
+  d(i) = C(i,j) * c(j);
+  d.evaluate();
+  unsetenv("CACHE_KERNELS");
+  unsetenv("TACO_CC");
+
+  A.evaluate();
+  a2.evaluate();
+  ASSERT_TENSOR_EQ(A, D);
+  ASSERT_TENSOR_EQ(a2, d);
+  ASSERT_EQ(0, system(("rm -rf " + dir).c_str()));
+}
+
+TEST(kernel_bundle, static_library) {
+  char dirTemplate[] = "/tmp/taco_bundle_test_XXXXXX";
+  const std::string dir = std::string(mkdtemp(dirTemplate)) + "/";
+
+  IndexVar i;
+  Tensor<double> b = d5a("b", Format({Sparse}));
+  b.pack();
+  Tensor<double> a({5}, Format({Dense}));
+  a(i) = b(i) * b(i);
+
+  KernelBundle bundle;
+  bundle.add(a);
+  bundle.compileToStaticLibrary(dir, "test_static_bundle");
+  ASSERT_EQ(0, access((dir + "test_static_bundle.a").c_str(), R_OK));
+  ASSERT_EQ(0, access((dir + "test_static_bundle.h").c_str(), R_OK));
+  ASSERT_EQ(0, system(("rm -rf " + dir).c_str()));
+}
@@ -0,0 +1,70 @@
+#include "test.h"
+#include "taco/tensor.h"
+#include "test_tensors.h"
+
+#include <cstdlib>
+
+#include "taco/target.h"
+
+using namespace taco;
+
+#if LLVM_BUILT
+
+TEST(llvm, target_from_environment) {
+  setenv("TACO_TARGET", "x86-linux", 1);
+  Target target = getTargetFromEnvironment();
+  unsetenv("TACO_TARGET");
+  ASSERT_EQ(Target::X86, target.arch);
+  ASSERT_EQ(Target::Linux, target.os);
+}
+
+TEST(llvm, jit_compute) {
+  Tensor<double> B = d33a("B", Format({Dense, Sparse}));
+  Tensor<double> c = d3a("c", Format({Dense}));
+  B.pack();
+  c.pack();
+
+  IndexVar i, j;
+  Tensor<double> expected({3}, Format({Dense}));
+  expected(i) = B(i,j) * c(j);
+  expected.evaluate();
+
+  // A tensor's module targets the target in the environment when the tensor
+  // is constructed.
+  setenv("TACO_TARGET", "x86-linux", 1);
+  setenv("CACHE_KERNELS", "0", 1);
+  Tensor<double> a({3}, Format({Dense}));
+  unsetenv("TACO_TARGET");
+  a(i) = B(i,j) * c(j);
+  a.evaluate();
+  unsetenv("CACHE_KERNELS");
+
+  // The JIT module source is LLVM IR rather than C.
+  ASSERT_EQ(0u, a.getSource().find("; ModuleID"));
+  ASSERT_EQ(std::string::npos, expected.getSource().find("; ModuleID"));
+  ASSERT_TENSOR_EQ(expected, a);
+}
+
+TEST(llvm, jit_sparse_output) {
+  Tensor<double> B = d33a("B", Format({Sparse, Sparse}));
+  Tensor<double> C = d33b("C", Format({Sparse, Sparse}));
+  B.pack();
+  C.pack();
+
+  IndexVar i, j;
+  Tensor<double> expected({3,3}, Format({Sparse, Sparse}));
+  expected(i,j) = B(i,j) + C(i,j);
+  expected.evaluate();
+
+  setenv("TACO_TARGET", "x86-linux", 1);
+  setenv("CACHE_KERNELS", "0", 1);
+  Tensor<double> A({3,3}, Format({Sparse, Sparse}));
+  unsetenv("TACO_TARGET");
+  A(i,j) = B(i,j) + C(i,j);
+  A.evaluate();
+  unsetenv("CACHE_KERNELS");
+
+  ASSERT_TENSOR_EQ(expected, A);
+}
+
+#endif
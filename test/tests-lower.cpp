@@ -1556,4 +1556,70 @@ TEST_STMT(vector_not,
   }
 )
 
+TEST(kernel, bind) {
+  Tensor<double> B0 = d33a("B0", CSR);
+  Tensor<double> B1 = d33b("B1", CSR);
+  Tensor<double> C0 = d33b("C0", CSR);
+  B0.pack();
+  B1.pack();
+  C0.pack();
+
+  Tensor<double> R("R", {3,3}, CSR);
+  R(i,j) = B0(i,j) + C0(i,j);
+  Kernel kernel = compile(makeConcreteNotation(R.getAssignment()));
+  ASSERT_EQ(3u, kernel.getParameters().size());
+  ASSERT_EQ(R.getTensorVar(), kernel.getParameters()[0]);
+
+  TensorStorage result = Tensor<double>("result", {3,3}, CSR).getStorage();
+  kernel.bind(R.getTensorVar(), result);
+  kernel.bind(B0.getTensorVar(), B0.getStorage());
+  kernel.bind(C0.getTensorVar(), C0.getStorage());
+  ASSERT_TRUE(kernel.assemble());
+  ASSERT_TRUE(kernel.compute());
+
+  // View the storage the kernel wrote to through a tensor
+  Tensor<double> actual("actual", {3,3}, CSR);
+  actual.setStorage(result);
+
+  Tensor<double> expected("expected", {3,3}, Format({Dense,Dense}));
+  expected(i,j) = B0(i,j) + C0(i,j);
+  expected.evaluate();
+  ASSERT_TRUE(equals(expected, actual));
+
+  // Rebinding an argument reuses the kernel on other data
+  kernel.bind(B0.getTensorVar(), B1.getStorage());
+  ASSERT_TRUE(kernel());
+
+  Tensor<double> expected1("expected1", {3,3}, Format({Dense,Dense}));
+  expected1(i,j) = B1(i,j) + C0(i,j);
+  expected1.evaluate();
+  ASSERT_TRUE(equals(expected1, actual));
+}
+
+TEST(kernel, bind_hashed) {
+  Tensor<double> B = d33a("B", CSR);
+  Tensor<double> C = d33b("C", CSR);
+  B.pack();
+  C.pack();
+
+  Format dh({Dense,Hashed});
+  Tensor<double> R("R", {3,3}, dh);
+  R(i,j) = B(i,j) + C(i,j);
+  Kernel kernel = compile(makeConcreteNotation(R.getAssignment()));
+
+  TensorStorage result = Tensor<double>("result", {3,3}, dh).getStorage();
+  kernel.bind(R.getTensorVar(), result);
+  kernel.bind(B.getTensorVar(), B.getStorage());
+  kernel.bind(C.getTensorVar(), C.getStorage());
+  ASSERT_TRUE(kernel());
+
+  Tensor<double> actual("actual", {3,3}, dh);
+  actual.setStorage(result);
+
+  Tensor<double> expected("expected", {3,3}, Format({Dense,Dense}));
+  expected(i,j) = B(i,j) + C(i,j);
+  expected.evaluate();
+  ASSERT_TRUE(equals(expected, actual));
+}
+
 }}
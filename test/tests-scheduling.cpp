@@ -26,6 +26,23 @@ TEST(scheduling, splitEquality) {
   ASSERT_NE(rel1, rel5);
 }
 
+TEST(scheduling, divideEquality) {
+  IndexVar i1, i2;
+  IndexVar j1, j2;
+  IndexVarRel rel1 = IndexVarRel(new DivideRelNode(i, i1, i2, 2));
+  IndexVarRel rel2 = IndexVarRel(new DivideRelNode(i, i1, i2, 2));
+  IndexVarRel rel3 = IndexVarRel(new DivideRelNode(j, i1, i1, 2));
+  IndexVarRel rel4 = IndexVarRel(new DivideRelNode(i, i1, i2, 4));
+  IndexVarRel rel5 = IndexVarRel(new DivideRelNode(i, j1, j2, 2));
+  IndexVarRel rel6 = IndexVarRel(new SplitRelNode(i, i1, i2, 2));
+
+  ASSERT_EQ(rel1, rel2);
+  ASSERT_NE(rel1, rel3);
+  ASSERT_NE(rel1, rel4);
+  ASSERT_NE(rel1, rel5);
+  ASSERT_NE(rel1, rel6);
+}
+
 TEST(scheduling, forallReplace) {
   IndexVar i1, j1, j2;
   Type t(type<double>(), {3});
@@ -411,6 +428,179 @@ TEST(scheduling, parallelizeTemporaryReduction) {
 //  codegen->compile(compute, true);
 }
 
+TEST(scheduling, parallelizeAssembly) {
+  if (should_use_CUDA_codegen()) {
+    return;
+  }
+
+  // Spans several blocks of the parallel prefix sum over the row counts
+  const int rows = 5000;
+  Tensor<double> A("A", {rows, 8}, CSR);
+  Tensor<double> B("B", {rows, 8}, CSR);
+
+  for (int i = 0; i < rows; i++) {
+    for (int j = 0; j < 8; j++) {
+      if ((i+j) % 3 == 0) {
+        A.insert({i, j}, (double) (i+j));
+      }
+      if ((i*j) % 5 == 1) {
+        B.insert({i, j}, (double) (i-j));
+      }
+    }
+  }
+
+  A.pack();
+  B.pack();
+
+  IndexVar i("i"), j("j");
+  Tensor<double> expected("expected", {rows, 8}, {Dense, Dense});
+  expected(i, j) = A(i, j) + B(i, j);
+  expected.evaluate();
+
+  Tensor<double> C("C", {rows, 8}, CSR);
+  C(i, j) = A(i, j) + B(i, j);
+  IndexStmt stmt = C.getAssignment().concretize();
+  stmt = stmt.parallelize(i, ParallelUnit::CPUThread, 
+                          OutputRaceStrategy::ParallelAssembly);
+  C.compile(stmt);
+  C.assemble();
+  C.compute();
+  ASSERT_TRUE(equals(expected, C));
+
+  // Sizes the values array with the symbolic phase too
+  Tensor<double> expectedMul("expectedMul", {rows, 8}, {Dense, Dense});
+  expectedMul(i, j) = A(i, j) * B(i, j);
+  expectedMul.evaluate();
+
+  Tensor<double> D("D", {rows, 8}, CSR);
+  D.setAssembleWhileCompute(true);
+  D(i, j) = A(i, j) * B(i, j);
+  stmt = D.getAssignment().concretize();
+  stmt = stmt.parallelize(i, ParallelUnit::CPUThread, 
+                          OutputRaceStrategy::ParallelAssembly);
+  D.compile(stmt, true);
+  D.assemble();
+  D.compute();
+  ASSERT_TRUE(equals(expectedMul, D));
+
+  // Without parallel assembly the output must support inserts
+  std::string reason;
+  ASSERT_FALSE(Parallelize(i, ParallelUnit::CPUThread, 
+                           OutputRaceStrategy::NoRaces).apply(
+                   C.getAssignment().concretize(), &reason).defined());
+
+  // Parallel iterations cannot locate their segments of an append mode that
+  // the parallelized loop iterates over
+  Tensor<double> a("a", {rows}, {Sparse});
+  for (int i = 0; i < rows; i += 3) {
+    a.insert({i}, (double) i);
+  }
+  a.pack();
+  Tensor<double> c("c", {rows}, {Sparse});
+  c(i) = a(i);
+  ASSERT_FALSE(Parallelize(i, ParallelUnit::CPUThread, 
+                           OutputRaceStrategy::ParallelAssembly).apply(
+                   c.getAssignment().concretize(), &reason).defined());
+}
+
+TEST(scheduling, parallelizeAssemblyTensor3) {
+  if (should_use_CUDA_codegen()) {
+    return;
+  }
+
+  const int dim0 = 4, dim1 = 1000, dim2 = 8;
+  Format dds({Dense, Dense, Sparse});
+  Tensor<double> A("A", {dim0, dim1, dim2}, dds);
+  Tensor<double> B("B", {dim0, dim1, dim2}, dds);
+  for (int i = 0; i < dim0; i++) {
+    for (int j = 0; j < dim1; j++) {
+      for (int k = 0; k < dim2; k++) {
+        if ((i+j+k) % 3 == 0) {
+          A.insert({i, j, k}, (double) (i+j+k));
+        }
+        if ((i*j+k) % 5 == 1) {
+          B.insert({i, j, k}, (double) (i-j-k));
+        }
+      }
+    }
+  }
+  A.pack();
+  B.pack();
+
+  IndexVar i("i"), j("j"), k("k");
+  Tensor<double> expected("expected", {dim0, dim1, dim2}, 
+                          {Dense, Dense, Dense});
+  expected(i, j, k) = A(i, j, k) + B(i, j, k);
+  expected.evaluate();
+
+  // The segments of the last mode are children of the parallelized mode
+  Tensor<double> C("C", {dim0, dim1, dim2}, dds);
+  C(i, j, k) = A(i, j, k) + B(i, j, k);
+  IndexStmt stmt = C.getAssignment().concretize();
+  stmt = stmt.parallelize(j, ParallelUnit::CPUThread, 
+                          OutputRaceStrategy::ParallelAssembly);
+  C.compile(stmt);
+  C.assemble();
+  C.compute();
+  ASSERT_TRUE(equals(expected, C));
+
+  const std::string source = C.getSource();
+  if (source.find("; ModuleID") == std::string::npos) {
+    ASSERT_NE(std::string::npos, source.find("#pragma omp parallel for"));
+  }
+
+  // The last mode must be a child of the parallelized mode
+  std::string reason;
+  ASSERT_FALSE(Parallelize(i, ParallelUnit::CPUThread, 
+                           OutputRaceStrategy::ParallelAssembly).apply(
+                   C.getAssignment().concretize(), &reason).defined());
+}
+
+TEST(scheduling, vectorizeReduction) {
+  if (should_use_CUDA_codegen()) {
+    return;
+  }
+
+  Tensor<double> A("A", {64, 64}, CSR);
+  Tensor<double> x("x", {64}, {Dense});
+  Tensor<double> y("y", {64}, {Dense});
+
+  for (int i = 0; i < 64; i++) {
+    for (int j = 0; j < 64; j++) {
+      if ((i*j) % 7 < 4) {
+        A.insert({i, j}, (double) (i+j));
+      }
+    }
+    x.insert({i}, (double) i);
+  }
+
+  A.pack();
+  x.pack();
+
+  IndexVar i("i"), j("j"), jpos("jpos"), jpos0("jpos0"), jpos1("jpos1");
+  y(i) = A(i, j) * x(j);
+  IndexStmt stmt = y.getAssignment().concretize();
+  stmt = stmt.pos(j, jpos, A(i, j))
+             .split(jpos, jpos0, jpos1, 4)
+             .parallelize(jpos1, ParallelUnit::CPUVector,
+                          OutputRaceStrategy::ParallelReduction);
+  y.compile(stmt);
+  y.assemble();
+  y.compute();
+
+  // The gather loop is emitted as an explicit SIMD reduction
+  const std::string source = y.getSource();
+  if (source.find("; ModuleID") == std::string::npos) {
+    ASSERT_NE(std::string::npos, source.find("TACO_SIMD_CLONES\nint compute"));
+    ASSERT_NE(std::string::npos, source.find("#pragma omp simd reduction(+:"));
+  }
+
+  Tensor<double> expected("expected", {64}, {Dense});
+  expected(i) = A(i, j) * x(j);
+  expected.evaluate();
+  ASSERT_TENSOR_EQ(expected, y);
+}
+
 TEST(scheduling, multilevel_tiling) {
   Tensor<double> A("A", {8}, {Sparse});
   Tensor<double> B("B", {8}, {Sparse});
@@ -718,6 +908,94 @@ TEST(scheduling, spmv_warp_per_row) {
   ASSERT_TENSOR_EQ(expected, y);
 }
 
+TEST(scheduling, divide_coord) {
+  if (should_use_CUDA_codegen()) {
+    return;
+  }
+  const int iSIZE = 37;
+  const int jSIZE = 16;
+  Tensor<double> A("A", {iSIZE, jSIZE}, CSR);
+  Tensor<double> x("x", {jSIZE}, {Dense});
+  Tensor<double> y("y", {iSIZE}, {Dense});
+
+  for (int i = 0; i < iSIZE; i++) {
+    for (int j = 0; j < jSIZE; j++) {
+      if ((i+j) % 3 == 0) {
+        A.insert({i, j}, (double) (i+j));
+      }
+    }
+  }
+  for (int j = 0; j < jSIZE; j++) {
+    x.insert({j}, (double) j);
+  }
+
+  A.pack();
+  x.pack();
+
+  IndexVar i("i"), j("j"), i0("i0"), i1("i1");
+  y(i) = A(i, j) * x(j);
+
+  IndexStmt stmt = y.getAssignment().concretize();
+  stmt = stmt.divide(i, i0, i1, 4)
+          .parallelize(i0, ParallelUnit::CPUThread, OutputRaceStrategy::NoRaces);
+
+  y.compile(stmt);
+  y.assemble();
+  y.compute();
+
+  Tensor<double> expected("expected", {iSIZE}, {Dense});
+  expected(i) = A(i, j) * x(j);
+  expected.compile();
+  expected.assemble();
+  expected.compute();
+  ASSERT_TENSOR_EQ(expected, y);
+}
+
+TEST(scheduling, spmv_fuse_pos_divide) {
+  if (should_use_CUDA_codegen()) {
+    return;
+  }
+  const int iSIZE = 64;
+  const int jSIZE = 64;
+  Tensor<double> A("A", {iSIZE, jSIZE}, CSR);
+  Tensor<double> x("x", {jSIZE}, {Dense});
+  Tensor<double> y("y", {iSIZE}, {Dense});
+
+  // Skewed rows, so that equal-nnz blocks straddle row boundaries
+  for (int i = 0; i < iSIZE; i++) {
+    int rowLength = (i % 8 == 0) ? jSIZE : (i % 3);
+    for (int j = 0; j < rowLength; j++) {
+      A.insert({i, j}, (double) (i+1));
+    }
+  }
+  for (int j = 0; j < jSIZE; j++) {
+    x.insert({j}, (double) j);
+  }
+
+  A.pack();
+  x.pack();
+
+  IndexVar i("i"), j("j"), f("f"), fpos("fpos"), block("block"), fpos1("fpos1");
+  y(i) = A(i, j) * x(j);
+
+  IndexStmt stmt = y.getAssignment().concretize();
+  stmt = stmt.fuse(i, j, f)
+          .pos(f, fpos, A(i, j))
+          .divide(fpos, block, fpos1, 4)
+          .parallelize(block, ParallelUnit::CPUThread, OutputRaceStrategy::Atomics);
+
+  y.compile(stmt);
+  y.assemble();
+  y.compute();
+
+  Tensor<double> expected("expected", {iSIZE}, {Dense});
+  expected(i) = A(i, j) * x(j);
+  expected.compile();
+  expected.assemble();
+  expected.compute();
+  ASSERT_TENSOR_EQ(expected, y);
+}
+
 TEST(scheduling, dense_pos_error) {
   Tensor<double> x("x", {8}, {Dense});
   Tensor<double> y("y", {8}, {Dense});
@@ -823,3 +1101,199 @@ TEST(scheduling_eval_test, spmv_fuse) {
   expected.compute();
   ASSERT_TENSOR_EQ(expected, y);
 }
+
+static std::map<TensorVar,OperandStatistics>
+getStatistics(const TensorBase& tensor, size_t nnz, double variation) {
+  OperandStatistics statistics;
+  statistics.nnz = nnz;
+  statistics.meanSegmentLength = 16.0;
+  statistics.segmentLengthVariation = variation;
+  return {{tensor.getTensorVar(), statistics}};
+}
+
+static IndexStmt makeDefaultStmt(const TensorBase& tensor) {
+  IndexStmt stmt = makeConcreteNotation(tensor.getAssignment());
+  return insertTemporaries(reorderLoopsTopologically(stmt));
+}
+
+TEST(scheduling, autoschedule) {
+  if (should_use_CUDA_codegen()) {
+    return;
+  }
+  Tensor<double> A("A", {64, 64}, CSR);
+  Tensor<double> B("B", {64, 64}, CSR);
+  Tensor<double> C("C", {64, 64}, CSR);
+  Tensor<double> x("x", {64}, {Dense});
+  Tensor<double> y("y", {64}, {Dense});
+  y(i) = A(i,j) * x(j);
+  IndexStmt stmt = makeDefaultStmt(y);
+
+  // Small operands stay serial
+  ASSERT_EQ(stmt, autoschedule(stmt, getStatistics(A, 1000, 0.5)));
+
+  // Rows of similar length are parallelized in chunks of rows
+  ASSERT_EQ("suchthat(forall(i0, forall(i1, forall(j, "
+            "y(i) += A(i,j) * x(j))), CPUThread, NoRaces), "
+            "split(i, i0, i1, 16))",
+            util::toString(autoschedule(stmt,
+                                        getStatistics(A, 1 << 20, 0.5))));
+
+  // Without atomics, rows of very different length are also parallelized in
+  // chunks of rows
+  ASSERT_EQ("suchthat(forall(i0, forall(i1, forall(j, "
+            "y(i) += A(i,j) * x(j))), CPUThread, NoRaces), "
+            "split(i, i0, i1, 16))",
+            util::toString(autoschedule(stmt,
+                                        getStatistics(A, 1 << 20, 4.0))));
+
+  // With atomics, they are parallelized in chunks of nonzeros
+  ASSERT_EQ("suchthat(forall(chunk, forall(fpos1, "
+            "y(i) += A(i,j) * x(j)), CPUThread, Atomics), "
+            "fuse(i, j, f) and pos(f, fpos, A(i,j)) and "
+            "split(fpos, chunk, fpos1, 2048))",
+            util::toString(autoschedule(stmt,
+                                        getStatistics(A, 1 << 20, 4.0),
+                                        true)));
+
+  // Rows of the transposed product scatter into the result, which stays
+  // serial unless atomics are allowed
+  y(j) = A(i,j) * x(i);
+  IndexStmt transposed = makeDefaultStmt(y);
+  ASSERT_EQ(transposed,
+            autoschedule(transposed, getStatistics(A, 1 << 20, 0.5)));
+  ASSERT_EQ("suchthat(forall(i0, forall(i1, forall(j, "
+            "y(j) += A(i,j) * x(i))), CPUThread, Atomics), "
+            "split(i, i0, i1, 16))",
+            util::toString(autoschedule(transposed,
+                                        getStatistics(A, 1 << 20, 0.5),
+                                        true)));
+
+  // Sparse results are assembled in parallel
+  C(i,j) = A(i,j) + B(i,j);
+  ASSERT_EQ("forall(i, forall(j, C(i,j) = A(i,j) + B(i,j)), "
+            "CPUThread, ParallelAssembly)",
+            util::toString(autoschedule(makeDefaultStmt(C),
+                                        getStatistics(A, 1 << 20, 0.5))));
+}
+
+TEST(scheduling, autoschedule_sparse_vector) {
+  // Enough nonzeros for the default schedule to parallelize the statement
+  const int SIZE = 100000;
+  Tensor<double> a("a", {SIZE}, {Sparse});
+  for (int i = 0; i < SIZE; i += 2) {
+    a.insert({i}, (double) i);
+  }
+  a.pack();
+
+  Tensor<double> expected("expected", {SIZE}, {Dense});
+  expected(i) = a(i) * 2.0;
+  expected.compile(makeConcreteNotation(expected.getAssignment()));
+  expected.assemble();
+  expected.compute();
+
+  // The result mode is appended to by the parallelized loop itself, so its
+  // components cannot be assembled in parallel
+  Tensor<double> c("c", {SIZE}, {Sparse});
+  c(i) = a(i) * 2.0;
+  c.evaluate();
+  ASSERT_TRUE(equals(expected, c));
+}
+
+TEST(scheduling, autoschedule_skewed_spmv) {
+  const int iSIZE = 512;
+  const int jSIZE = 512;
+  Tensor<double> A("A", {iSIZE, jSIZE}, CSR);
+  Tensor<double> x("x", {jSIZE}, {Dense});
+  Tensor<double> expected("expected", {iSIZE}, {Dense});
+  Tensor<double> y("y", {iSIZE}, {Dense});
+
+  // Every sixteenth row is full, and the other rows are almost empty
+  for (int i = 0; i < iSIZE; i++) {
+    int rowLength = (i % 16 == 0) ? jSIZE : (i % 3);
+    for (int j = 0; j < rowLength; j++) {
+      A.insert({i, j}, (double) (i+1));
+    }
+  }
+  for (int j = 0; j < jSIZE; j++) {
+    x.insert({j}, (double) j);
+  }
+  A.pack();
+  x.pack();
+
+  expected(i) = A(i,j) * x(j);
+  expected.compile(makeConcreteNotation(expected.getAssignment()));
+  expected.assemble();
+  expected.compute();
+
+  y(i) = A(i,j) * x(j);
+  y.setAtomicSchedules(true);
+  y.compile();
+  y.assemble();
+  y.compute();
+  ASSERT_TENSOR_EQ(expected, y);
+}
+
+TEST(scheduling, autoschedule_unpacked_operand) {
+  if (should_use_CUDA_codegen()) {
+    return;
+  }
+  const int SIZE = 64;
+  Tensor<double> A("A", {SIZE, SIZE}, CSR);
+  Tensor<double> x("x", {SIZE}, {Dense});
+  for (int i = 0; i < SIZE; i++) {
+    for (int j = i % 2; j < SIZE; j += 8) {
+      A.insert({i, j}, (double) (i+j));
+    }
+    x.insert({i}, (double) i);
+  }
+
+  // The operands are packed when the result is compiled, so that their
+  // statistics keep the small statement serial
+  Tensor<double> y("y", {SIZE}, {Dense});
+  y(i) = A(i,j) * x(j);
+  y.compile();
+  ASSERT_FALSE(A.needsPack());
+  const std::string source = y.getSource();
+  if (source.find("; ModuleID") == std::string::npos) {
+    ASSERT_EQ(std::string::npos, source.find("#pragma omp parallel for"));
+  }
+  y.assemble();
+  y.compute();
+
+  Tensor<double> expected("expected", {SIZE}, {Dense});
+  expected(i) = A(i,j) * x(j);
+  expected.compile(makeConcreteNotation(expected.getAssignment()));
+  expected.assemble();
+  expected.compute();
+  ASSERT_TENSOR_EQ(expected, y);
+}
+
+TEST(scheduling, sddmm_csr_result) {
+  const int SIZE = 16;
+  Tensor<double> B("B", {SIZE, SIZE}, CSR);
+  Tensor<double> C("C", {SIZE, 8}, {Dense, Dense});
+  Tensor<double> D("D", {8, SIZE}, {Dense, Dense});
+  for (int i = 0; i < SIZE; i++) {
+    for (int j = i % 3; j < SIZE; j += 4) {
+      B.insert({i, j}, (double) (i+j+1));
+    }
+    for (int k = 0; k < 8; k++) {
+      C.insert({i, k}, (double) (i*k % 5));
+      D.insert({k, i}, (double) ((i+k) % 7));
+    }
+  }
+  B.pack();
+  C.pack();
+  D.pack();
+
+  Tensor<double> expected("expected", {SIZE, SIZE}, {Dense, Dense});
+  expected(i,j) = B(i,j) * C(i,k) * D(k,j);
+  expected.evaluate();
+
+  // The rows of the result are computed in a workspace, since the reduction
+  // over k is nested between the loops over its rows and columns
+  Tensor<double> A("A", {SIZE, SIZE}, CSR);
+  A(i,j) = B(i,j) * C(i,k) * D(k,j);
+  A.evaluate();
+  ASSERT_TENSOR_EQ(expected, A);
+}
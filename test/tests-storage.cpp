@@ -6,6 +6,7 @@
 #include "taco/tensor.h"
 #include "taco/format.h"
 #include "taco/util/strings.h"
+#include "storage/coordinate_sort.h"
 
 typedef int                     IndexType;
 typedef std::vector<IndexType>  IndexArray; // Index values
@@ -487,3 +488,68 @@ INSTANTIATE_TEST_CASE_P(tensor3, storage,
                     )
            )
 );
+
+TEST(storage, sort_coordinates) {
+  // Components of a 3-mode tensor with double values, in random order and
+  // with a duplicate coordinate
+  const int order = 3;
+  const size_t componentSize = order * sizeof(int) + sizeof(double);
+  const std::vector<std::vector<int>> components = {
+    {2, 0, 70000}, {0, 5000, 1}, {2, 0, 3}, {0, 5000, 1}, {1, 1, 1}, {0, 2, 9}
+  };
+  std::vector<char> buffer(components.size() * componentSize);
+  for (size_t i = 0; i < components.size(); ++i) {
+    memcpy(&buffer[i * componentSize], components[i].data(),
+           order * sizeof(int));
+    double value = i;
+    memcpy(&buffer[i * componentSize + order * sizeof(int)], &value,
+           sizeof(double));
+  }
+
+  // Sort by modes (2,0,1)
+  std::vector<std::vector<int>> coordinates;
+  std::vector<double> values(components.size());
+  taco::sortCoordinates(buffer.data(), components.size(), componentSize,
+                        sizeof(double), {2, 0, 1}, coordinates,
+                        (char*)values.data());
+  ASSERT_EQ(std::vector<int>({1, 1, 1, 3, 9, 70000}), coordinates[0]);
+  ASSERT_EQ(std::vector<int>({0, 0, 1, 2, 0, 2}), coordinates[1]);
+  ASSERT_EQ(std::vector<int>({5000, 5000, 1, 0, 2, 0}), coordinates[2]);
+  ASSERT_EQ(std::vector<double>({1, 3, 4, 2, 5, 0}), values);
+
+  // Sorted buffers are split without sorting
+  std::vector<std::vector<int>> sortedCoordinates;
+  std::vector<char> sortedBuffer(components.size() * componentSize);
+  for (size_t i = 0; i < components.size(); ++i) {
+    std::vector<int> coordinate = {coordinates[1][i], coordinates[2][i],
+                                   coordinates[0][i]};
+    memcpy(&sortedBuffer[i * componentSize], coordinate.data(),
+           order * sizeof(int));
+    memcpy(&sortedBuffer[i * componentSize + order * sizeof(int)], &values[i],
+           sizeof(double));
+  }
+  std::vector<double> sortedValues(components.size());
+  taco::sortCoordinates(sortedBuffer.data(), components.size(), componentSize,
+                        sizeof(double), {2, 0, 1}, sortedCoordinates,
+                        (char*)sortedValues.data());
+  ASSERT_EQ(coordinates, sortedCoordinates);
+  ASSERT_EQ(values, sortedValues);
+}
+
+TEST(storage, pack_unsorted) {
+  const int size = 200;
+  Tensor<double> A({size, size}, Format({Sparse, Sparse}, {1, 0}));
+  Tensor<double> B({size, size}, Format({Dense, Dense}));
+  for (int k = 0; k < size * 7; ++k) {
+    int i = (k * 7919) % size;
+    int j = (k * 104729 + 13) % size;
+    A.insert({i, j}, (double)k);
+    B.insert({i, j}, (double)k);
+  }
+  A.pack();
+  B.pack();
+
+  for (auto component : B) {
+    ASSERT_EQ(component.second, A.at(component.first.toVector()));
+  }
+}
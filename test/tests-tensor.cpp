@@ -1,6 +1,7 @@
 #include "test.h"
 #include "taco/component.h"
 #include "taco/tensor.h"
+#include "taco/target.h"
 #include "test_tensors.h"
 
 #include <sstream>
@@ -114,6 +115,118 @@ TEST(tensor, transpose) {
   ASSERT_TRUE(equals(tensor.transpose({0,1,2}), tensor));
 }
 
+TEST(tensor, transpose_compressed) {
+  // Large enough to be transposed by several threads
+  const int rows = 600;
+  const int cols = 500;
+  Tensor<double> csr({rows, cols}, CSR);
+  Tensor<double> expected({cols, rows}, CSR);
+  Tensor<double> expectedCSC({rows, cols}, CSC);
+  for (int k = 0; k < 200000; ++k) {
+    int i = (k * 7) % rows;
+    int j = (k * 13 + k / rows) % cols;
+    csr.insert({i, j}, (double)k);
+    expected.insert({j, i}, (double)k);
+    expectedCSC.insert({i, j}, (double)k);
+  }
+  csr.pack();
+  expected.pack();
+  expectedCSC.pack();
+
+  int numThreads = taco_get_num_threads();
+  taco_set_num_threads(4);
+  Tensor<double> transposed = csr.transpose({1, 0});
+  Tensor<double> csc = csr.transpose({0, 1}, CSC);
+  taco_set_num_threads(numThreads);
+
+  ASSERT_EQ(CSR, transposed.getFormat());
+  ASSERT_TRUE(equals(expected, transposed));
+  ASSERT_EQ(CSC, csc.getFormat());
+  ASSERT_TRUE(equals(expectedCSC, csc));
+}
+
+TEST(tensor, remove_explicit_zeros) {
+  Tensor<double> tensor({3, 4}, Format({Sparse, Sparse}));
+  tensor.insert({0, 1}, 1.0);
+  tensor.insert({1, 1}, 0.0);
+  tensor.insert({2, 0}, 2.0);
+  tensor.insert({2, 3}, 0.0);
+  tensor.pack();
+
+  Tensor<double> expected({3, 4}, CSC);
+  expected.insert({0, 1}, 1.0);
+  expected.insert({2, 0}, 2.0);
+  expected.pack();
+
+  Tensor<double> withoutZeros = tensor.removeExplicitZeros(CSC);
+  ASSERT_EQ(2u, withoutZeros.getStorage().getIndex().getSize());
+  ASSERT_TRUE(equals(expected, withoutZeros));
+
+  Tensor<double> dense({3, 4}, Format({Dense, Dense}));
+  dense.insert({1, 2}, 3.0);
+  dense.pack();
+  Tensor<double> sparse = dense.removeExplicitZeros(Format({Sparse, Sparse}));
+  ASSERT_EQ(1u, sparse.getStorage().getIndex().getSize());
+  ASSERT_EQ(3.0, sparse.at({1, 2}));
+}
+
+TEST(tensor, index_types) {
+  Format wideCSR({Dense, Sparse});
+  wideCSR.setLevelArrayTypes({{Int32}, {Int64, Int16}});
+  Format coo = COO(2);
+  coo.setLevelArrayTypes({{UInt32, UInt16}, {UInt32, UInt16}});
+  ASSERT_NE(CSR, wideCSR);
+  ASSERT_EQ(Int64, wideCSR.getPositionType(1));
+  ASSERT_EQ(Int32, CSR.getPositionType(1));
+
+  Tensor<double> A("A", {50, 300}, wideCSR);
+  Tensor<double> B("B", {50, 300}, coo);
+  Tensor<double> expected("expected", {50, 300}, CSR);
+  for (int i = 0; i < 50; i++) {
+    for (int j = i % 7; j < 300; j += 7 + i % 5) {
+      A.insert({i, j}, (double)(i + j));
+      B.insert({i, j}, (double)(i + j));
+      expected.insert({i, j}, (double)(i + j));
+    }
+  }
+  A.pack();
+  B.pack();
+  expected.pack();
+
+  const ModeIndex& modeIndex = A.getStorage().getIndex().getModeIndex(1);
+  ASSERT_EQ(Int64, modeIndex.getIndexArray(0).getType());
+  ASSERT_EQ(Int16, modeIndex.getIndexArray(1).getType());
+  ASSERT_TRUE(equals(expected, A));
+  ASSERT_TRUE(equals(expected, B));
+  ASSERT_EQ(expected.at({3, 10}), A.at({3, 10}));
+
+  // Kernels read and assemble the index arrays with their types
+  Tensor<double> x("x", {300}, Format({Dense}));
+  for (int j = 0; j < 300; j++) {
+    x.insert({j}, (double)j);
+  }
+  x.pack();
+  IndexVar i, j;
+  Tensor<double> y("y", {50}, Format({Dense}));
+  Tensor<double> yExpected("yExpected", {50}, Format({Dense}));
+  y(i) = A(i,j) * x(j) + B(i,j);
+  yExpected(i) = expected(i,j) * x(j) + expected(i,j);
+  y.evaluate();
+  yExpected.evaluate();
+  ASSERT_TRUE(equals(yExpected, y));
+
+  Tensor<double> C("C", {50, 300}, wideCSR);
+  C(i,j) = A(i,j) + B(i,j);
+  C.evaluate();
+  Tensor<double> CExpected("CExpected", {50, 300}, CSR);
+  CExpected(i,j) = expected(i,j) + expected(i,j);
+  CExpected.evaluate();
+  ASSERT_TRUE(equals(CExpected, C));
+
+  Tensor<double> transposed = A.transpose({1, 0}, CSC);
+  ASSERT_TRUE(equals(expected.transpose({1, 0}, CSC), transposed));
+}
+
 TEST(tensor, operator_parens_insertion) {
   Tensor<double> a({5,5}, Sparse);
   a(1,2) = 42.0;
@@ -157,6 +270,80 @@ TEST(tensor, set_from_components) {
   }
 }
 
+TEST(tensor, make_tensor) {
+  Format csf({Dense, Sparse, Sparse}, {1, 0, 2});
+  Tensor<double> expected({2, 3, 4}, csf);
+  expected.insert({0, 0, 1}, 1.0);
+  expected.insert({1, 0, 3}, 2.0);
+  expected.insert({0, 2, 0}, 3.0);
+  expected.insert({0, 2, 2}, 4.0);
+  expected.pack();
+
+  // Levels are stored in the order of modes 1, 0 and 2
+  vector<int> pos1 = {0, 2, 2, 3};
+  vector<int> crd1 = {0, 1, 0};
+  vector<int> pos2 = {0, 1, 2, 4};
+  vector<int> crd2 = {1, 3, 0, 2};
+  vector<double> vals = {1.0, 2.0, 3.0, 4.0};
+  TensorBase tensor = makeTensor("tensor", {2, 3, 4}, csf,
+                                 {{}, {pos1.data(), crd1.data()},
+                                  {pos2.data(), crd2.data()}},
+                                 vals.data(), Array::UserOwns, true);
+  ASSERT_FALSE(tensor.needsPack());
+  ASSERT_EQ(vals.data(), tensor.getStorage().getValues().getData());
+  ASSERT_TENSOR_EQ(expected, tensor);
+
+  Tensor<double> expectedCOO({3, 3}, COO(2));
+  expectedCOO.insert({0, 1}, 1.0);
+  expectedCOO.insert({2, 0}, 2.0);
+  expectedCOO.insert({2, 2}, 3.0);
+  expectedCOO.pack();
+
+  vector<int> pos = {0, 3};
+  vector<int> rowidx = {0, 2, 2};
+  vector<int> colidx = {1, 0, 2};
+  vector<double> cooVals = {1.0, 2.0, 3.0};
+  TensorBase coo = makeTensor("coo", {3, 3}, COO(2),
+                              {{pos.data(), rowidx.data()}, {colidx.data()}},
+                              cooVals.data(), Array::UserOwns, true);
+  ASSERT_TENSOR_EQ(expectedCOO, coo);
+}
+
+TEST(tensor, insert_batch) {
+  Format format({Sparse, Sparse}, {1, 0});
+  Tensor<double> expected({4, 4}, format);
+  expected.insert({2, 0}, 1.0);
+  expected.insert({1, 1}, 2.0);
+  expected.insert({3, 1}, 3.0);
+  expected.insert({0, 3}, 4.0);
+  expected.pack();
+
+  // Unsorted coordinates
+  vector<int> coordinates = {3, 1, 0, 3, 2, 0, 1, 1};
+  vector<double> values = {3.0, 4.0, 1.0, 2.0};
+  Tensor<double> unsorted({4, 4}, format);
+  unsorted.insertBatch(coordinates.data(), values.data(), 4);
+  ASSERT_TRUE(unsorted.needsPack());
+  unsorted.pack();
+  ASSERT_TENSOR_EQ(expected, unsorted);
+
+  // Coordinates sorted in the storage order of the modes, in two batches
+  vector<int> sortedCoordinates = {2, 0, 1, 1, 3, 1, 0, 3};
+  vector<double> sortedValues = {1.0, 2.0, 3.0, 4.0};
+  Tensor<double> sorted({4, 4}, format);
+  sorted.insertBatch(sortedCoordinates.data(), sortedValues.data(), 2, true);
+  sorted.insertBatch(&sortedCoordinates[4], &sortedValues[2], 2, true);
+  sorted.pack();
+  ASSERT_TENSOR_EQ(expected, sorted);
+
+  // Sorted batches that are not sorted with respect to each other
+  Tensor<double> batches({4, 4}, format);
+  batches.insertBatch(&sortedCoordinates[4], &sortedValues[2], 2, true);
+  batches.insertBatch(sortedCoordinates.data(), sortedValues.data(), 2, true);
+  batches.pack();
+  ASSERT_TENSOR_EQ(expected, batches);
+}
+
 TEST(tensor, hidden_pack) {
   Tensor<double> a({5,5}, Sparse);
   a(1,2) = 42.0;
@@ -479,3 +666,246 @@ TEST(tensor, recompile) {
   ASSERT_TRUE(c.needsCompile());
   ASSERT_EQ(c.begin()->second, 42.0);
 }
+
+TEST(tensor, disk_kernel_cache) {
+  // Modules compiled in process by the JIT are not stored in the disk cache.
+  if (getTargetFromEnvironment().arch != Target::C99) {
+    return;
+  }
+
+  char cachedirTemplate[] = "/tmp/taco_cache_test_XXXXXX";
+  const string cachedir = mkdtemp(cachedirTemplate);
+  setenv("TACO_KERNEL_CACHE_DIR", cachedir.c_str(), 1);
+
+  Tensor<double> a({3}, Format({Dense}));
+  a(0) = 1.0;
+  a(2) = 3.0;
+  a.pack();
+
+  IndexVar i;
+  Tensor<double> b({3}, Format({Dense}));
+  b(i) = a(i) * 2.0;
+  b.evaluate();
+  ASSERT_FALSE(b.getSource().empty());
+
+  // Bypass the in-memory cache so that the kernel is loaded from disk instead
+  // of being generated and compiled again.
+  setenv("CACHE_KERNELS", "0", 1);
+  Tensor<double> c({3}, Format({Dense}));
+  c(i) = a(i) * 2.0;
+  c.evaluate();
+  unsetenv("CACHE_KERNELS");
+  unsetenv("TACO_KERNEL_CACHE_DIR");
+
+  ASSERT_TRUE(c.getSource().empty());
+  ASSERT_TENSOR_EQ(b, c);
+  ASSERT_EQ(0, system(("rm -rf " + cachedir).c_str()));
+}
+
+TEST(tensor, kernel_cache_reuse) {
+  IndexVar i;
+  Tensor<double> a({4}, Format({Dense}));
+  Tensor<double> b({4}, Format({Dense}));
+  Tensor<double> c({4}, Format({Dense}));
+  a(1) = 2.0;
+  a(3) = 4.0;
+  a.pack();
+
+  b(i) = a(i) * a(i);
+  b.evaluate();
+  c(i) = b(i) * b(i);
+  c.evaluate();
+
+  Tensor<double> d({4}, Format({Dense}));
+  d(i) = a(i) + a(i);
+  d.evaluate();
+
+  ASSERT_EQ(b.getSource(), c.getSource());
+  ASSERT_NE(b.getSource(), d.getSource());
+  ASSERT_EQ(16.0, c.at({1}));
+  ASSERT_EQ(8.0, d.at({3}));
+}
+
+TEST(tensor, compile_async) {
+  IndexVar i, j;
+  Tensor<double> B = d33a("B", Format({Dense, Sparse}));
+  Tensor<double> c = d3a("c", Format({Dense}));
+  B.pack();
+  c.pack();
+
+  Tensor<double> a({3}, Format({Dense}));
+  Tensor<double> D({3,3}, Format({Sparse, Sparse}));
+  a(i) = B(i,j) * c(j);
+  D(i,j) = B(i,j) + B(i,j);
+
+  // Both kernels compile concurrently
+  std::shared_future<void> aCompiled = a.compileAsync();
+  std::shared_future<void> DCompiled = D.compileAsync();
+  ASSERT_FALSE(a.needsCompile());
+  ASSERT_FALSE(D.needsCompile());
+
+  a.assemble();
+  a.compute();
+  D.assemble();
+  D.compute();
+  ASSERT_EQ(std::future_status::ready,
+            aCompiled.wait_for(std::chrono::seconds(0)));
+  ASSERT_EQ(std::future_status::ready,
+            DCompiled.wait_for(std::chrono::seconds(0)));
+
+  Tensor<double> expectedA({3}, Format({Dense}));
+  expectedA(i) = B(i,j) * c(j);
+  expectedA.compile();
+  expectedA.assemble();
+  expectedA.compute();
+  ASSERT_TENSOR_EQ(expectedA, a);
+
+  Tensor<double> expectedD({3,3}, Format({Sparse, Sparse}));
+  expectedD(i,j) = B(i,j) + B(i,j);
+  expectedD.evaluate();
+  ASSERT_TENSOR_EQ(expectedD, D);
+}
+
+TEST(tensor, symbolic_assembly) {
+  IndexVar i, j, k;
+  Tensor<double> B = d33a("B", CSR);
+  Tensor<double> C = d33b("C", CSR);
+  B.pack();
+  C.pack();
+
+  Tensor<double> add({3,3}, CSR);
+  add.setSymbolicAssembly(true);
+  add(i,j) = B(i,j) + C(i,j);
+  add.evaluate();
+
+  Tensor<double> expectedAdd({3,3}, Format({Dense, Dense}));
+  expectedAdd(i,j) = B(i,j) + C(i,j);
+  expectedAdd.evaluate();
+  ASSERT_TRUE(equals(expectedAdd, add));
+
+  // Sizes the values array with the symbolic phase too
+  Tensor<double> mul({3,3}, CSR);
+  mul.setSymbolicAssembly(true);
+  mul.setAssembleWhileCompute(true);
+  mul(i,j) = B(i,k) * C(k,j);
+  mul.evaluate();
+
+  Tensor<double> expectedMul({3,3}, Format({Dense, Dense}));
+  expectedMul(i,j) = B(i,k) * C(k,j);
+  expectedMul.evaluate();
+  ASSERT_TRUE(equals(expectedMul, mul));
+}
+
+struct CountingAllocator {
+  int allocations = 0;
+  int deallocations = 0;
+
+  static void* allocate(void* state, size_t size) {
+    ((CountingAllocator*)state)->allocations++;
+    return malloc(size);
+  }
+  static void* reallocate(void* state, void* ptr, size_t, size_t size) {
+    if (ptr == nullptr) {
+      ((CountingAllocator*)state)->allocations++;
+    }
+    return realloc(ptr, size);
+  }
+  static void deallocate(void* state, void* ptr) {
+    ((CountingAllocator*)state)->deallocations++;
+    free(ptr);
+  }
+};
+
+TEST(tensor, allocator) {
+  IndexVar i, j;
+  Tensor<double> B = d33a("B", Format({Dense, Sparse}));
+  B.pack();
+
+  CountingAllocator counts;
+  taco_allocator_t allocator = {CountingAllocator::allocate,
+                                CountingAllocator::reallocate,
+                                CountingAllocator::deallocate, &counts};
+  Tensor<double> D({3,3}, Format({Sparse, Sparse}));
+  D.setAllocator(&allocator);
+  ASSERT_EQ(&allocator, D.getAllocator());
+  D(i,j) = B(i,j) + B(i,j);
+  D.evaluate();
+  ASSERT_LT(0, counts.allocations);
+
+  Tensor<double> expected({3,3}, Format({Sparse, Sparse}));
+  expected(i,j) = B(i,j) + B(i,j);
+  expected.evaluate();
+  ASSERT_TENSOR_EQ(expected, D);
+
+  // Arrays with the allocator policy return their data to the allocator
+  int deallocations = counts.deallocations;
+  {
+    Array array(type<double>(), allocator.allocate(&counts, sizeof(double)), 1,
+                &allocator);
+  }
+  ASSERT_EQ(deallocations + 1, counts.deallocations);
+}
+
+TEST(tensor, fuse_producers) {
+  IndexVar i, j, k;
+  Tensor<double> B = d33a("B", CSR);
+  Tensor<double> C = d33b("C", Format({Dense, Dense}));
+  Tensor<double> D = d33b("D", CSR);
+  Tensor<double> x = d3b("x", Format({Dense}));
+  B.pack();
+  C.pack();
+  D.pack();
+  x.pack();
+
+  // A reduction is precomputed in a workspace of the consumer
+  Tensor<double> T({3,3}, Format({Dense, Dense}));
+  T(i,j) = B(i,k) * C(k,j);
+  Tensor<double> A({3,3}, Format({Dense, Dense}));
+  A.setFuseProducers(true);
+  A(i,j) = T(i,j) + D(i,j);
+  A.evaluate();
+  ASSERT_TRUE(T.needsCompute());
+
+  Tensor<double> expectedA({3,3}, Format({Dense, Dense}));
+  expectedA(i,j) = B(i,k) * C(k,j) + D(i,j);
+  expectedA.evaluate();
+  ASSERT_TRUE(equals(expectedA, A));
+
+  // Inlined producers are still computed if they are read
+  Tensor<double> expectedT({3,3}, Format({Dense, Dense}));
+  expectedT(i,j) = B(i,k) * C(k,j);
+  expectedT.evaluate();
+  ASSERT_TRUE(equals(expectedT, T));
+  ASSERT_FALSE(T.needsCompute());
+
+  // Chains of producers are inlined transitively
+  Tensor<double> S({3,3}, CSR);
+  S(i,j) = B(i,j) + D(i,j);
+  Tensor<double> R({3,3}, CSR);
+  R(i,j) = S(i,j) * C(i,j);
+  Tensor<double> y({3}, Format({Dense}));
+  y.setFuseProducers(true);
+  y(i) = R(i,j) * x(j);
+  y.evaluate();
+  ASSERT_TRUE(S.needsCompute());
+  ASSERT_TRUE(R.needsCompute());
+
+  Tensor<double> expectedY({3}, Format({Dense}));
+  expectedY(i) = sum(j, (B(i,j) + D(i,j)) * C(i,j) * x(j));
+  expectedY.evaluate();
+  ASSERT_TRUE(equals(expectedY, y));
+
+  // Producers that are read more than once are computed
+  Tensor<double> U({3,3}, CSR);
+  U(i,j) = B(i,j) * D(i,j);
+  Tensor<double> V({3,3}, CSR);
+  V.setFuseProducers(true);
+  V(i,j) = U(i,j) * U(i,j);
+  V.evaluate();
+  ASSERT_FALSE(U.needsCompute());
+
+  Tensor<double> expectedV({3,3}, Format({Dense, Dense}));
+  expectedV(i,j) = B(i,j) * D(i,j) * B(i,j) * D(i,j);
+  expectedV.evaluate();
+  ASSERT_TRUE(equals(expectedV, V));
+}
@@ -45,7 +45,7 @@ TYPED_TEST_P(VectorTensorTest, types) {
   ASSERT_EQ(t, a.getComponentType());
   ASSERT_EQ(1, a.getOrder());
   ASSERT_EQ(5, a.getDimension(0));
-  map<vector<int>,TypeParam> vals = {{{0}, 1.0}, {{2}, 2.0}};
+  map<vector<int>,TypeParam> vals = {{{0}, (TypeParam)1.0}, {{2}, (TypeParam)2.0}};
   for (auto& val : vals) {
     a.insert(val.first, val.second);
   }
@@ -99,7 +99,8 @@ static void printUsageInfo() {
   printFlag("f=<tensor>:<format>",
             "Specify the format of a tensor in the expression. Formats are "
             "specified per dimension using d (dense), s (sparse), "
-            "u (sparse, not unique), q (singleton), or c (singleton, not unique). "
+            "u (sparse, not unique), q (singleton), c (singleton, not unique), "
+            "h (hashed), or b (bitmap). "
             "All formats default to dense. "
             "The ordering of modes can also be optionally specified as a "
             "comma-delimited list of modes in the order they should be stored. "
@@ -266,18 +267,18 @@ static bool setSchedulingCommands(istream& in, parser::Parser& parser, IndexStmt
       IndexVar split2(i2);
       stmt = stmt.split(findVar(i), split1, split2, splitFactor);
 
-    // } else if (command == "divide") {
-    //   string i, i1, i2; 
-    //   in >> i; 
-    //   in >> i1; 
-    //   in >> i2; 
+    } else if (command == "divide") {
+      string i, i1, i2; 
+      in >> i; 
+      in >> i1; 
+      in >> i2; 
 
-    //   size_t divideFactor; 
-    //   in >> divideFactor; 
+      size_t divideFactor; 
+      in >> divideFactor; 
 
-    //   IndexVar divide1(i1);
-    //   IndexVar divide2(i2);
-    //   stmt = stmt.divide(findVar(i), divide1, divide2, divideFactor);
+      IndexVar divide1(i1);
+      IndexVar divide2(i2);
+      stmt = stmt.divide(findVar(i), divide1, divide2, divideFactor);
 
     } else if (command == "precompute") {
       string exprStr, i, iw; 
@@ -448,6 +449,8 @@ static bool setSchedulingCommands(istream& in, parser::Parser& parser, IndexStmt
         output_race_strategy = OutputRaceStrategy::Temporary;
       } else if (strategy == "ParallelReduction") {
         output_race_strategy = OutputRaceStrategy::ParallelReduction;
+      } else if (strategy == "ParallelAssembly") {
+        output_race_strategy = OutputRaceStrategy::ParallelAssembly;
       } else { 
         taco_uerror << "Race strategy not defined."; 
         goto end; 
@@ -563,6 +566,12 @@ int main(int argc, char* argv[]) {
           case 'q':
             modeTypes.push_back(ModeFormat::Singleton);
             break;
+          case 'h':
+            modeTypes.push_back(ModeFormat::Hashed);
+            break;
+          case 'b':
+            modeTypes.push_back(ModeFormat::Bitmap);
+            break;
           default:
             return reportError("Incorrect format descriptor", 3);
             break;